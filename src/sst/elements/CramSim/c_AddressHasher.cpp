@@ -267,132 +267,119 @@ void c_AddressHasher::build(Params &params) {
     }
   } // else found in map
 
-} // c_AddressHasher(SST::Params)
+  compileFieldMaps();
+  buildBankHash(params);
 
+} // c_AddressHasher(SST::Params)
 
-void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
-  ulong l_cur=0;
-  ulong l_cnt=0;
+// compileFieldMaps
+// turns the per-field bit position lists into shift/mask runs so that decoding
+// an address costs one shift, mask and or per contiguous group of bits
+void c_AddressHasher::compileFieldMaps() {
+  const char *l_names[k_numFields] = {"C", "c", "R", "B", "b", "r", "l", "h"};
 
-  //channel
-  auto l_bitPos = m_bitPositions.find("C");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+  for(unsigned l_field = 0; l_field < k_numFields; l_field++) {
+    c_FieldMap &l_map = m_fields[l_field];
+    l_map = c_FieldMap();
 
-      l_cur |= l_tmp;
+    auto l_bitPos = m_bitPositions.find(l_names[l_field]);
+    if(l_bitPos == m_bitPositions.end()) {
+      continue;
     }
-    x_hashAddr->setChannel(l_cur);
-  }
-
-  //pseudo channel
-   l_bitPos = m_bitPositions.find("c");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setPChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setPChannel(l_cur);
-  }
+    const vector<uint> &l_pos = l_bitPos->second;
+    unsigned l_cnt = 0;
+    while(l_cnt < l_pos.size()) {
+      // extend the run while both the address and field positions are consecutive
+      unsigned l_len = 1;
+      while(l_cnt + l_len < l_pos.size() && l_pos[l_cnt + l_len] == l_pos[l_cnt] + l_len) {
+        l_len++;
+      }
 
-  //rank
-  l_bitPos = m_bitPositions.find("R");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRank(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+      c_BitRun l_run;
+      l_run.srcShift = l_pos[l_cnt];
+      l_run.dstShift = l_cnt;
+      l_run.mask = (l_len >= 64) ? ~(ulong)0 : (((ulong)1 << l_len) - 1);
+      l_map.runs.push_back(l_run);
+      l_map.addrMask |= l_run.mask << l_run.srcShift;
 
-      l_cur |= l_tmp;
+      l_cnt += l_len;
     }
-    x_hashAddr->setRank(l_cur);
   }
+} // compileFieldMaps()
+
+// buildBankHash
+// sets up the XOR masks for the bank and bankgroup fields. Each hashed bit is
+// XORed with the parity of address bits outside both hashed fields, so the
+// mapping stays a permutation of the addresses within a row and the bank and
+// bankgroup can be unhashed independently of each other
+void c_AddressHasher::buildBankHash(Params &params) {
+  bool l_found = false;
+  string l_policy = params.find<string>("bankHashPolicy", "none", l_found);
 
-  //bankGroup
-  l_bitPos = m_bitPositions.find("B");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBankGroup(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
+  if(l_policy == "none") {
+    return;
+  } else if(l_policy == "permutation") {
+    // bank bits take the lowest row bits, bankgroup bits the row bits above those
+    const vector<uint> &l_rowPos = m_bitPositions["r"];
+    unsigned l_rowBit = 0;
+    unsigned l_hashFields[2] = {k_bank, k_bankGroup};
+    const char *l_names[2] = {"b", "B"};
+
+    for(unsigned l_idx = 0; l_idx < 2; l_idx++) {
+      c_FieldMap &l_map = m_fields[l_hashFields[l_idx]];
+      unsigned l_width = m_bitPositions[l_names[l_idx]].size();
+      for(unsigned l_bit = 0; l_bit < l_width && l_rowBit < l_rowPos.size(); l_bit++, l_rowBit++) {
+        l_map.xorMasks.push_back((ulong)1 << l_rowPos[l_rowBit]);
+      }
     }
-    x_hashAddr->setBankGroup(l_cur);
-  }
-
-  //bank
-  l_bitPos = m_bitPositions.find("b");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBank(0);
+  } else if(l_policy == "xor") {
+    parseXorMasks("bankXorMasks", params.find<string>("bankXorMasks", "", l_found), &m_fields[k_bank]);
+    parseXorMasks("bankGroupXorMasks", params.find<string>("bankGroupXorMasks", "", l_found), &m_fields[k_bankGroup]);
   } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    output->fatal(CALL_INFO, -1, "%s, Error!: unknown bankHashPolicy '%s'. Options are none, permutation and xor\n",
+            getName().c_str(), l_policy.c_str());
+  }
+} // buildBankHash(SST::Params)
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setBank(l_cur);
+void c_AddressHasher::parseXorMasks(const string &x_paramName, const string &x_masks, c_FieldMap *x_field) {
+  unsigned l_width = 0;
+  for(const c_BitRun &l_run : x_field->runs) {
+    l_width += __builtin_popcountl(l_run.mask);
   }
 
-  //row
-  l_bitPos = m_bitPositions.find("r");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRow(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+  stringstream l_stream(x_masks);
+  string l_token;
+  while(getline(l_stream, l_token, ',')) {
+    l_token.erase(remove_if(l_token.begin(), l_token.end(), ::isspace), l_token.end());
+    if(l_token.empty()) {
+      continue;
+    }
 
-      l_cur |= l_tmp;
+    ulong l_mask = strtoul(l_token.c_str(), nullptr, 0);
+    if(l_mask & (m_fields[k_bank].addrMask | m_fields[k_bankGroup].addrMask)) {
+      output->fatal(CALL_INFO, -1, "%s, Error!: %s entry %s uses bank or bankgroup address bits. Aborting!\n",
+              getName().c_str(), x_paramName.c_str(), l_token.c_str());
     }
-    x_hashAddr->setRow(l_cur);
+    x_field->xorMasks.push_back(l_mask);
   }
 
-  //col
-  l_bitPos = m_bitPositions.find("l");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCol(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCol(l_cur);
+  if(x_field->xorMasks.size() > l_width) {
+    output->fatal(CALL_INFO, -1, "%s, Error!: %s has %zu masks but the field only has %u bits in the address map. Aborting!\n",
+            getName().c_str(), x_paramName.c_str(), x_field->xorMasks.size(), l_width);
   }
+} // parseXorMasks(string, string, c_FieldMap)
 
-  //cacheline
-  l_bitPos = m_bitPositions.find("h");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCacheline(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCacheline(l_cur);
-  }
+void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
+  x_hashAddr->setChannel(m_fields[k_channel].extract(x_address));
+  x_hashAddr->setPChannel(m_fields[k_pchannel].extract(x_address));
+  x_hashAddr->setRank(m_fields[k_rank].extract(x_address));
+  x_hashAddr->setBankGroup(m_fields[k_bankGroup].extract(x_address));
+  x_hashAddr->setBank(m_fields[k_bank].extract(x_address));
+  x_hashAddr->setRow(m_fields[k_row].extract(x_address));
+  x_hashAddr->setCol(m_fields[k_col].extract(x_address));
+  x_hashAddr->setCacheline(m_fields[k_cacheline].extract(x_address));
 
   unsigned l_bankId =
     x_hashAddr->getBank()
@@ -451,11 +438,11 @@ ulong c_AddressHasher::getAddressForBankId(const unsigned x_bankId) {
 
   ulong l_address = 0;
   {
-    ulong l_tmp = l_bank;
+    ulong l_tmp = l_rank;
     ulong l_tOut = 0;
     unsigned l_curPos = 0;
     while(l_tmp) {
-      l_tOut += (l_tmp & 0x1) << m_bitPositions["b"][l_curPos];
+      l_tOut += (l_tmp & 0x1) << m_bitPositions["R"][l_curPos];
       l_tmp >>= 1;
       l_curPos++;
     }
@@ -464,11 +451,11 @@ ulong c_AddressHasher::getAddressForBankId(const unsigned x_bankId) {
   }
 
   {
-    ulong l_tmp = l_bankgroup;
+    ulong l_tmp = l_pchan;
     ulong l_tOut = 0;
     unsigned l_curPos = 0;
     while(l_tmp) {
-      l_tOut += (l_tmp & 0x1) << m_bitPositions["B"][l_curPos];
+      l_tOut += (l_tmp & 0x1) << m_bitPositions["c"][l_curPos];
       l_tmp >>= 1;
       l_curPos++;
     }
@@ -477,11 +464,11 @@ ulong c_AddressHasher::getAddressForBankId(const unsigned x_bankId) {
   }
 
   {
-    ulong l_tmp = l_rank;
+    ulong l_tmp = l_chan;
     ulong l_tOut = 0;
     unsigned l_curPos = 0;
     while(l_tmp) {
-      l_tOut += (l_tmp & 0x1) << m_bitPositions["R"][l_curPos];
+      l_tOut += (l_tmp & 0x1) << m_bitPositions["C"][l_curPos];
       l_tmp >>= 1;
       l_curPos++;
     }
@@ -489,12 +476,17 @@ ulong c_AddressHasher::getAddressForBankId(const unsigned x_bankId) {
     l_address += l_tOut;
   }
 
+  // the hash masks only cover bits placed above (and the row and column bits,
+  // which are zero), so XORing the same parity back in gives the address bits
+  l_bank ^= m_fields[k_bank].hashBits(l_address);
+  l_bankgroup ^= m_fields[k_bankGroup].hashBits(l_address);
+
   {
-    ulong l_tmp = l_pchan;
+    ulong l_tmp = l_bank;
     ulong l_tOut = 0;
     unsigned l_curPos = 0;
     while(l_tmp) {
-      l_tOut += (l_tmp & 0x1) << m_bitPositions["c"][l_curPos];
+      l_tOut += (l_tmp & 0x1) << m_bitPositions["b"][l_curPos];
       l_tmp >>= 1;
       l_curPos++;
     }
@@ -503,11 +495,11 @@ ulong c_AddressHasher::getAddressForBankId(const unsigned x_bankId) {
   }
 
   {
-    ulong l_tmp = l_chan;
+    ulong l_tmp = l_bankgroup;
     ulong l_tOut = 0;
     unsigned l_curPos = 0;
     while(l_tmp) {
-      l_tOut += (l_tmp & 0x1) << m_bitPositions["C"][l_curPos];
+      l_tOut += (l_tmp & 0x1) << m_bitPositions["B"][l_curPos];
       l_tmp >>= 1;
       l_curPos++;
     }
@@ -37,6 +37,10 @@
 
 #include <memory>
 #include <map>
+#include <vector>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 
 // local includes
 //#include "c_BankCommand.hpp"
@@ -70,6 +74,9 @@ namespace SST {
             SST_ELI_DOCUMENT_PARAMS(
                 {"numBytesPerTransaction", "Number of bytes retrieved for every transaction", "1"},
                 {"strAddressMapStr","String defining the address mapping scheme","_r_l_b_R_B_h_"},
+                {"bankHashPolicy", "XOR bank hashing applied after the address map. Options: none, permutation (bank and bankgroup bits are XORed with the lowest row bits), xor (use bankXorMasks/bankGroupXorMasks)", "none"},
+                {"bankXorMasks", "For bankHashPolicy=xor, comma separated address masks, one per bank bit starting at the lowest. Each bank bit is XORed with the parity of the address bits in its mask. Masks may not include bank or bankgroup bits", ""},
+                {"bankGroupXorMasks", "For bankHashPolicy=xor, comma separated address masks, one per bankgroup bit starting at the lowest", ""},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -100,6 +107,54 @@ namespace SST {
             c_AddressHasher(Params &x_params);
             ulong getAddressForBankId(const unsigned x_bankId);
 
+            // Fields decoded from an address, in the order of the structure hierarchy
+            enum e_Field { k_channel, k_pchannel, k_rank, k_bankGroup, k_bank, k_row, k_col, k_cacheline, k_numFields };
+
+            // A contiguous group of address bits that lands in a contiguous group of field bits
+            struct c_BitRun {
+              unsigned srcShift;
+              unsigned dstShift;
+              ulong mask;
+            };
+
+            // Precompiled extraction of one field, built once from m_bitPositions
+            struct c_FieldMap {
+              ulong addrMask;               // every address bit assigned to this field
+              std::vector<c_BitRun> runs;   // shift/mask steps, one per contiguous group
+              std::vector<ulong> xorMasks;  // field bit k is XORed with the parity of (address & xorMasks[k])
+
+              c_FieldMap() : addrMask(0) {}
+
+              inline ulong extract(const ulong x_address) const {
+#ifdef __BMI2__
+                // field bits are assigned in increasing address bit order, which is what pext gathers
+                ulong l_val = _pext_u64(x_address, addrMask);
+#else
+                ulong l_val = 0;
+                for(const c_BitRun &l_run : runs) {
+                  l_val |= ((x_address >> l_run.srcShift) & l_run.mask) << l_run.dstShift;
+                }
+#endif
+                return l_val ^ hashBits(x_address);
+              }
+
+              // bits XORed into the field value; the masks never include the
+              // bank or bankgroup bits, so this can be undone from the other fields
+              inline ulong hashBits(const ulong x_address) const {
+                ulong l_val = 0;
+                for(unsigned l_bit = 0; l_bit < xorMasks.size(); l_bit++) {
+                  l_val |= (ulong)__builtin_parityl(x_address & xorMasks[l_bit]) << l_bit;
+                }
+                return l_val;
+              }
+            };
+
+            void compileFieldMaps();
+            void buildBankHash(Params &x_params);
+            void parseXorMasks(const std::string &x_paramName, const std::string &x_masks, c_FieldMap *x_field);
+
+            c_FieldMap m_fields[k_numFields];
+
             unsigned k_pNumChannels;
             unsigned k_pNumRanks;
             unsigned k_pNumBankGroups;
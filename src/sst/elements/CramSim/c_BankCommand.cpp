@@ -41,16 +41,6 @@ c_BankCommand::c_BankCommand(unsigned x_cmdSeqNum,
 			     const c_HashedAddress &x_hashedAddr) :
 		m_seqNum(x_cmdSeqNum), m_addr(x_addr), m_cmdMnemonic(x_cmdMnemonic),
 		m_isResponseReady(false), m_hashedAddr(x_hashedAddr), m_bankId(x_hashedAddr.getBankId()), m_isRefreshType(false) {
-
-	m_cmdToString[e_BankCommandType::ERR] = "ERR";
-	m_cmdToString[e_BankCommandType::ACT] = "ACT";
-	m_cmdToString[e_BankCommandType::READ] = "READ";
-	m_cmdToString[e_BankCommandType::READA] = "READA";
-	m_cmdToString[e_BankCommandType::WRITE] = "WRITE";
-	m_cmdToString[e_BankCommandType::WRITEA] = "WRITEA";
-	m_cmdToString[e_BankCommandType::PRE] = "PRE";
-	m_cmdToString[e_BankCommandType::PREA] = "PREA";
-	m_cmdToString[e_BankCommandType::REF] = "REF";
 }
 
 c_BankCommand::c_BankCommand(unsigned x_cmdSeqNum,
@@ -60,16 +50,6 @@ c_BankCommand::c_BankCommand(unsigned x_cmdSeqNum,
 		m_isResponseReady(false), m_bankId(x_bankId), m_isRefreshType(true) {
 
 	assert(x_cmdMnemonic == e_BankCommandType::REF ||x_cmdMnemonic == e_BankCommandType::PRE); // This constructor only for REF cmds!
-
-	m_cmdToString[e_BankCommandType::ERR] = "ERR";
-	m_cmdToString[e_BankCommandType::ACT] = "ACT";
-	m_cmdToString[e_BankCommandType::READ] = "READ";
-	m_cmdToString[e_BankCommandType::READA] = "READA";
-	m_cmdToString[e_BankCommandType::WRITE] = "WRITE";
-	m_cmdToString[e_BankCommandType::WRITEA] = "WRITEA";
-	m_cmdToString[e_BankCommandType::PRE] = "PRE";
-	m_cmdToString[e_BankCommandType::PREA] = "PREA";
-	m_cmdToString[e_BankCommandType::REF] = "REF";
 }
 
 c_BankCommand::c_BankCommand(unsigned x_cmdSeqNum,
@@ -82,16 +62,6 @@ c_BankCommand::c_BankCommand(unsigned x_cmdSeqNum,
 
 	m_hashedAddr = x_hashedAddr;
 	m_bankId = x_bankIdVec.front();
-
-	m_cmdToString[e_BankCommandType::ERR] = "ERR";
-	m_cmdToString[e_BankCommandType::ACT] = "ACT";
-	m_cmdToString[e_BankCommandType::READ] = "READ";
-	m_cmdToString[e_BankCommandType::READA] = "READA";
-	m_cmdToString[e_BankCommandType::WRITE] = "WRITE";
-	m_cmdToString[e_BankCommandType::WRITEA] = "WRITEA";
-	m_cmdToString[e_BankCommandType::PRE] = "PRE";
-	m_cmdToString[e_BankCommandType::PREA] = "PREA";
-	m_cmdToString[e_BankCommandType::REF] = "REF";
 }
 
 ulong c_BankCommand::getAddress() const {
@@ -99,7 +69,23 @@ ulong c_BankCommand::getAddress() const {
 }
 
 std::string c_BankCommand::getCommandString() const {
-  return (m_cmdToString.find(m_cmdMnemonic)->second);
+  return (cmdToString().find(m_cmdMnemonic)->second);
+}
+
+// shared by all commands so that creating a command does not build a map
+const std::map<e_BankCommandType, std::string> &c_BankCommand::cmdToString() {
+	static const std::map<e_BankCommandType, std::string> l_cmdToString = {
+		{e_BankCommandType::ERR, "ERR"},
+		{e_BankCommandType::ACT, "ACT"},
+		{e_BankCommandType::READ, "READ"},
+		{e_BankCommandType::READA, "READA"},
+		{e_BankCommandType::WRITE, "WRITE"},
+		{e_BankCommandType::WRITEA, "WRITEA"},
+		{e_BankCommandType::PRE, "PRE"},
+		{e_BankCommandType::PREA, "PREA"},
+		{e_BankCommandType::REF, "REF"}
+	};
+	return l_cmdToString;
 }
 
 e_BankCommandType c_BankCommand::getCommandMnemonic() const {
@@ -171,7 +157,6 @@ void c_BankCommand::serialize_order(SST::Core::Serialization::serializer &ser)
   ser & m_bankId;
   ser & m_bankIdVec;
   ser & m_cmdMnemonic;
-  ser & m_cmdToString;
   ser & m_isResponseReady;
   ser & m_isResponseReady;
 
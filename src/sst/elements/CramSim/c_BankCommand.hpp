@@ -32,6 +32,8 @@
 #include <ostream>
 #include <map>
 #include <string>
+#include <vector>
+#include <new>
 
 //sst includes
 
@@ -64,7 +66,6 @@ private:
 	unsigned m_bankId;
 	std::vector<unsigned> m_bankIdVec;
 	e_BankCommandType m_cmdMnemonic;
-	std::map<e_BankCommandType, std::string> m_cmdToString;
 	bool m_isResponseReady;
         bool m_isRefreshType; // REF and PRE commands treated specially for printing cmd trace
 	c_HashedAddress m_hashedAddr;
@@ -140,6 +141,50 @@ public:
 
         ImplementSerializable(c_BankCommand);
 
+	// Several commands are created and deleted for every transaction, so freed
+	// commands are kept on a free list and handed out again instead of going to the heap
+	static void *operator new(size_t x_size)
+	{
+		std::vector<void*> &l_freeList = freeList();
+
+		if (x_size == sizeof(c_BankCommand) && !l_freeList.empty()) {
+			void *l_block = l_freeList.back();
+			l_freeList.pop_back();
+			return l_block;
+		}
+
+		return ::operator new(x_size);
+	}
+
+	static void operator delete(void *x_block, size_t x_size)
+	{
+		if (x_block == nullptr)
+			return;
+
+		std::vector<void*> &l_freeList = freeList();
+
+		if (x_size == sizeof(c_BankCommand) && l_freeList.size() < k_maxFreeCommands)
+			l_freeList.push_back(x_block);
+		else
+			::operator delete(x_block);
+	}
+
+private:
+
+	static const std::map<e_BankCommandType, std::string> &cmdToString();
+
+	static const size_t k_maxFreeCommands = 4096;
+
+	// The list is never destroyed: commands may still be deleted during
+	// simulation teardown after the thread's thread_local storage is gone
+	static std::vector<void*> &freeList()
+	{
+		static thread_local std::vector<void*> *l_freeList = nullptr;
+		if (l_freeList == nullptr)
+			l_freeList = new std::vector<void*>();
+		return *l_freeList;
+	}
+
 }; // class c_BankCommand
 
 } // namespace CramSim
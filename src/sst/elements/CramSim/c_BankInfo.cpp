@@ -28,6 +28,7 @@
 // limitations under the License.
 #include <memory>
 #include <assert.h>
+#include <algorithm>
 
 #include "sst_config.h"
 
@@ -154,6 +155,12 @@ void c_BankInfo::clockTic(SimTime_t x_cycle) {
 
 }
 
+void c_BankInfo::skipTics(SimTime_t x_tics) {
+	m_autoPrechargeTimer -= std::min(m_autoPrechargeTimer, x_tics);
+
+	m_bankState->skipTics(x_tics);
+}
+
 std::list<e_BankCommandType> c_BankInfo::getAllowedCommands() {
 	return m_bankState->getAllowedCommands();
 }
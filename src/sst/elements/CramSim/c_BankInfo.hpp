@@ -57,6 +57,12 @@ public:
 
 	void clockTic(SimTime_t x_cycle);
 
+	// idle clock tics of the current state, see c_BankState::getIdleTics()
+	SimTime_t getIdleTics() {
+		return m_bankState->getIdleTics();
+	}
+	void skipTics(SimTime_t x_tics);
+
 	std::list<e_BankCommandType> getAllowedCommands();
 
 	bool isCommandAllowed(c_BankCommand* x_cmdPtr, SimTime_t x_simCycle);
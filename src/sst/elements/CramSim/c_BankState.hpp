@@ -64,6 +64,18 @@ public:
 
 	virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) = 0;
 
+	// number of upcoming clockTic calls that only count timers down, assuming no command is received.
+	// k_noStateChange if the state does nothing until a command is received
+	virtual SimTime_t getIdleTics() {
+		return 0;
+	}
+
+	// apply x_tics idle clockTic calls at once, x_tics must not exceed getIdleTics()
+	virtual void skipTics(SimTime_t x_tics) {
+	}
+
+	static const SimTime_t k_noStateChange = (SimTime_t) -1;
+
 	virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 			c_BankCommand* x_cmdPtr, SimTime_t x_cycle) = 0;
 
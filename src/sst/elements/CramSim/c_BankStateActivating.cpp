@@ -75,6 +75,14 @@ void c_BankStateActivating::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateActivating::getIdleTics() {
+	return m_timer;
+}
+
+void c_BankStateActivating::skipTics(SimTime_t x_tics) {
+	m_timer -= x_tics;
+}
+
 void c_BankStateActivating::enter(c_BankInfo* x_bank,
 		c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
         //Simulation::getSimulation()->getSimulationOutput().output("Entered %s\n", __PRETTY_FUNCTION__);
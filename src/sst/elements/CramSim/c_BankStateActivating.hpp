@@ -56,6 +56,9 @@ public:
 
 	virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle);
 
+	virtual SimTime_t getIdleTics();
+	virtual void skipTics(SimTime_t x_tics);
+
 	virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 			c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
 	virtual std::list<e_BankCommandType> getAllowedCommands();
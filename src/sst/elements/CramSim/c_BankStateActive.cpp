@@ -120,6 +120,16 @@ void c_BankStateActive::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateActive::getIdleTics() {
+	if (nullptr == m_receivedCommandPtr)
+		return k_noStateChange;
+	return m_timer;
+}
+
+void c_BankStateActive::skipTics(SimTime_t x_tics) {
+	m_timer -= std::min(m_timer, x_tics);
+}
+
 void c_BankStateActive::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
@@ -125,6 +125,19 @@ void c_BankStateIdle::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateIdle::getIdleTics() {
+	if (m_receivedCommandPtr)
+		return 0;
+	// the response of the previous command becomes ready when the timer reaches 1
+	if (m_prevCommandPtr && 2 <= m_timer)
+		return m_timer - 2;
+	return k_noStateChange;
+}
+
+void c_BankStateIdle::skipTics(SimTime_t x_tics) {
+	m_timer -= x_tics;	// the timer counts down every cycle, like clockTic does
+}
+
 // call this function after receiving a command
 void c_BankStateIdle::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
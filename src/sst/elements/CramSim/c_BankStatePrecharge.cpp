@@ -79,6 +79,14 @@ void c_BankStatePrecharge::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStatePrecharge::getIdleTics() {
+	return m_timer;
+}
+
+void c_BankStatePrecharge::skipTics(SimTime_t x_tics) {
+	m_timer -= x_tics;
+}
+
 void c_BankStatePrecharge::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr,SimTime_t x_cycle) {
 
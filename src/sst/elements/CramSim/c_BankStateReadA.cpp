@@ -102,6 +102,18 @@ void c_BankStateReadA::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 
 }
 
+SimTime_t c_BankStateReadA::getIdleTics() {
+	if (0 < m_timerEnter)
+		return m_timerEnter;
+	return (0 < m_timerExit) ? m_timerExit - 1 : 0;
+}
+
+void c_BankStateReadA::skipTics(SimTime_t x_tics) {
+	SimTime_t l_tics = std::min(m_timerEnter, x_tics);
+	m_timerEnter -= l_tics;
+	m_timerExit -= x_tics - l_tics;
+}
+
 void c_BankStateReadA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
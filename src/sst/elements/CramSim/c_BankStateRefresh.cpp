@@ -88,6 +88,14 @@ void c_BankStateRefresh::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateRefresh::getIdleTics() {
+	return m_timer;
+}
+
+void c_BankStateRefresh::skipTics(SimTime_t x_tics) {
+	m_timer -= x_tics;
+}
+
 // call this function after receiving a command
 void c_BankStateRefresh::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
@@ -183,6 +183,21 @@ void c_BankStateWrite::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateWrite::getIdleTics() {
+	if (nullptr == m_receivedCommandPtr)
+		return k_noStateChange;
+	if (0 < m_timer)
+		return m_timer;
+	return (0 < m_timerExit) ? m_timerExit - 1 : 0;
+}
+
+void c_BankStateWrite::skipTics(SimTime_t x_tics) {
+	SimTime_t l_tics = std::min(m_timer, x_tics);
+	m_timer -= l_tics;
+	if (m_receivedCommandPtr && 1 < m_timerExit)
+		m_timerExit -= x_tics - l_tics;
+}
+
 void c_BankStateWrite::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
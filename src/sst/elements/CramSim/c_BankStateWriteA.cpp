@@ -94,6 +94,18 @@ void c_BankStateWriteA::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateWriteA::getIdleTics() {
+	if (0 < m_timerEnter)
+		return m_timerEnter;
+	return (0 < m_timerExit) ? m_timerExit - 1 : 0;
+}
+
+void c_BankStateWriteA::skipTics(SimTime_t x_tics) {
+	SimTime_t l_tics = std::min(m_timerEnter, x_tics);
+	m_timerEnter -= l_tics;
+	m_timerExit -= x_tics - l_tics;
+}
+
 void c_BankStateWriteA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
         // Simulation::getSimulation()->getSimulationOutput().output("Entered %s\n", __PRETTY_FUNCTION__);
@@ -0,0 +1,163 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+// std includes
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// local includes
+#include "c_BinaryTraceReader.hpp"
+
+using namespace SST;
+using namespace SST::CramSim;
+
+const char c_BinaryTraceReader::k_magic[8] = {'C','R','A','M','T','R','C','\0'};
+
+c_BinaryTraceReader::c_BinaryTraceReader(SST::Output* x_output, const std::string& x_fileName,
+                                         bool x_useMmap, bool x_useThread, size_t x_queueEntries) :
+    m_output(x_output), m_timing(e_timing::ABSOLUTE), m_fd(-1), m_map(nullptr), m_mapSize(0), m_mapOffset(0),
+    m_useThread(x_useThread), m_queueHead(0), m_queueTail(0), m_readerDone(false), m_stopReader(false)
+{
+    char l_header[16];
+
+    if (x_useMmap) {
+        m_fd = open(x_fileName.c_str(), O_RDONLY);
+        if (m_fd < 0) {
+            m_output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", x_fileName.c_str());
+        }
+
+        struct stat l_stat;
+        if (fstat(m_fd, &l_stat) != 0 || (size_t) l_stat.st_size < sizeof(l_header)) {
+            m_output->fatal(CALL_INFO, -1, "TraceFileReader: %s is too short to be a binary trace\n", x_fileName.c_str());
+        }
+
+        m_mapSize = l_stat.st_size;
+        void* l_map = mmap(nullptr, m_mapSize, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if (l_map == MAP_FAILED) {
+            m_output->fatal(CALL_INFO, -1, "TraceFileReader: unable to map trace file %s\n", x_fileName.c_str());
+        }
+        m_map = static_cast<const uint8_t*>(l_map);
+        madvise(l_map, m_mapSize, MADV_SEQUENTIAL);
+
+        memcpy(l_header, m_map, sizeof(l_header));
+        m_mapOffset = sizeof(l_header);
+    } else {
+        m_stream.open(x_fileName, std::ifstream::in | std::ifstream::binary);
+        if (!m_stream) {
+            m_output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", x_fileName.c_str());
+        }
+        if (!m_stream.read(l_header, sizeof(l_header))) {
+            m_output->fatal(CALL_INFO, -1, "TraceFileReader: %s is too short to be a binary trace\n", x_fileName.c_str());
+        }
+    }
+
+    uint32_t l_version, l_timing;
+    memcpy(&l_version, l_header + 8, sizeof(l_version));
+    memcpy(&l_timing, l_header + 12, sizeof(l_timing));
+
+    if (memcmp(l_header, k_magic, sizeof(k_magic)) != 0) {
+        m_output->fatal(CALL_INFO, -1, "TraceFileReader: %s is not a binary trace (bad magic)\n", x_fileName.c_str());
+    }
+    if (l_version != k_version) {
+        m_output->fatal(CALL_INFO, -1, "TraceFileReader: %s has binary trace version %u, expected %u\n",
+                        x_fileName.c_str(), l_version, k_version);
+    }
+    if (l_timing > (uint32_t) e_timing::RELATIVE) {
+        m_output->fatal(CALL_INFO, -1, "TraceFileReader: %s has an unknown timing mode %u\n", x_fileName.c_str(), l_timing);
+    }
+    m_timing = (e_timing) l_timing;
+
+    if (m_useThread) {
+        if (x_queueEntries == 0) {
+            m_output->fatal(CALL_INFO, -1, "TraceFileReader: traceQueueEntries should be greater than zero\n");
+        }
+        m_queue.resize(x_queueEntries);
+        m_reader = std::thread(&c_BinaryTraceReader::readerThread, this);
+    }
+}
+
+c_BinaryTraceReader::~c_BinaryTraceReader()
+{
+    if (m_reader.joinable()) {
+        m_stopReader.store(true, std::memory_order_release);
+        m_reader.join();
+    }
+
+    if (m_map != nullptr)
+        munmap(const_cast<uint8_t*>(m_map), m_mapSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+bool c_BinaryTraceReader::decode(t_record& x_record)
+{
+    if (m_map != nullptr) {
+        if (m_mapOffset + sizeof(t_record) > m_mapSize)
+            return false;
+        memcpy(&x_record, m_map + m_mapOffset, sizeof(t_record));
+        m_mapOffset += sizeof(t_record);
+        return true;
+    }
+
+    return (bool) m_stream.read(reinterpret_cast<char*>(&x_record), sizeof(t_record));
+}
+
+void c_BinaryTraceReader::readerThread()
+{
+    const size_t l_numEntries = m_queue.size();
+    size_t l_tail = m_queueTail.load(std::memory_order_relaxed);
+    t_record l_record;
+
+    while (decode(l_record)) {
+        // wait for a free slot
+        while (l_tail - m_queueHead.load(std::memory_order_acquire) == l_numEntries) {
+            if (m_stopReader.load(std::memory_order_acquire))
+                return;
+            std::this_thread::yield();
+        }
+
+        m_queue[l_tail % l_numEntries] = l_record;
+        m_queueTail.store(++l_tail, std::memory_order_release);
+    }
+
+    m_readerDone.store(true, std::memory_order_release);
+}
+
+bool c_BinaryTraceReader::next(t_record& x_record)
+{
+    if (!m_useThread)
+        return decode(x_record);
+
+    size_t l_head = m_queueHead.load(std::memory_order_relaxed);
+    while (true) {
+        if (l_head != m_queueTail.load(std::memory_order_acquire)) {
+            x_record = m_queue[l_head % m_queue.size()];
+            m_queueHead.store(l_head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // the reader publishes its last record before it sets m_readerDone
+        if (m_readerDone.load(std::memory_order_acquire)
+            && l_head == m_queueTail.load(std::memory_order_acquire))
+            return false;
+
+        std::this_thread::yield();
+    }
+}
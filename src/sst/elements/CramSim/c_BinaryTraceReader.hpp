@@ -0,0 +1,96 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef C_BINARYTRACEREADER_HPP
+#define C_BINARYTRACEREADER_HPP
+
+#include <stdint.h>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sst/core/output.h>
+
+namespace SST {
+    namespace CramSim {
+
+        /*!
+         * Reader for CramSim binary traces, written by traces/traceToBinary.py.
+         *
+         * File layout, little endian:
+         *   header:  char magic[8] = "CRAMTRC", uint32_t version = 1, uint32_t timing
+         *   records: uint64_t address, uint32_t cycle, uint32_t flags (bit 0 set for a write)
+         *
+         * With ABSOLUTE timing (DRAMSim2 traces) the cycle is the issue cycle of the record.
+         * With RELATIVE timing (USIMM traces) it is the delay from the cycle the record is read.
+         *
+         * The file is either mapped or read through a stream. Records are decoded on the
+         * simulation thread, or by a background thread that fills a bounded single-producer,
+         * single-consumer queue.
+         */
+        class c_BinaryTraceReader {
+        public:
+            enum class e_timing : uint32_t {ABSOLUTE = 0, RELATIVE = 1};
+
+            struct t_record {
+                uint64_t m_address;
+                uint32_t m_cycle;
+                uint32_t m_flags;
+            };
+
+            static const char k_magic[8];
+            static const uint32_t k_version = 1;
+            static const uint32_t k_flagWrite = 0x1;
+
+            c_BinaryTraceReader(SST::Output* x_output, const std::string& x_fileName,
+                                bool x_useMmap, bool x_useThread, size_t x_queueEntries);
+            ~c_BinaryTraceReader();
+
+            //** get the next record, false at the end of the trace
+            bool next(t_record& x_record);
+
+            e_timing getTiming() const { return m_timing; }
+
+        private:
+            bool decode(t_record& x_record);
+            void readerThread();
+
+            SST::Output* m_output;
+            e_timing m_timing;
+
+            // mapped file
+            int m_fd;
+            const uint8_t* m_map;
+            size_t m_mapSize;
+            size_t m_mapOffset;
+
+            // streamed file
+            std::ifstream m_stream;
+
+            // queue filled by the reader thread
+            bool m_useThread;
+            std::vector<t_record> m_queue;
+            std::atomic<size_t> m_queueHead;    // next record to pop, written by the simulation thread
+            std::atomic<size_t> m_queueTail;    // next free slot, written by the reader thread
+            std::atomic<bool> m_readerDone;
+            std::atomic<bool> m_stopReader;
+            std::thread m_reader;
+        };
+    }
+}
+
+#endif //C_BINARYTRACEREADER_HPP
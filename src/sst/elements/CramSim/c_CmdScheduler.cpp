@@ -146,6 +146,38 @@ bool c_CmdScheduler::push(c_BankCommand* x_cmd) {
 }
 
 
+/*!
+ * @return "true" if no command is waiting in any command queue
+ */
+bool c_CmdScheduler::isEmpty()
+{
+    for (auto &l_chQueues : m_cmdQueues)
+        for (auto &l_cmdQueue : l_chQueues)
+            if (!l_cmdQueue.empty())
+                return false;
+    return true;
+}
+
+
+/*!
+ * Advance the round robin queue index over cycles in which run() was not called and all queues were empty
+ * @param x_cycles
+ */
+void c_CmdScheduler::skipCycles(SimTime_t x_cycles)
+{
+    for (unsigned l_ch = 0; l_ch < m_numChannels; l_ch++) {
+        SimTime_t l_idx = m_nextCmdQIdx.at(l_ch);
+        if (m_schedulingPolicy == e_SchedulingPolicy::BANK)
+            l_idx = (l_idx + x_cycles % m_numBanksPerChannel) % m_numBanksPerChannel;
+        else if (m_schedulingPolicy == e_SchedulingPolicy::RANK) {
+            SimTime_t l_mod = m_numBanksPerChannel - 1;
+            l_idx = (l_idx + (x_cycles % l_mod) * (m_numBanksPerRank % l_mod)) % l_mod;
+        }
+        m_nextCmdQIdx.at(l_ch) = l_idx;
+    }
+}
+
+
 unsigned c_CmdScheduler::getToken(const c_HashedAddress &x_addr)
 {
     unsigned l_ch=x_addr.getChannel();
@@ -118,16 +118,20 @@ c_Controller::c_Controller(ComponentId_t id, Params &params) :
         output->output("boolEnableQuickRes param value is missing... disabled\n");
     }
 
+    k_skipIdleCycles = params.find<bool>("boolSkipIdleCycles", false);
+
     // get configured clock frequency
     k_controllerClockFreqStr = (std::string)params.find<std::string>("strControllerClockFrequency", "1GHz", l_found);
 
+    //set our clock
+    m_clockHandler = new Clock::Handler<c_Controller>(this, &c_Controller::clockTic);
+    m_clockTC = registerClock(k_controllerClockFreqStr, m_clockHandler);
+    m_clockOn = true;
+    m_lastClockCycle = 0;
+
     //configure SST link
     configure_link();
 
-    //set our clock
-    registerClock(k_controllerClockFreqStr,
-                  new Clock::Handler<c_Controller>(this, &c_Controller::clockTic));
-
 
 
 }
@@ -149,6 +153,10 @@ void c_Controller::configure_link() {
     m_memLink = configureLink("memLink",
                                        new Event::Handler<c_Controller>(this,
                                                                         &c_Controller::handleInDeviceResPtrEvent));
+    // Controller -> Controller (wake up from idle)
+    m_wakeupLink = configureSelfLink("wakeupLink", m_clockTC,
+                                     new Event::Handler<c_Controller>(this,
+                                                                      &c_Controller::handleWakeup));
 }
 
 
@@ -221,11 +229,61 @@ bool c_Controller::clockTic(SST::Cycle_t clock) {
     // 6. run device driver
     m_deviceDriver->run();
 
+    // 7. turn the clock off until the next cycle with work, events turn it back on earlier
+    if (k_skipIdleCycles && isIdle()) {
+        SimTime_t l_wakeCycle = std::min(m_deviceDriver->getNextWakeCycle(), m_txnScheduler->getNextWakeCycle());
+        if (l_wakeCycle > m_simCycle + 1) {
+            // the clock is reregistered at the end of the cycle before, so that it tics in l_wakeCycle
+            if (l_wakeCycle != c_BankState::k_noStateChange)
+                m_wakeupLink->send(l_wakeCycle - m_simCycle - 1, nullptr);
+            m_lastClockCycle = clock;
+            m_clockOn = false;
+            return true;
+        }
+    }
 
     return false;
 }
 
 
+/*!
+ * @return "true" if nothing is queued in the controller or its subcomponents
+ */
+bool c_Controller::isIdle() {
+    if (!m_ReqQ.empty())
+        return false;
+
+    for (auto &l_txn : m_ResQ)
+        if (l_txn->isResponseReady())
+            return false;
+
+    return m_txnScheduler->isEmpty() && m_txnConverter->isIdle() && m_cmdScheduler->isEmpty();
+}
+
+
+void c_Controller::turnClockOn() {
+    if (m_clockOn)
+        return;
+    Cycle_t l_nextCycle = reregisterClock(m_clockTC, m_clockHandler);
+    m_clockOn = true;
+
+    // catch up the cycles skipped while the clock was off
+    SimTime_t l_skipped = l_nextCycle - m_lastClockCycle - 1;
+    if (l_skipped > 0) {
+        m_cmdScheduler->skipCycles(l_skipped);
+        m_deviceDriver->skipCycles(l_skipped);
+        m_simCycle += l_skipped;
+    }
+}
+
+
+void c_Controller::handleWakeup(SST::Event *ev) {
+    delete ev;
+    // a wakeup scheduled before an incoming event turned the clock on is stale, turning on early is harmless
+    turnClockOn();
+}
+
+
 void c_Controller::sendCommand(c_BankCommand* cmd)
 {
      c_CmdReqEvent *l_cmdReqEventPtr = new c_CmdReqEvent();
@@ -280,6 +338,8 @@ void c_Controller::handleIncomingTransaction(SST::Event *ev){
         m_ReqQ.push_back(newTxn);
         m_ResQ.push_back(newTxn);
 
+        turnClockOn();
+
 
         delete l_txnReqEventPtr;
     } else {
@@ -322,6 +382,8 @@ void c_Controller::handleInDeviceResPtrEvent(SST::Event *ev){
         delete l_cmdResEventPtr->m_payload;         //now, free the memory space allocated to the commands for a transaction
         delete l_cmdResEventPtr;
 
+        turnClockOn();
+
     } else {
         output->output("%s ERROR:: Bad event type!\n");
     }
@@ -65,7 +65,10 @@ namespace SST {
 
             SST_ELI_DOCUMENT_PARAMS(
                 {"verbose", "Output verbosity", "0"},
-                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" }
+                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" },
+                {"boolSkipIdleCycles", "Unregister the controller clock while all queues are empty, and reregister it when a transaction or "
+                                       "response arrives or at the next bank state change or refresh. Takes effect only with the device "
+                                       "driver's boolEventDrivenBanks. Cycle-identical to clocking every cycle", "0" }
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -101,6 +104,10 @@ namespace SST {
 
             virtual bool clockTic(SST::Cycle_t); // called every cycle
 
+            // idle cycle skipping
+            bool isIdle();
+            void turnClockOn();
+            void handleWakeup(SST::Event *ev);
 
             void sendResponse();
             void sendRequest();
@@ -128,9 +135,17 @@ namespace SST {
 
             // params for system configuration
             int k_enableQuickResponse;
+            bool k_skipIdleCycles;
 
 		    // clock frequency
 			std::string k_controllerClockFreqStr;
+            TimeConverter *m_clockTC;
+            Clock::Handler<c_Controller> *m_clockHandler;
+            bool m_clockOn;
+            SST::Cycle_t m_lastClockCycle;     // last clock cycle before the clock was turned off
+
+            // wakes the controller at the next cycle the device driver has work, while the clock is off
+            SST::Link *m_wakeupLink;
 
             // Transaction Generator <-> Controller Links
             SST::Link *m_txngenLink;
@@ -131,6 +131,8 @@ void c_DeviceDriver::build(Params& params) {
 	    output->output("boolUseSBRefresh (single bank refresh) param value is missing... disabled\n");
 	}
 
+	k_eventDrivenBanks = (uint32_t) params.find<uint32_t>("boolEventDrivenBanks", 0);
+
 	/* Device timing parameters*/
     //FIXME: Move this param reading to inside of c_BankInfo
     m_bankParams["nRC"] = (uint32_t) params.find<uint32_t>("nRC", 55, l_found);
@@ -335,6 +337,10 @@ void c_DeviceDriver::build(Params& params) {
 	}
 	assert(l_bankNum == m_numBanks);
 
+	// banks start idle, so nothing is scheduled until they receive a command
+	m_bankWakeCycle.resize(m_numBanks, c_BankState::k_noStateChange);
+	m_bankLastTic.resize(m_numBanks, 0);
+
 	// reset last data cmd issue cycle
 	m_lastDataCmdIssueCycle = 0;
 	m_lastDataCmdType = e_BankCommandType::READ;
@@ -342,8 +348,9 @@ void c_DeviceDriver::build(Params& params) {
 	m_lastChannel=0;
 
 	// reset command bus
-	m_blockColCmd.resize(k_numChannels);
-	m_blockRowCmd.resize(k_numChannels);
+	m_blockColCmd.resize(k_numChannels, 0);
+	m_blockRowCmd.resize(k_numChannels, 0);
+	m_numBusyCmdBuses = 0;
 
 	//init per-rank FAW tracker
 	initACTFAWTracker();
@@ -458,27 +465,49 @@ void c_DeviceDriver::update(SimTime_t simCycle) {
 
     m_simCycle = simCycle;
 
-	for (int l_i = 0; l_i != m_banks.size(); ++l_i) {
+	if (k_eventDrivenBanks) {
+		// only clock the banks whose state changes this cycle
+		while (!m_bankWakeQ.empty() && m_bankWakeQ.top().first <= m_simCycle) {
+			t_bankWakeup l_wakeup = m_bankWakeQ.top();
+			m_bankWakeQ.pop();
+			if (m_bankWakeCycle[l_wakeup.second] != l_wakeup.first)
+				continue; // stale, the bank was rescheduled
+
+			unsigned l_bankId = l_wakeup.second;
+			catchUpBank(l_bankId, m_simCycle - 1);
+			m_banks[l_bankId]->clockTic(m_simCycle);
+			m_bankLastTic[l_bankId] = m_simCycle;
+			scheduleBank(l_bankId);
+		}
+	} else {
+		for (int l_i = 0; l_i != m_banks.size(); ++l_i) {
 
-		m_banks.at(l_i)->clockTic(m_simCycle);
-		// m_banks.at(l_i)->printState();
+			m_banks.at(l_i)->clockTic(m_simCycle);
+			// m_banks.at(l_i)->printState();
+		}
 	}
-	//update ACTFAWTracker info
+	//update ACTFAWTracker info: the oldest cycle leaves the window and this cycle enters it
 	for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
-		m_cmdACTFAWtrackers[l_rankNum].push_back(
-				m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
-		m_cmdACTFAWtrackers[l_rankNum].pop_front();
+		std::vector<uint8_t> &l_tracker = m_cmdACTFAWtrackers[l_rankNum];
+		if (l_tracker.empty())
+			continue;
+
+		unsigned &l_head = m_cmdACTFAWhead[l_rankNum];
+		uint8_t l_issued = m_isACTIssued[l_rankNum] ? 1 : 0;
+		m_numACTinFAW[l_rankNum] -= l_tracker[l_head];
+		m_numACTinFAW[l_rankNum] += l_issued;
+		l_tracker[l_head] = l_issued;
+		if (++l_head == l_tracker.size())
+			l_head = 0;
 	}
 
 	// do the member var setup up before calling any req sending policy function
 	if (m_inflightWrites.size() > 0)
 		m_inflightWrites.clear();
 
-	m_blockBank.clear();
-	m_blockBank.resize(m_numBanks, false);
+	std::fill(m_blockBank.begin(), m_blockBank.end(), false);
 	releaseCommandBus();  //update the command bus status
-	m_isACTIssued.clear();
-	m_isACTIssued.resize(m_numRanks, false);
+	std::fill(m_isACTIssued.begin(), m_isACTIssued.end(), false);
 }
 
 
@@ -559,15 +588,6 @@ c_BankInfo* c_DeviceDriver::getBankInfo(unsigned x_bankId)
  */
 void c_DeviceDriver::sendRequest() {
 
-	// get count of ACT cmds issued in the FAW
-	std::vector<unsigned> l_numACTIssuedInFAW;
-	l_numACTIssuedInFAW.clear();
-	for(int l_rankId=0;l_rankId<m_numRanks;l_rankId++)
-	{
-		l_numACTIssuedInFAW.push_back(getNumIssuedACTinFAW(l_rankId));
-	}
-
-
 	for (auto l_cmdPtrItr = m_inputQ.begin(); l_cmdPtrItr != m_inputQ.end();)  {
 
 		bool l_proceed = true;
@@ -595,7 +615,7 @@ void c_DeviceDriver::sendRequest() {
 		if ((l_cmdPtr)->getCommandMnemonic() == e_BankCommandType::REF)
 			break;
 
-		if ((e_BankCommandType::ACT == ((l_cmdPtr))->getCommandMnemonic()) && (l_numACTIssuedInFAW[l_rankNum] >= 4))
+		if ((e_BankCommandType::ACT == ((l_cmdPtr))->getCommandMnemonic()) && (getNumIssuedACTinFAW(l_rankNum) >= 4))
 		{
 			l_proceed = false;
 		}
@@ -763,23 +783,17 @@ bool c_DeviceDriver::occupyCommandBus(c_BankCommand *l_cmdPtr) {
 	//Occupy the command bus
 	if (k_useDualCommandBus) {
 		if (l_cmdPtr->isColCommand())
-			m_blockColCmd.at(l_ChannelNum) = l_cmdCycle;
+			setCommandBusOccupancy(m_blockColCmd.at(l_ChannelNum), l_cmdCycle);
 		else
-			m_blockRowCmd.at(l_ChannelNum) = l_cmdCycle;
+			setCommandBusOccupancy(m_blockRowCmd.at(l_ChannelNum), l_cmdCycle);
 	}
 	else {
-		m_blockColCmd.at(l_ChannelNum) = 1;
-		m_blockRowCmd.at(l_ChannelNum) = 1;
+		setCommandBusOccupancy(m_blockColCmd.at(l_ChannelNum), 1);
+		setCommandBusOccupancy(m_blockRowCmd.at(l_ChannelNum), 1);
 	}
 
 	//Check whether all command buses are occupied
-	for(auto & value: m_blockColCmd)
-		if(value == 0)
-			l_NumAvailableBus++;
-
-	for(auto & value: m_blockRowCmd)
-		if(value == 0)
-			l_NumAvailableBus++;
+	l_NumAvailableBus = m_blockColCmd.size() + m_blockRowCmd.size() - m_numBusyCmdBuses;
 
 	if(l_NumAvailableBus>0) {
 		return false;
@@ -793,17 +807,31 @@ bool c_DeviceDriver::occupyCommandBus(c_BankCommand *l_cmdPtr) {
  *
  */
 void c_DeviceDriver::releaseCommandBus() {
+	if (m_numBusyCmdBuses == 0)
+		return;
+
 	for(auto & value: m_blockColCmd)
 	{
-		if(value>0) value--;
+		if(value>0 && --value==0) m_numBusyCmdBuses--;
 	}
 
 	for(auto & value: m_blockRowCmd)
 	{
-		if(value>0) value--;
+		if(value>0 && --value==0) m_numBusyCmdBuses--;
 	}
 }
 
+/**
+ * Set the number of cycles a command bus stays occupied, keeping the busy bus count up to date
+ */
+void c_DeviceDriver::setCommandBusOccupancy(uint8_t &x_bus, uint8_t x_cycles) {
+	if (x_bus == 0 && x_cycles > 0)
+		m_numBusyCmdBuses++;
+	else if (x_bus > 0 && x_cycles == 0)
+		m_numBusyCmdBuses--;
+	x_bus = x_cycles;
+}
+
 
 /*!
  *
@@ -865,8 +893,14 @@ bool c_DeviceDriver::sendCommand(c_BankCommand* x_bankCommandPtr,
 				     x_bankCommandPtr->getSeqNum());
 		#endif
 
+		if (k_eventDrivenBanks)
+			catchUpBank(x_bank->getBankId(), m_simCycle);
+
 		x_bank->handleCommand(x_bankCommandPtr, l_time);
 
+		if (k_eventDrivenBanks)
+			scheduleBank(x_bank->getBankId());
+
 		// push the command to output queue
 		m_outputQ.push_back(x_bankCommandPtr);
 
@@ -882,13 +916,9 @@ bool c_DeviceDriver::sendCommand(c_BankCommand* x_bankCommandPtr,
 void c_DeviceDriver::initACTFAWTracker()
 {
 	m_cmdACTFAWtrackers.clear();
-	for(int i=0; i<m_numRanks;i++)
-	{
-		std::list<unsigned> l_cmdACTFAWTracker;
-		l_cmdACTFAWTracker.clear();
-		l_cmdACTFAWTracker.resize(m_bankParams.at("nFAW")-1, 0);
-		m_cmdACTFAWtrackers.push_back(l_cmdACTFAWTracker);
-	}
+	m_cmdACTFAWtrackers.resize(m_numRanks, std::vector<uint8_t>(m_bankParams.at("nFAW")-1, 0));
+	m_cmdACTFAWhead.assign(m_numRanks, 0);
+	m_numACTinFAW.assign(m_numRanks, 0);
 }
 
 /*!
@@ -919,11 +949,8 @@ unsigned c_DeviceDriver::getNumIssuedACTinFAW(unsigned x_rankid) {
 	assert(x_rankid<m_numRanks);
 
 	// get count of ACT cmds issued in the FAW
-	unsigned l_cmdACTIssuedInFAW = 0;
 	assert(m_cmdACTFAWtrackers[x_rankid].size() == m_bankParams.at("nFAW")-1);
-	for(auto& l_issued : m_cmdACTFAWtrackers[x_rankid])
-		l_cmdACTIssuedInFAW += l_issued;
-	return l_cmdACTIssuedInFAW;
+	return m_numACTinFAW[x_rankid];
 }
 
 /*!
@@ -1048,3 +1075,110 @@ bool c_DeviceDriver::isRefreshing(const c_HashedAddress *x_addr)
 	else
 		return false;
 }
+
+/*!
+ * The next cycle at which update() and run() do more than count down timers: a bank changes its
+ * state or a refresh is due. Returns the cycle after the current one while commands are waiting,
+ * and c_BankState::k_noStateChange if nothing is scheduled
+ */
+SimTime_t c_DeviceDriver::getNextWakeCycle()
+{
+	if (!k_eventDrivenBanks || !m_inputQ.empty())
+		return m_simCycle + 1;
+
+	for (auto &l_cmdPtr : m_outputQ)
+		if (l_cmdPtr->isResponseReady())
+			return m_simCycle + 1;
+
+	// drop the stale entries so that the top is the next bank to change its state
+	while (!m_bankWakeQ.empty() && m_bankWakeCycle[m_bankWakeQ.top().second] != m_bankWakeQ.top().first)
+		m_bankWakeQ.pop();
+
+	SimTime_t l_wakeCycle = m_bankWakeQ.empty() ? c_BankState::k_noStateChange : m_bankWakeQ.top().first;
+
+	if (k_useRefresh) {
+		for (unsigned l_id = 0; l_id < m_numRanks; l_id++) {
+			if (!m_refreshCmdQ[l_id].empty())
+				return m_simCycle + 1;
+			// run() creates the refresh commands in the cycle after the counter reaches zero
+			l_wakeCycle = std::min(l_wakeCycle, m_simCycle + m_currentREFICount[l_id] + 1);
+		}
+	}
+	return l_wakeCycle;
+}
+
+/*!
+ * Apply x_cycles cycles in which neither update() nor run() was called, all of them before the
+ * cycle returned by getNextWakeCycle()
+ * @param x_cycles
+ */
+void c_DeviceDriver::skipCycles(SimTime_t x_cycles)
+{
+	//the ACT flags of the last clocked cycle enter the FAW windows, followed by cycles without ACTs
+	for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
+		std::vector<uint8_t> &l_tracker = m_cmdACTFAWtrackers[l_rankNum];
+		unsigned &l_head = m_cmdACTFAWhead[l_rankNum];
+		uint8_t l_issued = m_isACTIssued[l_rankNum] ? 1 : 0;
+		for (SimTime_t l_i = 0; l_i < std::min<SimTime_t>(x_cycles, l_tracker.size()); l_i++) {
+			m_numACTinFAW[l_rankNum] -= l_tracker[l_head];
+			m_numACTinFAW[l_rankNum] += l_issued;
+			l_tracker[l_head] = l_issued;
+			if (++l_head == l_tracker.size())
+				l_head = 0;
+			l_issued = 0;
+		}
+	}
+
+	if (m_inflightWrites.size() > 0)
+		m_inflightWrites.clear();
+	std::fill(m_blockBank.begin(), m_blockBank.end(), false);
+	std::fill(m_isACTIssued.begin(), m_isACTIssued.end(), false);
+
+	//update() and run() both release the command buses every cycle
+	for (SimTime_t l_i = 0; l_i < 2 * x_cycles && m_numBusyCmdBuses > 0; l_i++)
+		releaseCommandBus();
+
+	if (k_useRefresh) {
+		for (unsigned l_id = 0; l_id < m_numRanks; l_id++) {
+			assert(m_currentREFICount[l_id] >= x_cycles);
+			m_currentREFICount[l_id] -= x_cycles;
+		}
+	}
+
+	m_simCycle += x_cycles;
+}
+
+/*!
+ * Apply the clock tics a bank skipped since it was last clocked, up to and including x_cycle.
+ * The skipped tics only count timers down, see scheduleBank()
+ * @param x_bankId
+ * @param x_cycle
+ */
+void c_DeviceDriver::catchUpBank(unsigned x_bankId, SimTime_t x_cycle)
+{
+	if (x_cycle > m_bankLastTic[x_bankId]) {
+		m_banks[x_bankId]->skipTics(x_cycle - m_bankLastTic[x_bankId]);
+		m_bankLastTic[x_bankId] = x_cycle;
+	}
+}
+
+/*!
+ * Schedule the next clock tic of a bank that changes its state
+ * @param x_bankId
+ */
+void c_DeviceDriver::scheduleBank(unsigned x_bankId)
+{
+	SimTime_t l_idleTics = m_banks[x_bankId]->getIdleTics();
+	SimTime_t l_lastTic = m_bankLastTic[x_bankId];
+
+	if (l_idleTics >= c_BankState::k_noStateChange - l_lastTic - 1) {
+		m_bankWakeCycle[x_bankId] = c_BankState::k_noStateChange;
+		return;
+	}
+
+	SimTime_t l_wakeCycle = l_lastTic + l_idleTics + 1;
+	if (m_bankWakeCycle[x_bankId] != l_wakeCycle) {
+		m_bankWakeCycle[x_bankId] = l_wakeCycle;
+		m_bankWakeQ.push(std::make_pair(l_wakeCycle, x_bankId));
+	}
+}
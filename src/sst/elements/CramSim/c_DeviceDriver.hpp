@@ -91,6 +91,7 @@ public:
 		{"boolUseRefresh", "Whether to use REF or not", NULL},
 		{"boolDualCommandBus", "Whether to use dual command bus (added to support HBM)", NULL},
 		{"boolMultiCycleACT", "Whether to use multi-cycle (two cycles) active command (added to support HBM)", NULL},
+		{"boolEventDrivenBanks", "Only clock a bank when its state changes, skipping the cycles in which it just counts timers down. Cycle-identical to clocking every bank every cycle", "0"},
 		{"nRC", "Bank Param", NULL},
 		{"nRRD", "Bank Param", NULL},
 		{"nRRD_L", "Bank Param", NULL},
@@ -137,6 +138,10 @@ public:
     virtual c_BankInfo* getBankInfo(unsigned x_bankId);
     void update(SimTime_t simCycle);
 
+    /// skipping idle controller cycles, requires event-driven banks
+    SimTime_t getNextWakeCycle();
+    void skipCycles(SimTime_t x_cycles);
+
     unsigned getNumChannel(){return k_numChannels;}
     unsigned getNumPChPerChannel(){return k_numPChannelsPerChannel;}
     unsigned getNumRanksPerChannel(){return k_numRanksPerChannel;}
@@ -160,6 +165,7 @@ private:
     bool occupyCommandBus(c_BankCommand *x_cmdPtr);
     ///Release the occupancy of command bus
     void releaseCommandBus();
+    void setCommandBusOccupancy(uint8_t &x_bus, uint8_t x_cycles);
 
     void initACTFAWTracker();
     void initRefresh();
@@ -167,14 +173,19 @@ private:
     void createRefreshCmds(unsigned x_rank);
     bool isRefreshing(const c_HashedAddress *x_addr);
 
+    /// event-driven bank clocking
+    void catchUpBank(unsigned x_bankId, SimTime_t x_cycle);
+    void scheduleBank(unsigned x_bankId);
+
 	c_Controller *m_Owner;
 
 	std::deque<c_BankCommand*> m_inputQ;
 	std::deque<c_BankCommand*> m_outputQ;
 	std::vector<bool> m_blockBank;
 	std::set<unsigned> m_inflightWrites; // track inflight write commands
-	std::deque<unsigned> m_blockRowCmd; //command bus occupancy info
-	std::deque<unsigned> m_blockColCmd; //command bus occupancy info
+	std::vector<uint8_t> m_blockRowCmd; //command bus occupancy info, cycles left per channel
+	std::vector<uint8_t> m_blockColCmd; //command bus occupancy info, cycles left per channel
+	unsigned m_numBusyCmdBuses; //number of non-zero entries in m_blockRowCmd and m_blockColCmd
 
 	std::vector<unsigned> m_currentREFICount; //per rank REFICounter
 	std::vector<std::vector<c_BankCommand*>> m_refreshCmdQ; //per rank refresh commandQ
@@ -184,7 +195,10 @@ private:
 	e_BankCommandType m_lastDataCmdType;
 	unsigned m_lastChannel;
 	unsigned m_lastPseudoChannel;
-	std::vector<std::list<unsigned>> m_cmdACTFAWtrackers; // FIXME: change this to a circular buffer for speed. Could also implement as shift register.
+	// per-rank circular buffer of the ACT flags of the last nFAW-1 cycles, with a running count
+	std::vector<std::vector<uint8_t>> m_cmdACTFAWtrackers;
+	std::vector<unsigned> m_cmdACTFAWhead;	// oldest slot, overwritten by the next cycle
+	std::vector<unsigned> m_numACTinFAW;
 	std::vector<bool> m_isACTIssued;
 	bool m_issuedACT;
 
@@ -203,8 +217,16 @@ private:
 	bool k_multiCycleACT;
 	bool k_useRefresh;
 	bool k_useSBRefresh;
+	bool k_eventDrivenBanks;
 
 	std::vector<c_BankInfo*> m_banks;
+
+	// event-driven bank clocking: min-heap of (wake cycle, bank id). A bank has been clocked up to
+	// m_bankLastTic and changes state next at m_bankWakeCycle, heap entries that do not match it are stale
+	typedef std::pair<SimTime_t, unsigned> t_bankWakeup;
+	std::priority_queue<t_bankWakeup, std::vector<t_bankWakeup>, std::greater<t_bankWakeup>> m_bankWakeQ;
+	std::vector<SimTime_t> m_bankWakeCycle;
+	std::vector<SimTime_t> m_bankLastTic;
 	std::vector<c_BankGroup*> m_bankGroups;
 	std::vector<c_Rank*> m_ranks;
 	std::vector<c_Channel*> m_channel;
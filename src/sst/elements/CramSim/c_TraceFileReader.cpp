@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <iostream>
 #include <stdlib.h>
+#include <inttypes.h>
 
 #include <sst/core/stringize.h>
 
@@ -32,7 +33,8 @@
 using namespace SST;
 using namespace CramSim;
 
-c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params):c_TxnGenBase(x_id,x_params)
+c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params):c_TxnGenBase(x_id,x_params),
+    m_traceFileStream(nullptr), m_binaryTrace(nullptr), m_traceStarted(false), m_traceRateReported(false), m_numTraceTxns(0)
 {
     // trace file param
     bool l_found=false;
@@ -47,11 +49,6 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
     {
         output->output("TraceFileReader: tracefile name is %s\n", m_traceFileName.c_str());
     }
-    m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
-    if(!(*m_traceFileStream))
-    {
-        output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", m_traceFileName.c_str());
-    }
 
     // get trace file type
     std::string l_traceFileType= x_params.find<std::string>("traceFileType", "DEFAULT", l_found);
@@ -67,11 +64,32 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
     {
         m_traceType=e_TracefileType ::USIMM;
     }
+    else if(l_traceFileType=="BINARY")
+    {
+        m_traceType=e_TracefileType ::BINARY;
+    }
     else
     {
         output->fatal(CALL_INFO, -1, "TraceFileReader: trace file type error!!\n");
     }
 
+    if(m_traceType==e_TracefileType::BINARY)
+    {
+        bool l_useMmap = x_params.find<bool>("boolTraceMmap", true);
+        bool l_useThread = x_params.find<bool>("boolTraceReaderThread", true);
+        size_t l_queueEntries = x_params.find<size_t>("traceQueueEntries", 4096);
+
+        m_binaryTrace = new c_BinaryTraceReader(output, m_traceFileName, l_useMmap, l_useThread, l_queueEntries);
+    }
+    else
+    {
+        m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
+        if(!(*m_traceFileStream))
+        {
+            output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", m_traceFileName.c_str());
+        }
+    }
+
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
@@ -79,11 +97,42 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
 }
 
 
+c_TraceFileReader::~c_TraceFileReader()
+{
+    delete m_binaryTrace;
+    delete m_traceFileStream;
+}
+
+
 void c_TraceFileReader::createTxn()
 {
+    if (!m_traceStarted) {
+        m_traceStarted = true;
+        m_traceStartTime = std::chrono::steady_clock::now();
+    }
+
 // check if txn can fit inside Req q
     while(m_txnReqQ.size()<k_numTxnPerCycle)
     {
+        if (m_traceType == e_TracefileType::BINARY) {
+            e_TransactionType l_txnType;
+            ulong l_txnAddress;
+            uint64_t l_txnInterval;
+
+            if (!readBinaryTxn(l_txnType, l_txnAddress, l_txnInterval)) {
+                primaryComponentOKToEndSim();
+                output->output("TraceFileReader: Ran out of txn's to read\n");
+                reportTraceRate();
+                break;
+            }
+
+            c_Transaction* l_txn = new c_Transaction(m_seqNum, l_txnType, l_txnAddress, 1);
+            m_txnReqQ.push_back(std::make_pair(l_txn, l_txnInterval));
+            m_seqNum++;
+            m_numTraceTxns++;
+            continue;
+        }
+
         std::string l_line;
         if (std::getline(*m_traceFileStream, l_line)) {
             char_delimiter sep(" ");
@@ -152,12 +201,51 @@ void c_TraceFileReader::createTxn()
             std::pair<c_Transaction *, unsigned> l_entry = std::make_pair(l_txn, l_txnInterval);
             m_txnReqQ.push_back(l_entry);
             m_seqNum++;
+            m_numTraceTxns++;
         } else {
 
             primaryComponentOKToEndSim();
             output->output("TraceFileReader: Ran out of txn's to read\n");
+            reportTraceRate();
 
             break;
         }
     }
 }
+
+
+bool c_TraceFileReader::readBinaryTxn(e_TransactionType& x_txnType, ulong& x_txnAddress, uint64_t& x_txnInterval)
+{
+    c_BinaryTraceReader::t_record l_record;
+
+    if (!m_binaryTrace->next(l_record))
+        return false;
+
+    x_txnType = (l_record.m_flags & c_BinaryTraceReader::k_flagWrite) ? e_TransactionType::WRITE : e_TransactionType::READ;
+    x_txnAddress = (ulong) l_record.m_address;
+    if (m_binaryTrace->getTiming() == c_BinaryTraceReader::e_timing::RELATIVE)
+        x_txnInterval = m_simCycle + l_record.m_cycle; // same as USIMM text traces
+    else
+        x_txnInterval = l_record.m_cycle;
+
+    return true;
+}
+
+
+/*!
+ * Report how fast the trace was consumed, in wall-clock time from the first read to the end of the trace
+ */
+void c_TraceFileReader::reportTraceRate()
+{
+    if (m_traceRateReported)
+        return;
+    m_traceRateReported = true;
+
+    double l_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_traceStartTime).count();
+
+    if (l_seconds > 0)
+        output->output("TraceFileReader: read %" PRIu64 " transactions in %.3f s (%.0f txns/sec)\n",
+                       m_numTraceTxns, l_seconds, (double) m_numTraceTxns / l_seconds);
+    else
+        output->output("TraceFileReader: read %" PRIu64 " transactions\n", m_numTraceTxns);
+}
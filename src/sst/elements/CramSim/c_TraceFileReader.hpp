@@ -22,6 +22,7 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <chrono>
 
 //SST includes
 #include <sst/core/component.h>
@@ -30,6 +31,7 @@
 //local includes
 #include "c_Transaction.hpp"
 #include "c_TxnGen.hpp"
+#include "c_BinaryTraceReader.hpp"
 
 
 namespace SST {
@@ -50,7 +52,10 @@ namespace SST {
                 {"maxOutstandingReqs", "Maximum number of the outstanding requests", NULL},
                 {"numTxnPerCycle", "The number of transactions generated per cycle", NULL},
                 {"traceFile", "Location of trace file to read", NULL},
-                {"traceFileType", "Trace file type (DEFAULT or USIMM)",NULL},
+                {"traceFileType", "Trace file type (DEFAULT, USIMM or BINARY). BINARY traces are written by traces/traceToBinary.py",NULL},
+                {"boolTraceMmap", "BINARY traces: map the trace file instead of reading it through a stream", "1"},
+                {"boolTraceReaderThread", "BINARY traces: decode the trace in a background thread", "1"},
+                {"traceQueueEntries", "BINARY traces: number of records buffered between the reader thread and the simulation", "4096"},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -69,17 +74,27 @@ namespace SST {
             )
 
             c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params);
-            ~c_TraceFileReader(){}
+            ~c_TraceFileReader();
         private:
             enum e_TracefileType{
                 DEFAULT,   //DRAMsim2 type
-                USIMM
+                USIMM,
+                BINARY
             };
             virtual void createTxn();
+            bool readBinaryTxn(e_TransactionType& x_txnType, ulong& x_txnAddress, uint64_t& x_txnInterval);
+            void reportTraceRate();
 
             //params for internal microarcitecture
             std::string m_traceFileName;
             std::ifstream *m_traceFileStream;
+            c_BinaryTraceReader *m_binaryTrace;
+
+            //trace read rate
+            bool m_traceStarted;
+            bool m_traceRateReported;
+            std::chrono::steady_clock::time_point m_traceStartTime;
+            uint64_t m_numTraceTxns;
 
             e_TracefileType m_traceType;
         };
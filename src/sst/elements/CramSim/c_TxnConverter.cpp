@@ -47,6 +47,7 @@ c_TxnConverter::c_TxnConverter(SST::ComponentId_t id, SST::Params& x_params, Out
 
 void c_TxnConverter::build(SST::Params& x_params, unsigned l_bankNum) {
 	m_cmdSeqNum=0;
+	k_trackOpenRowChanges=false;
 
 	assert(l_bankNum>0);
 	for(unsigned i=0; i<l_bankNum;i++)
@@ -162,6 +163,21 @@ void c_TxnConverter::run(SimTime_t simCycle){
 
 
 
+bool c_TxnConverter::isIdle() {
+	if (!m_inputQ.empty())
+		return false;
+
+	//pseudo open page policy counts down the open rows every cycle
+	if (k_bankPolicy==2) {
+		for (auto &it:m_bankInfo)
+			if (it->isRowOpen())
+				return false;
+	}
+	return true;
+}
+
+
+
 void c_TxnConverter::push(c_Transaction* newTxn) {
 
 	// make sure the internal req q has at least one empty entry
@@ -343,6 +359,9 @@ void c_TxnConverter::updateBankInfo(c_Transaction* x_txn)
 	else{
 		output->fatal(CALL_INFO, 1, "bank policy error!!");
 	}
+
+	if(k_trackOpenRowChanges)
+		m_openRowChanges.push_back(l_bankid);
 }
 
 
@@ -95,6 +95,12 @@ public:
     void run(SimTime_t simCycle);
     void push(c_Transaction* newTxn); // receive txns from txnGen into req q
     c_BankInfo* getBankInfo(unsigned x_bankId);
+    bool isIdle(); // no pending transactions and no per-cycle bank state to update
+
+    //** record the banks whose open row is updated, for schedulers that index pending transactions by row
+    void trackOpenRowChanges() { k_trackOpenRowChanges = true; }
+    const std::vector<unsigned>& getOpenRowChanges() const { return m_openRowChanges; }
+    void clearOpenRowChanges() { m_openRowChanges.clear(); }
 
 private:
 
@@ -113,6 +119,7 @@ private:
 	unsigned m_cmdSeqNum;
 
 	std::deque<c_Transaction*> m_inputQ;
+	std::vector<unsigned> m_openRowChanges;
 
 	// params
 	int k_relCommandWidth; // txn relative command width
@@ -120,6 +127,7 @@ private:
 	bool k_useWriteA;
 	int k_bankPolicy;
 	SimTime_t k_bankCloseTime;
+	bool k_trackOpenRowChanges;
 
 
   	// Statistics
@@ -0,0 +1,127 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+// std includes
+#include <assert.h>
+
+// local includes
+#include "c_TxnQueueIndex.hpp"
+
+using namespace SST;
+using namespace SST::CramSim;
+
+
+void c_TxnQueueIndex::push(c_Transaction* x_txn)
+{
+    const c_HashedAddress &l_addr = x_txn->getHashedAddress();
+    assert(m_entries.find(x_txn) == m_entries.end());
+
+    TxnList &l_rowTxns = m_bankRows[l_addr.getBankId()][l_addr.getRow()];
+    TxnList &l_addrTxns = m_addrTxns[x_txn->getAddress()];
+
+    t_entry l_entry;
+    l_entry.m_ageItr = m_ageOrder.insert(m_ageOrder.end(), x_txn);
+    l_entry.m_rowItr = l_rowTxns.insert(l_rowTxns.end(), x_txn);
+    l_entry.m_addrItr = l_addrTxns.insert(l_addrTxns.end(), x_txn);
+    m_entries[x_txn] = l_entry;
+
+    auto l_openItr = m_openRows.find(l_addr.getBankId());
+    if (l_openItr != m_openRows.end() && l_openItr->second == l_addr.getRow())
+        m_rowHits[l_addr.getBankId()] = &l_rowTxns;
+}
+
+void c_TxnQueueIndex::remove(c_Transaction* x_txn)
+{
+    auto l_entryItr = m_entries.find(x_txn);
+    if (l_entryItr == m_entries.end())
+        return;
+
+    const c_HashedAddress &l_addr = x_txn->getHashedAddress();
+    t_entry &l_entry = l_entryItr->second;
+
+    m_ageOrder.erase(l_entry.m_ageItr);
+
+    auto l_bankItr = m_bankRows.find(l_addr.getBankId());
+    auto l_rowItr = l_bankItr->second.find(l_addr.getRow());
+    l_rowItr->second.erase(l_entry.m_rowItr);
+    if (l_rowItr->second.empty()) {
+        auto l_hitItr = m_rowHits.find(l_addr.getBankId());
+        if (l_hitItr != m_rowHits.end() && l_hitItr->second == &(l_rowItr->second))
+            m_rowHits.erase(l_hitItr);
+
+        l_bankItr->second.erase(l_rowItr);
+        if (l_bankItr->second.empty())
+            m_bankRows.erase(l_bankItr);
+    }
+
+    auto l_addrItr = m_addrTxns.find(x_txn->getAddress());
+    l_addrItr->second.erase(l_entry.m_addrItr);
+    if (l_addrItr->second.empty())
+        m_addrTxns.erase(l_addrItr);
+
+    m_entries.erase(l_entryItr);
+}
+
+const TxnList* c_TxnQueueIndex::getRowTxns(unsigned x_bankId, unsigned x_row) const
+{
+    auto l_bankItr = m_bankRows.find(x_bankId);
+    if (l_bankItr == m_bankRows.end())
+        return nullptr;
+
+    auto l_rowItr = l_bankItr->second.find(x_row);
+    if (l_rowItr == l_bankItr->second.end())
+        return nullptr;
+
+    return &(l_rowItr->second);
+}
+
+void c_TxnQueueIndex::setOpenRow(unsigned x_bankId, bool x_isOpen, unsigned x_row)
+{
+    m_rowHits.erase(x_bankId);
+
+    if (!x_isOpen) {
+        m_openRows.erase(x_bankId);
+        return;
+    }
+
+    m_openRows[x_bankId] = x_row;
+    const TxnList* l_rowTxns = getRowTxns(x_bankId, x_row);
+    if (l_rowTxns != nullptr)
+        m_rowHits[x_bankId] = l_rowTxns;
+}
+
+bool c_TxnQueueIndex::hasOlderTxn(ulong x_addr, ulong x_seqNum) const
+{
+    auto l_addrItr = m_addrTxns.find(x_addr);
+    if (l_addrItr == m_addrTxns.end())
+        return false;
+
+    return l_addrItr->second.front()->getSeqNum() < x_seqNum;
+}
+
+bool c_TxnQueueIndex::hasWrite(ulong x_addr) const
+{
+    auto l_addrItr = m_addrTxns.find(x_addr);
+    if (l_addrItr == m_addrTxns.end())
+        return false;
+
+    for (auto &l_txn : l_addrItr->second)
+        if (l_txn->isWrite())
+            return true;
+
+    return false;
+}
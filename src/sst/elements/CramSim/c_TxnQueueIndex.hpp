@@ -0,0 +1,78 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef C_TXNQUEUEINDEX_HPP
+#define C_TXNQUEUEINDEX_HPP
+
+#include <list>
+#include <map>
+#include <unordered_map>
+
+#include "c_Transaction.hpp"
+
+namespace SST {
+    namespace CramSim {
+
+        typedef std::list<c_Transaction*> TxnList;
+
+        /*!
+         * Transaction queue indexed by arrival order, by (bank, row) and by address.
+         * The bank id is unique across ranks, so (bank, row) also identifies the rank.
+         * Every list keeps its transactions oldest first.
+         */
+        class c_TxnQueueIndex {
+        public:
+            typedef std::unordered_map<unsigned, TxnList> RowMap;
+
+            void push(c_Transaction* x_txn);
+            void remove(c_Transaction* x_txn);
+
+            size_t size() const { return m_ageOrder.size(); }
+            bool empty() const { return m_ageOrder.empty(); }
+
+            //** all pending transactions, oldest first
+            const TxnList& getAgeOrder() const { return m_ageOrder; }
+            //** pending transactions to a row, oldest first, or nullptr if there are none
+            const TxnList* getRowTxns(unsigned x_bankId, unsigned x_row) const;
+
+            //** tell the index which row of a bank is open
+            void setOpenRow(unsigned x_bankId, bool x_isOpen, unsigned x_row);
+            //** banks whose open row has pending transactions, each with those transactions
+            const std::map<unsigned, const TxnList*>& getRowHits() const { return m_rowHits; }
+
+            //** true if a transaction older than x_seqNum accesses x_addr
+            bool hasOlderTxn(ulong x_addr, ulong x_seqNum) const;
+            //** true if a write to x_addr is pending
+            bool hasWrite(ulong x_addr) const;
+
+        private:
+            struct t_entry {
+                TxnList::iterator m_ageItr;
+                TxnList::iterator m_rowItr;
+                TxnList::iterator m_addrItr;
+            };
+
+            TxnList m_ageOrder;
+            std::map<unsigned, RowMap> m_bankRows;
+            std::unordered_map<ulong, TxnList> m_addrTxns;
+            std::unordered_map<c_Transaction*, t_entry> m_entries;
+
+            std::unordered_map<unsigned, unsigned> m_openRows;  // bank -> open row, for open banks only
+            std::map<unsigned, const TxnList*> m_rowHits;       // kept up to date on push, remove and setOpenRow
+        };
+    }
+}
+
+#endif //C_TXNQUEUEINDEX_HPP
@@ -33,6 +33,7 @@
 // std includes
 #include <iostream>
 #include <assert.h>
+#include <limits>
 
 // local includes
 #include "c_TxnScheduler.hpp"
@@ -68,6 +69,10 @@ void c_TxnScheduler::build(Params& x_params) {
     else if(l_txnSchedulingPolicy=="FRFCFS")
     {
         k_txnSchedulingPolicy=e_txnSchedulingPolicy::FRFCFS;
+    }
+    else if(l_txnSchedulingPolicy=="BLISS")
+    {
+        k_txnSchedulingPolicy=e_txnSchedulingPolicy::BLISS;
     } else
     {
         m_out->fatal(CALL_INFO, 1, "unsupported txnSchedulingPolicy (%s),, exit\n", l_txnSchedulingPolicy.c_str());
@@ -85,12 +90,40 @@ void c_TxnScheduler::build(Params& x_params) {
     }
 
 
+    k_isIndexedTxnQueue = (unsigned) x_params.find<unsigned>("boolIndexedTxnQueue",0,l_found);
+
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) {
+        k_isIndexedTxnQueue = true; // BLISS is only implemented on the indexed queue
+        k_blissBlacklistThreshold = (unsigned) x_params.find<unsigned>("blissBlacklistThreshold", 4, l_found);
+        k_blissClearingInterval = (SimTime_t) x_params.find<SimTime_t>("blissClearingInterval", 10000, l_found);
+        if (k_blissClearingInterval == 0) {
+            m_out->fatal(CALL_INFO, 1, "blissClearingInterval should be greater than zero\n");
+        }
+        m_lastServedBank.resize(m_numChannels, -1);
+        m_numServedInARow.resize(m_numChannels, 0);
+        m_nextBlacklistClearing = k_blissClearingInterval;
+    }
+
+    //the indexed queues follow the open rows through the converter
+    if (k_isIndexedTxnQueue)
+        m_txnConverter->trackOpenRowChanges();
+
     //initialize per-channel transaction queues
-    if(!k_isReadFirstScheduling)
-        m_txnQ.resize(m_numChannels);
+    if(!k_isReadFirstScheduling) {
+        if (k_isIndexedTxnQueue)
+            m_txnIndex.resize(m_numChannels);
+        else
+            m_txnQ.resize(m_numChannels);
+    }
     else {
-        m_txnReadQ.resize(m_numChannels);
-        m_txnWriteQ.resize(m_numChannels);
+        if (k_isIndexedTxnQueue) {
+            m_txnReadIndex.resize(m_numChannels);
+            m_txnWriteIndex.resize(m_numChannels);
+            m_flushWriteIndex.resize(m_numChannels, false);
+        } else {
+            m_txnReadQ.resize(m_numChannels);
+            m_txnWriteQ.resize(m_numChannels);
+        }
 
         k_maxPendingWriteThreshold = (float) x_params.find<float>("maxPendingWriteThreshold", 1, l_found);
         if (!l_found) {
@@ -123,6 +156,10 @@ c_TxnScheduler::~c_TxnScheduler() {
 
 void c_TxnScheduler::run(SimTime_t simCycle){
 
+    if (k_isIndexedTxnQueue) {
+        runIndexed(simCycle);
+        return;
+    }
 
     for(int l_channelID=0; l_channelID<m_numChannels; l_channelID++) {
 
@@ -231,7 +268,22 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
 {
     int l_channelId=newTxn->getHashedAddress().getChannel();
     bool l_success=false;
-    if(!k_isReadFirstScheduling)
+    if (k_isIndexedTxnQueue)
+    {
+        c_TxnQueueIndex* l_index;
+        if (!k_isReadFirstScheduling)
+            l_index = &m_txnIndex.at(l_channelId);
+        else if (newTxn->isRead())
+            l_index = &m_txnReadIndex.at(l_channelId);
+        else
+            l_index = &m_txnWriteIndex.at(l_channelId);
+
+        if (l_index->size() < k_numTxnQEntries) {
+            l_index->push(newTxn);
+            l_success = true;
+        }
+    }
+    else if(!k_isReadFirstScheduling)
     {
         if (m_txnQ.at(l_channelId).size() < k_numTxnQEntries) {
             m_txnQ.at(l_channelId).push_back(newTxn);
@@ -262,6 +314,38 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
 
 
 //Check if read transactions get data from the transaction queue
+/*!
+ * @return "true" if no transaction is waiting in any transaction queue
+ */
+bool c_TxnScheduler::isEmpty()
+{
+    for (auto &l_queue : m_txnQ)
+        if (!l_queue.empty()) return false;
+    for (auto &l_queue : m_txnReadQ)
+        if (!l_queue.empty()) return false;
+    for (auto &l_queue : m_txnWriteQ)
+        if (!l_queue.empty()) return false;
+    for (auto &l_index : m_txnIndex)
+        if (!l_index.empty()) return false;
+    for (auto &l_index : m_txnReadIndex)
+        if (!l_index.empty()) return false;
+    for (auto &l_index : m_txnWriteIndex)
+        if (!l_index.empty()) return false;
+    return true;
+}
+
+
+/*!
+ * @return the next cycle at which run() changes state on empty queues: the BLISS blacklist clearing
+ */
+SimTime_t c_TxnScheduler::getNextWakeCycle()
+{
+    if (k_isIndexedTxnQueue && k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS)
+        return m_nextBlacklistClearing;
+    return std::numeric_limits<SimTime_t>::max();
+}
+
+
 bool c_TxnScheduler::isHit(c_Transaction* x_txn)
 {
     int l_channelId=x_txn->getHashedAddress().getChannel();
@@ -269,7 +353,14 @@ bool c_TxnScheduler::isHit(c_Transaction* x_txn)
     bool l_isRead = x_txn->isRead();
     bool l_isHit = false;
 
-    if(l_isRead)
+    if(l_isRead && k_isIndexedTxnQueue)
+    {
+        if(!k_isReadFirstScheduling)
+            l_isHit = m_txnIndex.at(l_channelId).hasWrite(x_txn->getAddress());
+        else
+            l_isHit = m_txnWriteIndex.at(l_channelId).hasWrite(x_txn->getAddress());
+    }
+    else if(l_isRead)
     {
         if(!k_isReadFirstScheduling) {
             l_queue = &m_txnQ.at(l_channelId);
@@ -321,3 +412,172 @@ bool c_TxnScheduler::hasDependancy(c_Transaction *x_txn, int x_ch)
 }
 
 
+
+
+/*!
+ * Same flow as run(), on the indexed queues. The write drain state is kept per channel.
+ */
+void c_TxnScheduler::runIndexed(SimTime_t x_simCycle)
+{
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS && x_simCycle >= m_nextBlacklistClearing) {
+        m_blacklistedBanks.clear();
+        m_nextBlacklistClearing = x_simCycle + k_blissClearingInterval;
+    }
+
+    //open rows changed by the transactions converted since the last cycle
+    for (unsigned l_bankId : m_txnConverter->getOpenRowChanges()) {
+        c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(l_bankId);
+        for (auto &l_index : m_txnIndex)
+            l_index.setOpenRow(l_bankId, l_bankInfo->isRowOpen(), l_bankInfo->getOpenRowNum());
+        for (auto &l_index : m_txnReadIndex)
+            l_index.setOpenRow(l_bankId, l_bankInfo->isRowOpen(), l_bankInfo->getOpenRowNum());
+        for (auto &l_index : m_txnWriteIndex)
+            l_index.setOpenRow(l_bankId, l_bankInfo->isRowOpen(), l_bankInfo->getOpenRowNum());
+    }
+    m_txnConverter->clearOpenRowChanges();
+
+    for(int l_channelID=0; l_channelID<m_numChannels; l_channelID++) {
+
+        //0. select queue
+        c_TxnQueueIndex* l_index = nullptr;
+        c_TxnQueueIndex* l_otherIndex = nullptr;
+        if(!k_isReadFirstScheduling) {
+            l_index = &(m_txnIndex[l_channelID]);
+        } else {
+            c_TxnQueueIndex &l_readIndex = m_txnReadIndex[l_channelID];
+            c_TxnQueueIndex &l_writeIndex = m_txnWriteIndex[l_channelID];
+
+            if (l_writeIndex.size() >= m_maxNumPendingWrite || l_readIndex.empty())
+                m_flushWriteIndex[l_channelID] = true;
+            else if (l_writeIndex.size() < m_minNumPendingWrite && !l_readIndex.empty())
+                m_flushWriteIndex[l_channelID] = false;
+
+            if (m_flushWriteIndex[l_channelID]) {
+                l_index = &l_writeIndex;
+                l_otherIndex = &l_readIndex;
+            } else {
+                l_index = &l_readIndex;
+                l_otherIndex = &l_writeIndex;
+            }
+        }
+
+        //1. select a transaction, switching queues with read-first scheduling if nothing is issuable
+        c_Transaction* l_nextTxn = nullptr;
+        if (!l_index->empty())
+            l_nextTxn = getNextIndexedTxn(*l_index, l_channelID);
+        if (l_nextTxn == nullptr && l_otherIndex != nullptr) {
+            l_index = l_otherIndex;
+            if (!l_index->empty())
+                l_nextTxn = getNextIndexedTxn(*l_index, l_channelID);
+        }
+
+        //2. send the selected transaction to transaction converter
+        if (l_nextTxn != nullptr) {
+            m_txnConverter->push(l_nextTxn);
+
+            #ifdef __SST_DEBUG_OUTPUT__
+            l_nextTxn->print(output, "[c_TxnScheduler]",x_simCycle);
+            #endif
+
+            if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS)
+                updateBlacklist(l_nextTxn, l_channelID);
+
+            l_index->remove(l_nextTxn);
+        }
+    }
+}
+
+
+/*!
+ * FCFS takes the oldest transaction if it is issuable.
+ * FRFCFS takes the oldest issuable row hit, otherwise the oldest issuable transaction.
+ * BLISS does the same as FRFCFS but first among the transactions to banks that are not blacklisted.
+ */
+c_Transaction* c_TxnScheduler::getNextIndexedTxn(c_TxnQueueIndex& x_index, int x_ch)
+{
+    assert(!x_index.empty());
+
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::FCFS) {
+        c_Transaction* l_oldest = x_index.getAgeOrder().front();
+        return isIssuable(l_oldest, x_ch) ? l_oldest : nullptr;
+    }
+
+    bool l_useBlacklist = (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) && !m_blacklistedBanks.empty();
+
+    //1. row hits: only the banks whose open row has pending transactions are visited
+    c_Transaction* l_rowHit = nullptr;
+    c_Transaction* l_blacklistedRowHit = nullptr;
+    for (auto &l_bankHits : x_index.getRowHits()) {
+        bool l_isBlacklisted = l_useBlacklist && m_blacklistedBanks.count(l_bankHits.first);
+        c_Transaction* &l_best = l_isBlacklisted ? l_blacklistedRowHit : l_rowHit;
+        for (auto &l_txn : *(l_bankHits.second)) {
+            if (l_best != nullptr && l_best->getSeqNum() < l_txn->getSeqNum())
+                break;
+            if (isIssuable(l_txn, x_ch)) {
+                l_best = l_txn;
+                break;
+            }
+        }
+    }
+    if (l_rowHit != nullptr)
+        return l_rowHit;
+
+    //2. oldest issuable transaction, preferring the banks that are not blacklisted
+    c_Transaction* l_blacklistedOldest = nullptr;
+    for (auto &l_txn : x_index.getAgeOrder()) {
+        bool l_isBlacklisted = l_useBlacklist && m_blacklistedBanks.count(l_txn->getHashedAddress().getBankId());
+        if (l_isBlacklisted && (l_blacklistedOldest != nullptr || l_blacklistedRowHit != nullptr))
+            continue;
+        if (!isIssuable(l_txn, x_ch))
+            continue;
+
+        if (!l_isBlacklisted)
+            return l_txn;
+        l_blacklistedOldest = l_txn;
+    }
+
+    return (l_blacklistedRowHit != nullptr) ? l_blacklistedRowHit : l_blacklistedOldest;
+}
+
+
+bool c_TxnScheduler::isIssuable(c_Transaction* x_txn, int x_ch)
+{
+    return (m_cmdScheduler->getToken(x_txn->getHashedAddress()) >= 3)
+           && !hasIndexedDependancy(x_txn, x_ch);
+}
+
+
+bool c_TxnScheduler::hasIndexedDependancy(c_Transaction* x_txn, int x_ch)
+{
+    c_TxnQueueIndex* l_index = nullptr;
+
+    if (!k_isReadFirstScheduling)
+        l_index = &m_txnIndex[x_ch];
+    else if (x_txn->isRead())
+        l_index = &m_txnWriteIndex[x_ch];
+    else
+        l_index = &m_txnReadIndex[x_ch];
+
+    return l_index->hasOlderTxn(x_txn->getAddress(), x_txn->getSeqNum());
+}
+
+
+/*!
+ * Transactions carry no requester id, so BLISS tracks banks instead of applications:
+ * a bank served more than blissBlacklistThreshold times in a row on its channel is
+ * blacklisted until the next clearing.
+ */
+void c_TxnScheduler::updateBlacklist(c_Transaction* x_txn, int x_ch)
+{
+    int l_bankId = x_txn->getHashedAddress().getBankId();
+
+    if (m_lastServedBank[x_ch] == l_bankId) {
+        m_numServedInARow[x_ch]++;
+    } else {
+        m_lastServedBank[x_ch] = l_bankId;
+        m_numServedInARow[x_ch] = 1;
+    }
+
+    if (m_numServedInARow[x_ch] > k_blissBlacklistThreshold)
+        m_blacklistedBanks.insert(l_bankId);
+}
@@ -31,7 +31,10 @@
 #ifndef C_TXNSCHEDULER_HPP
 #define C_TXNSCHEDULER_HPP
 
+#include <set>
+
 #include "c_Transaction.hpp"
+#include "c_TxnQueueIndex.hpp"
 #include "c_TxnConverter.hpp"
 #include "c_Controller.hpp"
 
@@ -42,7 +45,7 @@ namespace SST {
         class c_TxnConverter;
         class c_Controller;
 
-        enum class e_txnSchedulingPolicy {FCFS, FRFCFS};
+        enum class e_txnSchedulingPolicy {FCFS, FRFCFS, BLISS};
         typedef std::list<c_Transaction*> TxnQueue;
 
         class c_TxnScheduler: public SubComponent{
@@ -60,11 +63,14 @@ namespace SST {
             )
 
             SST_ELI_DOCUMENT_PARAMS(
-                {"txnSchedulingPolicy", "Transaction scheduling policy", "FCFS"},
+                {"txnSchedulingPolicy", "Transaction scheduling policy: FCFS, FRFCFS or BLISS. BLISS always uses the indexed queue", "FCFS"},
                 {"numTxnQEntries", "The number of transaction queue entries", "32"},
-                {"boolReadFirstTxnScheduling", "", "0"},
-                {"maxPendingWriteThreshold", "", "1.0"},
-                {"minPendingWriteThreshold", "", "0.2"},
+                {"boolReadFirstTxnScheduling", "Keep reads and writes in separate queues and serve reads first until the writes reach the drain watermark", "0"},
+                {"maxPendingWriteThreshold", "Read-first scheduling: start draining writes when the write queue holds this fraction of numTxnQEntries", "1.0"},
+                {"minPendingWriteThreshold", "Read-first scheduling: stop draining writes when the write queue falls below this fraction of numTxnQEntries", "0.2"},
+                {"boolIndexedTxnQueue", "Index pending transactions by arrival, (bank, row) and address so that row hits and dependencies are found without scanning the queue. FRFCFS then picks the oldest row hit, otherwise the oldest issuable transaction", "0"},
+                {"blissBlacklistThreshold", "BLISS: a bank served more than this many times in a row is blacklisted", "4"},
+                {"blissClearingInterval", "BLISS: number of cycles between clearings of the blacklist", "10000"},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -80,6 +86,8 @@ namespace SST {
             virtual void run(SimTime_t simCycle);
             virtual bool push(c_Transaction* newTxn);
             virtual bool isHit(c_Transaction* newTxn);
+            virtual bool isEmpty();
+            virtual SimTime_t getNextWakeCycle();
 
 
         private:
@@ -87,6 +95,13 @@ namespace SST {
             virtual bool hasDependancy(c_Transaction* x_txn, int x_ch);
             virtual void popTxn(TxnQueue& x_queue, c_Transaction* x_txn);
 
+            //** indexed transaction queues
+            void runIndexed(SimTime_t x_simCycle);
+            c_Transaction* getNextIndexedTxn(c_TxnQueueIndex& x_index, int x_ch);
+            bool hasIndexedDependancy(c_Transaction* x_txn, int x_ch);
+            bool isIssuable(c_Transaction* x_txn, int x_ch);
+            void updateBlacklist(c_Transaction* x_txn, int x_ch);
+
             //**transaction converter
             c_TxnConverter* m_txnConverter;
             //**command Scheduler
@@ -97,6 +112,18 @@ namespace SST {
             //**per-channel tranaction queues for read-first scheduling
             std::vector<TxnQueue> m_txnReadQ;  // read queue for read-first scheduling
             std::vector<TxnQueue> m_txnWriteQ; // write queue for read-first scheduling
+            //**per-channel indexed transaction queues, used instead of the lists above with boolIndexedTxnQueue
+            std::vector<c_TxnQueueIndex> m_txnIndex;
+            std::vector<c_TxnQueueIndex> m_txnReadIndex;
+            std::vector<c_TxnQueueIndex> m_txnWriteIndex;
+            std::vector<bool> m_flushWriteIndex;    // per-channel write drain state
+
+            //**BLISS blacklisting state
+            std::set<unsigned> m_blacklistedBanks;
+            std::vector<int> m_lastServedBank;       // per channel, -1 before the first transaction
+            std::vector<unsigned> m_numServedInARow; // per channel
+            SimTime_t m_nextBlacklistClearing;
+
             unsigned m_maxNumPendingWrite;
             unsigned m_minNumPendingWrite;
 
@@ -111,6 +138,9 @@ namespace SST {
             float k_maxPendingWriteThreshold;
             float k_minPendingWriteThreshold;
             bool k_isReadFirstScheduling;
+            bool k_isIndexedTxnQueue;
+            unsigned k_blissBlacklistThreshold;
+            SimTime_t k_blissClearingInterval;
 
         };
     }
@@ -4,7 +4,9 @@ from sst_unittest import *
 from sst_unittest_support import *
 
 import os
+import sys
 import shutil
+import subprocess
 
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
@@ -80,9 +82,66 @@ class testcase_CramSim_Component(SSTTestCase):
     def test_CramSim_6_W(self):
         self.CramSim_test_template("6_W")
 
+    # Event-driven bank clocking must match the reference of the cycle-by-cycle run
+    def test_CramSim_1_RW_EventDrivenBanks(self):
+        self.CramSim_test_template("1_RW", "boolEventDrivenBanks=1")
+
+    def test_CramSim_4_R_EventDrivenBanks(self):
+        self.CramSim_test_template("4_R", "boolEventDrivenBanks=1")
+
+    # Turning the controller clock off while idle must match the reference as well
+    def test_CramSim_1_RW_SkipIdleCycles(self):
+        self.CramSim_test_template("1_RW", "boolEventDrivenBanks=1 boolSkipIdleCycles=1")
+
+    def test_CramSim_4_R_SkipIdleCycles(self):
+        self.CramSim_test_template("4_R", "boolEventDrivenBanks=1 boolSkipIdleCycles=1")
+
+    # The indexed queue must schedule FCFS exactly as the list queue does
+    def test_CramSim_1_RW_IndexedFCFS(self):
+        fcfs = self.CramSim_test_template("1_RW", "txnSchedulingPolicy=FCFS")
+        indexed = self.CramSim_test_template("1_RW", "txnSchedulingPolicy=FCFS boolIndexedTxnQueue=1")
+        self._assert_same_output(fcfs, indexed)
+
+    # With open pages FR-FCFS serves row hits ahead of older transactions, so
+    # the same transactions must complete on a different schedule than FCFS
+    def test_CramSim_1_RW_IndexedFRFCFS(self):
+        fcfs = self.CramSim_test_template("1_RW", "bankPolicy=OPEN txnSchedulingPolicy=FCFS")
+        frfcfs = self.CramSim_test_template("1_RW", "bankPolicy=OPEN txnSchedulingPolicy=FRFCFS boolIndexedTxnQueue=1")
+        self._assert_same_txns(fcfs, frfcfs)
+        self.assertFalse(self._get_lines(fcfs, "Cycles Per Transaction") == self._get_lines(frfcfs, "Cycles Per Transaction"),
+                         "FRFCFS run {0} has the same schedule as FCFS run {1}".format(frfcfs, fcfs))
+
+    # BLISS without blacklisting is FR-FCFS; with it the same transactions must complete
+    def test_CramSim_1_RW_BLISS(self):
+        # Options in another order than in IndexedFRFCFS so the runs do not share an output file
+        frfcfs = self.CramSim_test_template("1_RW", "txnSchedulingPolicy=FRFCFS boolIndexedTxnQueue=1 bankPolicy=OPEN")
+        unlisted = self.CramSim_test_template("1_RW", "bankPolicy=OPEN txnSchedulingPolicy=BLISS blissBlacklistThreshold=1000000")
+        self._assert_same_output(frfcfs, unlisted)
+        bliss = self.CramSim_test_template("1_RW", "bankPolicy=OPEN txnSchedulingPolicy=BLISS")
+        self._assert_same_txns(frfcfs, bliss)
+
+    # Bank hashing moves transactions between banks, so these only check that the run completes
+    def test_CramSim_1_RW_BankHashPermutation(self):
+        self.CramSim_test_template("1_RW", "bankHashPolicy=permutation")
+
+    def test_CramSim_1_RW_BankHashXor(self):
+        self.CramSim_test_template("1_RW", "bankHashPolicy=xor bankXorMasks=0x200400,0x400800 bankGroupXorMasks=0x801000,0x1002000")
+
+    # A mask that uses bank or bankgroup bits cannot be unhashed and must be rejected
+    def test_CramSim_BankHashXor_RejectsBankBits(self):
+        self.CramSim_expect_fatal_template("1_RW", "bankHashPolicy=xor bankXorMasks=0x200400 bankGroupXorMasks=0x20",
+                                           "uses bank or bankgroup address bits")
+
+    # The trace is converted to the binary format, so the run must match the text trace run
+    # apart from the trace file parameters
+    def test_CramSim_1_RW_BinaryTrace(self):
+        textfile = self.CramSim_test_template("1_RW")
+        binaryfile = self.CramSim_test_template("1_RW", binaryTrace=True)
+        self._assert_same_output(textfile, binaryfile, "^Override|^Trace file|traceFile")
+
 #####
 
-    def CramSim_test_template(self, testcase):
+    def CramSim_test_template(self, testcase, overrides="", binaryTrace=False):
 
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -96,22 +155,35 @@ class testcase_CramSim_Component(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="test_CramSim_{0}".format(testcase)
+        testRunName = testDataFileName
+        if overrides != "":
+            testRunName = "{0}_{1}".format(testDataFileName, overrides.replace("=", "").replace(" ", "_"))
+        if binaryTrace:
+            testRunName = "{0}_BinaryTrace".format(testRunName)
 
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
-        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
-        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
-        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testRunName)
+        errfile = "{0}/{1}.err".format(outdir, testRunName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testRunName)
 
         testpyfilepath = "{0}/test_txntrace.py".format(self.testCramSimTestsDir)
         tracefile      = "{0}/sst-CramSim-trace_verimem_{1}.trc".format(self.testCramSimTestsDir, testcase)
         configfile     = "{0}/ddr4_verimem.cfg".format(self.testCramSimDir)
 
+        if binaryTrace:
+            converter = "{0}/traces/traceToBinary.py".format(self.CramSimElementDir)
+            binaryfile = "{0}/{1}.bin".format(tmpdir, testRunName)
+            cmd = '{0} {1} {2} {3}'.format(sys.executable, converter, tracefile, binaryfile)
+            self.assertTrue(os.system(cmd) == 0, "Failed to convert {0} to a binary trace".format(tracefile))
+            tracefile = binaryfile
+            overrides = "{0} traceFileType=BINARY".format(overrides)
+
         if os.path.isfile(testpyfilepath):
             sdlfile = testpyfilepath
-            otherargs = '--model-options=\"--configfile={0} traceFile={1}\"'.format(configfile, tracefile)
+            otherargs = '--model-options=\"--configfile={0} traceFile={1} {2}\"'.format(configfile, tracefile, overrides)
         else:
             sdlfile = "{0}/test_txntrace4.py".format(self.testCramSimTestsDir)
-            otherargs = '--model-options=\"--configfile={0} --traceFile={1}\"'.format(configfile, tracefile)
+            otherargs = '--model-options=\"--configfile={0} --traceFile={1} {2}\"'.format(configfile, tracefile, overrides)
 
         # Run SST
         self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
@@ -135,9 +207,42 @@ class testcase_CramSim_Component(SSTTestCase):
             self.assertTrue(grep_result, "Output file {0} does not contain a simulation complete message".format(outfile, reffile))
         else:
             self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
+        return outfile
+
+    def CramSim_expect_fatal_template(self, testcase, overrides, message):
+        test_path = self.get_testsuite_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+        testCramSimDir = "{0}/testCramSim".format(tmpdir)
+        testCramSimTestsDir = "{0}/tests".format(testCramSimDir)
+
+        sdlfile = "{0}/test_txntrace.py".format(testCramSimTestsDir)
+        tracefile = "{0}/sst-CramSim-trace_verimem_{1}.trc".format(testCramSimTestsDir, testcase)
+        configfile = "{0}/ddr4_verimem.cfg".format(testCramSimDir)
+
+        # The run must stop with a fatal error naming the bad parameter
+        cmd = ["sst", sdlfile, "--model-options=--configfile={0} traceFile={1} {2}".format(configfile, tracefile, overrides)]
+        proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, cwd=testCramSimTestsDir)
+        output = proc.communicate()[0].decode("utf-8", "replace")
+        self.assertNotEqual(proc.returncode, 0, "CramSim: sst did not fail with {0}".format(overrides))
+        self.assertTrue(message in output, "CramSim: expected '{0}' in output:\n{1}".format(message, output))
 
 #####
 
+    def _get_lines(self, outfile, prefix):
+        with open(outfile, 'r') as fp:
+            return [line.strip() for line in fp if line.startswith(prefix)]
+
+    def _assert_same_output(self, reffile, outfile, ignore="^Override"):
+        # The SDL echoes its overrides, so those lines may differ
+        cmd = "diff -b <(grep -v -E \"{2}\" {0}) <(grep -v -E \"{2}\" {1}) > /dev/null".format(reffile, outfile, ignore)
+        self.assertTrue(os.system("bash -c '{0}'".format(cmd)) == 0, "Output file {0} does not match {1}".format(outfile, reffile))
+
+    def _assert_same_txns(self, reffile, outfile):
+        for prefix in ["Read-Txns-Received", "Write-Txns-Received", "Total Txns Received"]:
+            ref = self._get_lines(reffile, prefix)
+            self.assertTrue(len(ref) == 1, "Output file {0} has no '{1}' line".format(reffile, prefix))
+            self.assertEqual(ref, self._get_lines(outfile, prefix), "Output file {0} does not match {1} in '{2}'".format(outfile, reffile, prefix))
+
     def _setupCramSimTestFiles(self):
         # NOTE: This routine is called a single time at module startup, so it
         #       may have some redunant
@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+#
+# Converts a CramSim text trace into the binary trace format read by
+# c_TraceFileReader with traceFileType=BINARY.
+#
+# Supported input formats (same as c_TraceFileReader):
+#   DEFAULT (DRAMSim2):  <address> <READ|WRITE|P_MEM_WR|...> <cycle>
+#   USIMM:               <delay> <R|W> <address> [<pc>]
+#
+# Binary layout, little endian:
+#   header:  char magic[8] = "CRAMTRC", uint32 version = 1, uint32 timing
+#            (0: absolute cycles, 1: delay from the cycle the record is read, for USIMM)
+#   records: uint64 address, uint32 cycle, uint32 flags (bit 0 set for a write)
+#
+# Usage: traceToBinary.py [--type DEFAULT|USIMM] <input trace> <output trace>
+
+from __future__ import print_function
+import argparse
+import struct
+import sys
+
+MAGIC = b"CRAMTRC\0"
+VERSION = 1
+TIMING = {"DEFAULT": 0, "DRAMSIM2": 0, "USIMM": 1}
+FLAG_WRITE = 0x1
+
+header = struct.Struct("<8sII")
+record = struct.Struct("<QII")
+
+def parseDefault(tokens):
+    address = int(tokens[0], 0)
+    isWrite = "WR" in tokens[1]
+    cycle = int(tokens[2])
+    return address, cycle, isWrite
+
+def parseUsimm(tokens):
+    cycle = int(tokens[0])
+    isWrite = "W" in tokens[1]
+    address = int(tokens[2], 0)
+    return address, cycle, isWrite
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a CramSim text trace to a binary trace")
+    parser.add_argument("--type", default="DEFAULT", choices=sorted(TIMING.keys()),
+                        help="input trace format (default: DEFAULT)")
+    parser.add_argument("input", help="text trace to read")
+    parser.add_argument("output", help="binary trace to write")
+    args = parser.parse_args()
+
+    parse = parseUsimm if args.type == "USIMM" else parseDefault
+
+    numRecords = 0
+    with open(args.input, "r") as inFile, open(args.output, "wb") as outFile:
+        outFile.write(header.pack(MAGIC, VERSION, TIMING[args.type]))
+
+        for lineNum, line in enumerate(inFile, 1):
+            tokens = line.split()
+            if not tokens:
+                continue
+            try:
+                address, cycle, isWrite = parse(tokens)
+            except (IndexError, ValueError):
+                sys.exit("%s:%d: cannot parse '%s'" % (args.input, lineNum, line.strip()))
+
+            if cycle > 0xffffffff or address > 0xffffffffffffffff:
+                sys.exit("%s:%d: value out of range for the binary format" % (args.input, lineNum))
+
+            outFile.write(record.pack(address, cycle, FLAG_WRITE if isWrite else 0))
+            numRecords += 1
+
+    print("Wrote %d records to %s" % (numRecords, args.output))
+
+if __name__ == "__main__":
+    main()
@@ -149,6 +149,18 @@ void Messier::parser(NVM_PARAMS * nvm, SST::Params& params)
 
 	nvm->lock_period = (uint32_t) params.find<uint32_t>("lock_period", 10000) ;
 
+	std::string scheduler = params.find<std::string>("scheduler", "fifo");
+
+	if(scheduler == "fifo")
+		nvm->bank_queues = false;
+	else if(scheduler == "bank")
+		nvm->bank_queues = true;
+	else
+	{
+		Output out("", 1, 0, Output::STDOUT);
+		out.fatal(CALL_INFO, -1, "Messier: unknown scheduler '%s', expected 'fifo' or 'bank'\n", scheduler.c_str());
+	}
+
 }
 
 // Here we do the initialization of the Samba units of the system, connecting them to the cores and instantiating TLB hierachy objects for each one
@@ -194,7 +206,15 @@ Messier::Messier(SST::ComponentId_t id, SST::Params& params): Component(id) {
         event_link->setDefaultTimeBase(tc);
 
 
-	registerClock( cpu_clock, new Clock::Handler<Messier>(this, &Messier::tick ) );
+	clock_handler = new Clock::Handler<Messier>(this, &Messier::tick );
+	clock_tc = registerClock( cpu_clock, clock_handler );
+
+	unclock_idle = params.find<bool>("unclock_idle", false);
+	clock_off = false;
+	last_tick = 0;
+
+	if(unclock_idle)
+		DIMM->setWakeHandler(std::bind(&Messier::wake, this));
 
 }
 
@@ -213,7 +233,31 @@ bool Messier::tick(SST::Cycle_t x)
 
 	// We tick the MMU hierarchy of each core
 //	for(uint32_t i = 0; i < core_count; ++i)
-	DIMM->tick();
+	bool idle = DIMM->tick();
+
+	if(unclock_idle && idle)
+	{
+		// Nothing is queued, executing or in flight, so stop ticking until the next request arrives
+		last_tick = getCurrentSimTime(clock_tc);
+		clock_off = true;
+		return true;
+	}
 
 	return false;
 }
+
+
+void Messier::wake()
+{
+
+	if(!clock_off)
+		return;
+
+	clock_off = false;
+
+	// The clock fires before events at the same time, so the ticks up to and including the current cycle were skipped
+	DIMM->skipCycles(getCurrentSimTime(clock_tc) - last_tick);
+
+	reregisterClock(clock_tc, clock_handler);
+
+}
@@ -98,7 +98,9 @@ namespace SST {
                     {"write_cancel", "This indicates that the write cancellation optimization: 0 means not enabled", "0"},
                     {"write_cancel_th", "This indicates that the write cancellation threshold: 0 means dynamic", "0"},
                     {"group_size", "This indicates the number of banks in each group, to be locked when draining", "0"},
-                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"}
+                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"},
+                    {"scheduler", "Read scheduling: fifo scans all queued requests in arrival order, bank keeps a queue per bank and prefers row buffer hits", "fifo"},
+                    {"unclock_idle", "Stop the controller clock while no request is queued, executing or in flight (1) or keep it running (0)", "0"}
                 )
 
                 SST_ELI_DOCUMENT_STATISTICS(
@@ -118,6 +120,9 @@ namespace SST {
 				void handleEvent(SST::Event* event) {};
 				bool tick(SST::Cycle_t x);
 
+				// Turns the clock back on when a request arrives while the DIMM is idle
+				void wake();
+
 				void parser(NVM_PARAMS * nvm, SST::Params& params);
 
 
@@ -135,6 +140,15 @@ namespace SST {
 				NVM_PARAMS * nvm_params;
 				NVM_DIMM * DIMM;
 
+				TimeConverter * clock_tc;
+				Clock::Handler<Messier> * clock_handler;
+
+				bool unclock_idle;
+				bool clock_off;
+
+				// The controller cycle of the last tick before the clock was turned off
+				SimTime_t last_tick;
+
 
 				long long int max_inst;
 				char* named_pipe;
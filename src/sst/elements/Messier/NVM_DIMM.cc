@@ -95,6 +95,13 @@ NVM_DIMM::NVM_DIMM(ComponentId_t id, NVM_PARAMS par) : ComponentExtension(id)
 	curr_reads = 0;
 	curr_writes = 0;
 
+	bank_queues.resize(params->num_ranks * params->num_banks);
+	queued_banks.resize((bank_queues.size() + 63) / 64, 0);
+	queued_reads = 0;
+	next_seq = 0;
+
+	inflight_events = 0;
+
 	gs = params->group_size;
 	lg = group_locked;
 
@@ -132,7 +139,7 @@ bool NVM_DIMM::tick()
 
 
 	if(!enabled)
-		return false;
+		return true;
 
 
 	// Incrementing the cycles count
@@ -179,7 +186,7 @@ bool NVM_DIMM::tick()
 			else
 			{
 				// Checking if there is any pending requests
-				if(!transactions.empty())
+				if(requests_pending())
 				{
 
 					// Try to submit a request to a free bank and rank
@@ -203,7 +210,7 @@ bool NVM_DIMM::tick()
 	else
 	{
 
-		if(!transactions.empty())
+		if(requests_pending())
 		{
 			submit_request_opt();
 		}
@@ -216,12 +223,77 @@ bool NVM_DIMM::tick()
 
 
 
-	return false;
+	return idle();
 
 
 }
 
 
+bool NVM_DIMM::idle()
+{
+
+	// Pending entries in READS_COMPLETE and WRITES_COMPLETE do not keep the DIMM busy, skipCycles retires them
+	return !requests_pending() && outstanding.empty() && ready_at_NVM.empty() && WB->empty() && (inflight_events == 0);
+
+}
+
+
+void NVM_DIMM::skipCycles(long long int skipped)
+{
+
+	if(!enabled || skipped <= 0)
+		return;
+
+	cycles += skipped;
+
+	// With modulo scheduling an empty write buffer counts a read slot on every tick
+	if(params->modulo)
+		read_count += skipped;
+
+	while(!READS_COMPLETE.empty() && READS_COMPLETE.begin()->first <= cycles)
+	{
+		curr_reads = curr_reads - READS_COMPLETE.begin()->second;
+		READS_COMPLETE.erase(READS_COMPLETE.begin());
+	}
+
+	while(!WRITES_COMPLETE.empty() && WRITES_COMPLETE.begin()->first <= cycles)
+	{
+		curr_writes = curr_writes - WRITES_COMPLETE.begin()->second;
+		WRITES_COMPLETE.erase(WRITES_COMPLETE.begin());
+	}
+
+}
+
+
+bool NVM_DIMM::push_request(NVM_Request * req)
+{
+
+	req->seq = next_seq++;
+
+	if(req->Read)
+		TIME_STAMP[req]= cycles;
+
+	if(!params->bank_queues)
+	{
+		transactions.push_back(req);
+		return true;
+	}
+
+	if(req->Read)
+	{
+		int b = WhichRank(req->Address) * params->num_banks + WhichBank(req->Address);
+		bank_queues[b].push_back(req);
+		queued_banks[b / 64] |= ((uint64_t) 1) << (b % 64);
+		queued_reads++;
+	}
+	else
+		pending_writes.push_back(req);
+
+	return true;
+
+}
+
+
 void NVM_DIMM::schedule_delivery()
 {
 
@@ -256,7 +328,7 @@ void NVM_DIMM::schedule_delivery()
 				(getBank(add))->set_last(true);
 				ready_trans[st_1->first] = cycles + params->tCMD + params->tCL + params->tBURST;
 				(st_1->first)->meta_data = EventType::READ_COMPLETION;
-                                m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(st_1->first, EventType::READ_COMPLETION));
+                                send_event(params->tCMD + params->tCL + params->tBURST, new MessierEvent(st_1->first, EventType::READ_COMPLETION));
 				ready_at_NVM.erase(st_1);
 				break;
 			}
@@ -295,14 +367,14 @@ bool NVM_DIMM::try_flush_wb()
 //	bool pull_idle = false;
 	int MAX_WRITES = params->max_writes;
 
-	if(WB->flush() || (transactions.empty() && !WB->empty()) || (params->modulo && !WB->empty()))
+	if(WB->flush() || (!requests_pending() && !WB->empty()) || (params->modulo && !WB->empty()))
 		flush_write = true;
 
 	if(flush_write)
 	{
 
 
-		std::list<NVM_Request *> writes_list = WB->getList();
+		std::list<NVM_Request *> & writes_list = WB->getList();
 
 		std::list<NVM_Request *>::iterator st_wl, en_wl;
 
@@ -463,7 +535,7 @@ bool NVM_DIMM::pop_optimal()
 
 				corresp_bank->setLocked(true, cycles);
 				temp->meta_data = EventType::DEVICE_READY;
-				m_EventChan->send(time_ready-cycles, new MessierEvent(temp, EventType::DEVICE_READY));
+				send_event(time_ready-cycles, new MessierEvent(temp, EventType::DEVICE_READY));
 				return true;
 			}
 
@@ -480,6 +552,9 @@ long long int last_write=0;
 
 bool NVM_DIMM::submit_request_opt()
 {
+	if(params->bank_queues)
+		return submit_request_bank();
+
 	NVM_Request * temp; // = transactions.front();
 	bool removed = false;
 	bool found = pop_optimal();
@@ -507,10 +582,8 @@ bool NVM_DIMM::submit_request_opt()
 
 			if(SQUASHED.find(temp->req_ID)!=SQUASHED.end())
 			{
-				SQUASHED.erase(temp->req_ID);
 				transactions.erase(st);
-				delete NVM_EVENT_MAP[temp->req_ID];
-				delete temp;
+				drop_squashed(temp);
 				break;
 			}
 
@@ -519,36 +592,8 @@ bool NVM_DIMM::submit_request_opt()
 			{
 				if(!WB->full())
 				{
-
-					last_write = cycles;
-
-					NVM_Request * write_req = new NVM_Request();
-					write_req->req_ID = 0;
-					write_req->Read = false;
-					write_req->Address = temp->Address;
-
-
-					WB->insert_write_request(write_req);
 					transactions.erase(st);
-
-					MemRespEvent *respEvent = new MemRespEvent(
-							NVM_EVENT_MAP[temp->req_ID]->getReqId(), NVM_EVENT_MAP[temp->req_ID]->getAddr(), NVM_EVENT_MAP[temp->req_ID]->getFlags() );
-
-					m_memChan->send(respEvent);
-					bank_hist[WhichBank(temp->Address)]--;
-
-					if(cache!=NULL)
-						if(!cache->check_hit(temp->Address))
-						{
-							cache->insert_block(temp->Address, true);
-							cache->update_lru(temp->Address);
-						}
-
-
-					delete NVM_EVENT_MAP[temp->req_ID];
-
-					NVM_EVENT_MAP.erase(temp->req_ID);
-					delete temp;
+					post_write(temp);
 					removed = true;
 					break;
 				}
@@ -572,70 +617,257 @@ bool NVM_DIMM::submit_request_opt()
 					BANK * corresp_bank = getBank(temp->Address);
 
 					// Check if the rank is not busy
-					if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding.size() < params->max_outstanding))
+					if (can_issue_read(temp, corresp_rank, corresp_bank))
 					{
+						if(issue_read(temp, corresp_rank, corresp_bank))
+						{
+							transactions.erase(st);
+							removed=true;
+							break;
+						}
+					}
+				}
+			}
+			st++;
+		}
 
+	}
 
-						// If this comes here due to write cancellation: do the right business
-						if(params->write_cancel &&  (corresp_bank->getBusyUntil() >= cycles) && !corresp_bank->read() && !WB->flush() && (corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))
-						{
-						// Write cancellation business
-						corresp_bank->setLocked(false, cycles);
-						// Put the request back in the write buffer
-						NVM_Request * evicted = new NVM_Request();
-                                                evicted->req_ID = 0;
-                                                evicted->Read = false;
-                                                evicted->Address = corresp_bank->get_last_address();;
 
-                                                WB->insert_write_request(evicted);
+	return removed;
+}
+
 
-						}
+void NVM_DIMM::drop_squashed(NVM_Request * temp)
+{
 
+	SQUASHED.erase(temp->req_ID);
+	delete NVM_EVENT_MAP[temp->req_ID];
+	delete temp;
 
-						long long int time_ready;
-						// Check if row buffer hit
-						bool issued=false;
-						if ( row_buffer_hit(temp->Address, corresp_bank->getRB()))
-						{
-							time_ready = cycles + 1;
-							issued = true;
-						}
-						else if((params->write_weight*curr_writes + params->read_weight*curr_reads) <= (params->max_current_weight - params->read_weight))
-						{
+}
 
 
-							// Allocate the Rank circuitary to submit the command
-							corresp_rank->setBusyUntil(cycles + params->tCMD);
-							// Set the bank busy until we read it
-							corresp_bank->setBusyUntil(cycles + params->tCMD + params->tRCD);
-							corresp_bank->set_last(true);
-							time_ready = cycles + params->tRCD + params->tCMD;
-							curr_reads++;
-							READS_COMPLETE[cycles + params->tRCD + params->tCMD]++;
-							corresp_bank->setRB(temp->Address/params->row_buffer_size);
-							issued = true;
-						}
-						if(issued)
-						{
-							outstanding.push_back(temp);
-							transactions.erase(st);
-							removed=true;
-							// Lock the bank so no other request comes in and try to activate another row while waiting for the activation
-							corresp_bank->setLocked(true, cycles);
-							temp->meta_data = EventType::DEVICE_READY;
-							m_EventChan->send(time_ready-cycles, new MessierEvent(temp, EventType::DEVICE_READY));
-							break;
-						}
+void NVM_DIMM::post_write(NVM_Request * temp)
+{
+
+	last_write = cycles;
+
+	NVM_Request * write_req = new NVM_Request();
+	write_req->req_ID = 0;
+	write_req->Read = false;
+	write_req->Address = temp->Address;
+
+
+	WB->insert_write_request(write_req);
+
+	MemRespEvent *respEvent = new MemRespEvent(
+			NVM_EVENT_MAP[temp->req_ID]->getReqId(), NVM_EVENT_MAP[temp->req_ID]->getAddr(), NVM_EVENT_MAP[temp->req_ID]->getFlags() );
+
+	m_memChan->send(respEvent);
+	bank_hist[WhichBank(temp->Address)]--;
+
+	if(cache!=NULL)
+		if(!cache->check_hit(temp->Address))
+		{
+			cache->insert_block(temp->Address, true);
+			cache->update_lru(temp->Address);
+		}
+
+
+	delete NVM_EVENT_MAP[temp->req_ID];
+
+	NVM_EVENT_MAP.erase(temp->req_ID);
+	delete temp;
+
+}
+
+
+bool NVM_DIMM::can_issue_read(NVM_Request * temp, RANK * corresp_rank, BANK * corresp_bank)
+{
+
+	return (!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding.size() < params->max_outstanding);
+
+}
+
+
+bool NVM_DIMM::issue_read(NVM_Request * temp, RANK * corresp_rank, BANK * corresp_bank)
+{
+
+	// If this comes here due to write cancellation: do the right business
+	if(params->write_cancel &&  (corresp_bank->getBusyUntil() >= cycles) && !corresp_bank->read() && !WB->flush() && (corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))
+	{
+		// Write cancellation business
+		corresp_bank->setLocked(false, cycles);
+		// Put the request back in the write buffer
+		NVM_Request * evicted = new NVM_Request();
+		evicted->req_ID = 0;
+		evicted->Read = false;
+		evicted->Address = corresp_bank->get_last_address();;
+
+		WB->insert_write_request(evicted);
+
+	}
+
+
+	long long int time_ready;
+	// Check if row buffer hit
+	bool issued=false;
+	if ( row_buffer_hit(temp->Address, corresp_bank->getRB()))
+	{
+		time_ready = cycles + 1;
+		issued = true;
+	}
+	else if((params->write_weight*curr_writes + params->read_weight*curr_reads) <= (params->max_current_weight - params->read_weight))
+	{
+
+
+		// Allocate the Rank circuitary to submit the command
+		corresp_rank->setBusyUntil(cycles + params->tCMD);
+		// Set the bank busy until we read it
+		corresp_bank->setBusyUntil(cycles + params->tCMD + params->tRCD);
+		corresp_bank->set_last(true);
+		time_ready = cycles + params->tRCD + params->tCMD;
+		curr_reads++;
+		READS_COMPLETE[cycles + params->tRCD + params->tCMD]++;
+		corresp_bank->setRB(temp->Address/params->row_buffer_size);
+		issued = true;
+	}
+	if(issued)
+	{
+		outstanding.push_back(temp);
+		// Lock the bank so no other request comes in and try to activate another row while waiting for the activation
+		corresp_bank->setLocked(true, cycles);
+		temp->meta_data = EventType::DEVICE_READY;
+		send_event(time_ready-cycles, new MessierEvent(temp, EventType::DEVICE_READY));
+	}
+
+	return issued;
+
+}
+
+
+void NVM_DIMM::dequeue_read(int b, size_t pos)
+{
+
+	std::deque<NVM_Request *> & queue = bank_queues[b];
+	queue.erase(queue.begin() + pos);
+	queued_reads--;
+
+	if(queue.empty())
+		queued_banks[b / 64] &= ~(((uint64_t) 1) << (b % 64));
+
+}
+
+
+// Writes are acknowledged once they are in the write buffer, so they go there first while it has room. Among
+// the banks that can take a read, the oldest read that hits the open row goes first, otherwise the oldest
+// read that needs an activation. Only banks with queued reads are visited, and within a bank only its own queue.
+bool NVM_DIMM::submit_request_bank()
+{
+
+	if(!pending_writes.empty() && !WB->full())
+	{
+		NVM_Request * temp = pending_writes.front();
+		pending_writes.pop_front();
+		post_write(temp);
+		return true;
+	}
+
+	NVM_Request * hit = NULL;
+	int hit_bank = 0;
+	size_t hit_pos = 0;
+
+	NVM_Request * miss = NULL;
+	int miss_bank = 0;
+	size_t miss_pos = 0;
+
+	for(size_t w = 0; w < queued_banks.size(); w++)
+	{
+		uint64_t bits = queued_banks[w];
+
+		while(bits != 0)
+		{
+			int b = w * 64 + __builtin_ctzll(bits);
+			bits &= bits - 1;
+
+			std::deque<NVM_Request *> & queue = bank_queues[b];
+			NVM_Request * head = queue.front();
+
+			// Reads answered by the internal cache or the write buffer leave without using the bank
+			if(SQUASHED.find(head->req_ID)!=SQUASHED.end())
+			{
+				dequeue_read(b, 0);
+				drop_squashed(head);
+				return false;
+			}
+
+			if(HOLD.find(head->req_ID)==HOLD.end() && WB->find_entry(head->Address)!=NULL)
+			{
+				dequeue_read(b, 0);
+				find_in_wb(head);
+				return true;
+			}
+
+			RANK * corresp_rank = ranks[b / params->num_banks];
+			BANK * corresp_bank = corresp_rank->getBank(b % params->num_banks);
+
+			bool ready = false;
+
+			for(size_t i = 0; i < queue.size(); i++)
+			{
+				NVM_Request * temp = queue[i];
+
+				if(SQUASHED.find(temp->req_ID)!=SQUASHED.end() || HOLD.find(temp->req_ID)!=HOLD.end())
+					continue;
+
+				if(!ready)
+				{
+					// Apart from HOLD the check only depends on the bank, so the first request answers it for the whole queue
+					if(!can_issue_read(temp, corresp_rank, corresp_bank))
+						break;
+
+					ready = true;
+
+					if(miss == NULL || temp->seq < miss->seq)
+					{
+						miss = temp;
+						miss_bank = b;
+						miss_pos = i;
 					}
 				}
+
+				if(row_buffer_hit(temp->Address, corresp_bank->getRB()))
+				{
+					if(hit == NULL || temp->seq < hit->seq)
+					{
+						hit = temp;
+						hit_bank = b;
+						hit_pos = i;
+					}
+					break;
+				}
 			}
-			st++;
 		}
+	}
+
+	if(hit != NULL)
+	{
+		if(!issue_read(hit, ranks[hit_bank / params->num_banks], ranks[hit_bank / params->num_banks]->getBank(hit_bank % params->num_banks)))
+			return false;
+
+		dequeue_read(hit_bank, hit_pos);
+		return true;
+	}
 
+	if(miss != NULL && issue_read(miss, ranks[miss_bank / params->num_banks], ranks[miss_bank / params->num_banks]->getBank(miss_bank % params->num_banks)))
+	{
+		dequeue_read(miss_bank, miss_pos);
+		return true;
 	}
 
+	return false;
 
-	return removed;
 }
 
 
@@ -667,6 +899,8 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 
 
 
+	inflight_events--;
+
 	MessierEvent * temp_ptr =  dynamic_cast<MessierComponent::MessierEvent*> (e);
 
 	if(temp_ptr==NULL)
@@ -856,7 +1090,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 					}
 					else
 					{
-						m_EventChan->send(50, e); // Try after 50 cycles, to see if we got room in the write buffer to evict the dirty block
+						send_event(50, e); // Try after 50 cycles, to see if we got room in the write buffer to evict the dirty block
 						return; //
 					}
 				}
@@ -918,6 +1152,9 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 void NVM_DIMM::handleRequest(SST::Event* e)
 {
 
+	if(wake_handler)
+		wake_handler();
+
 	enabled = true;
 
 
@@ -976,7 +1213,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
 			tmp2->meta_data = params->cache_persistent?EventType::HIT_MISS:EventType::INVALIDATE_WRITE;
 
 			MessierEvent * mess = new MessierEvent(tmp2, params->cache_persistent?EventType::HIT_MISS:EventType::INVALIDATE_WRITE);
-			m_EventChan->send(params->cache_persistent?params->cache_latency:1, mess);
+			send_event(params->cache_persistent?params->cache_latency:1, mess);
 
 
 
@@ -988,7 +1225,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
 				HOLD[tmp2->req_ID] = 1;
 
 			tmp2->meta_data = EventType::HIT_MISS;
-			m_EventChan->send(params->cache_latency, new MessierEvent(tmp2, EventType::HIT_MISS));
+			send_event(params->cache_latency, new MessierEvent(tmp2, EventType::HIT_MISS));
 
 		}
 	}
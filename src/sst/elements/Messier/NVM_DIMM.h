@@ -27,6 +27,9 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <map>
 #include <list>
+#include <deque>
+#include <vector>
+#include <functional>
 #include "Rank.h"
 #include "WriteBuffer.h"
 #include "NVM_Params.h"
@@ -118,14 +121,42 @@ namespace SST { namespace MessierComponent{
 
 		int group_locked;
 
+		// Per-bank scheduling: reads queued at each bank (indexed by rank * num_banks + bank) in arrival order
+		std::vector<std::deque<NVM_Request *> > bank_queues;
+
+		// Bit per bank, set when the bank has queued reads
+		std::vector<uint64_t> queued_banks;
+
+		// Number of reads in bank_queues
+		int queued_reads;
+
+		// Writes waiting for room in the write buffer, in arrival order
+		std::deque<NVM_Request *> pending_writes;
+
+		long long int next_seq;
+
+		// Events sent on the self link that have not been handled yet
+		int inflight_events;
+
+		// Called when a request arrives, so the owner can turn its clock back on
+		std::function<void()> wake_handler;
+
 		public:
 
 		// This is the constructor for the NVM-based DIMM
 		NVM_DIMM(SST::ComponentId_t id, NVM_PARAMS par);
 
-		// This is the clock of the near memory controller
+		// This is the clock of the near memory controller, returns true if there is nothing left to do
 		bool tick();
 
+		// Nothing is queued, executing or in flight, so ticking only advances the cycle count
+		bool idle();
+
+		// Account for ticks that were skipped while idle
+		void skipCycles(long long int skipped);
+
+		void setWakeHandler(std::function<void()> handler) { wake_handler = handler; }
+
 		void finish(){}
 
 		RANK * getRank(long long int add){ return ranks[WhichRank(add)]; }
@@ -142,7 +173,30 @@ namespace SST { namespace MessierComponent{
 
 		//bool push_request(NVM_Request * req) { if(transactions.size() >= params->max_requests) return false; else {transactions.push_back(req); return true; }}
 
-		bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) TIME_STAMP[req]= cycles; return true;}
+		bool push_request(NVM_Request * req);
+
+		// True if there are requests waiting to be submitted
+		bool requests_pending() { return params->bank_queues ? (queued_reads > 0 || !pending_writes.empty()) : !transactions.empty(); }
+
+		// This picks the next request from the per-bank queues
+		bool submit_request_bank();
+
+		// Removes the read at position pos of the queue of bank b
+		void dequeue_read(int b, size_t pos);
+
+		// This checks if a read can be sent to its bank now, including through write cancellation
+		bool can_issue_read(NVM_Request * temp, RANK * corresp_rank, BANK * corresp_bank);
+
+		// This sends a read to its bank, returns false if the power budget does not allow activating the row
+		bool issue_read(NVM_Request * temp, RANK * corresp_rank, BANK * corresp_bank);
+
+		// This moves a write into the write buffer and acknowledges it
+		void post_write(NVM_Request * temp);
+
+		// This drops a read that was answered by the internal cache
+		void drop_squashed(NVM_Request * temp);
+
+		void send_event(SimTime_t delay, SST::Event * ev) { inflight_events++; m_EventChan->send(delay, ev); }
 
 		// This is the optimized version that basiclly tries to find out if there is any possibility to achieve a row buffer hit from the current transactions
 		bool submit_request_opt();
@@ -151,6 +151,9 @@ class NVM_PARAMS
 		// This indicates the write cancellation threshold
 		int write_cancel_th;
 
+		// This indicates if reads are queued per bank (true) or scheduled from one queue in arrival order (false)
+		bool bank_queues;
+
 
 	public:
 
@@ -231,6 +234,8 @@ class NVM_PARAMS
 
 			write_cancel_th = D.write_cancel_th;
 
+			bank_queues = D.bank_queues;
+
 		}
 };
 }}
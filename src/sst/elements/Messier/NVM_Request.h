@@ -24,6 +24,7 @@
 #include <sst/core/component.h>
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/memEventPool.h>
 #include<map>
 #include<list>
 
@@ -43,6 +44,15 @@ class NVM_Request
 		long long int Address;
 		int meta_data;
 
+		// Arrival order, used by the per-bank scheduler to pick the oldest request
+		long long int seq;
+
+		// A request object is created and deleted for every access, so freed objects
+		// are recycled through a free list instead of going to the heap
+		static void * operator new(size_t size) { return MemHierarchy::ObjectPool<NVM_Request>::allocate(size); }
+
+		static void operator delete(void * block, size_t size) { MemHierarchy::ObjectPool<NVM_Request>::release(block, size); }
+
 };
 
 }}
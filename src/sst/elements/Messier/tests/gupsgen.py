@@ -1,4 +1,15 @@
 import sst
+import sys
+
+# Messier parameters can be overridden with key=value arguments, e.g.
+#   sst gupsgen.py -- scheduler=bank unclock_idle=1
+messier_options = {}
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    messier_options[key.lstrip("-")] = value
 
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
@@ -90,6 +101,7 @@ messier_inst.addParams({
       "write_weight" : "50",
       "max_writes" : 4
 })
+messier_inst.addParams(messier_options)
 
 
 #nvm_memory.addParams({
@@ -58,39 +58,70 @@ class testcase_Messier_Component(SSTTestCase):
     def test_Messier_streambench_messier(self):
         self.Messier_test_template("streambench_messier")
 
+    # Stopping the clock while the DIMM is idle must not change any timing
+    def test_Messier_gupsgen_unclock_idle(self):
+        self.Messier_test_template("gupsgen", testname="gupsgen_unclock_idle", options="unclock_idle=1")
+
+    # The per-bank scheduler reorders reads, so only the work done must match the reference
+    def test_Messier_gupsgen_bank_scheduler(self):
+        outfile = self.Messier_test_template("gupsgen", testname="gupsgen_bank_scheduler", options="scheduler=bank", compare_ref=False)
+        reffile = "{0}/refFiles/test_Messier_gupsgen.out".format(self.get_testsuite_dir())
+        for stat in ["cpu.read_reqs", "cpu.write_reqs", "cpu.total_bytes_read", "cpu.total_bytes_write"]:
+            self.assertEqual(self._get_stat_line(outfile, stat), self._get_stat_line(reffile, stat),
+                             "Messier bank scheduler: {0} in {1} does not match {2}".format(stat, outfile, reffile))
+        self.assertEqual(self._get_stat_count(outfile, "cpu.req_latency"), self._get_stat_count(reffile, "cpu.req_latency"),
+                         "Messier bank scheduler: not every request in {0} completed".format(outfile))
+
+    # Combined, the scheduler must still complete every request with the clock stopped while idle
+    def test_Messier_gupsgen_bank_scheduler_unclock_idle(self):
+        outfile = self.Messier_test_template("gupsgen", testname="gupsgen_bank_scheduler_unclock_idle", options="scheduler=bank unclock_idle=1", compare_ref=False)
+        reffile = "{0}/refFiles/test_Messier_gupsgen.out".format(self.get_testsuite_dir())
+        self.assertEqual(self._get_stat_count(outfile, "cpu.req_latency"), self._get_stat_count(reffile, "cpu.req_latency"),
+                         "Messier bank scheduler with unclock_idle: not every request in {0} completed".format(outfile))
+
 #####
 
-    def Messier_test_template(self, testcase):
+    def Messier_test_template(self, testcase, testname=None, options="", compare_ref=True):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
         tmpdir = self.get_test_output_tmp_dir()
 
         # Set the various file paths
-        testDataFileName="test_Messier_{0}".format(testcase)
+        if testname is None:
+            testname = testcase
+        testDataFileName="test_Messier_{0}".format(testname)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/test_Messier_{1}.out".format(test_path, testcase)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
         newreffile = "{0}/refFiles/{1}.newref".format(outdir, testDataFileName)
         newoutfile = "{0}/{1}.newout".format(outdir, testDataFileName)
+        otherargs = ""
+        if options != "":
+            otherargs = '--model-options="{0}"'.format(options)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, timeout_sec=120)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, timeout_sec=120)
 
         testing_remove_component_warning_from_file(outfile)
 
         # Perform the tests
         self.assertFalse(os_test_file(errfile, "-s"), "Messier test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
 
+        if not compare_ref:
+            cmd = 'grep -q "Simulation is complete" {0} '.format(outfile)
+            self.assertTrue(os.system(cmd) == 0, "Output file {0} does not contain a simulation complete message".format(outfile))
+            return outfile
+
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
         #       DEVELOPER AGAINST THE LATEST VERSION OF SST TO SEE IF THE
         #       TESTS & RESULT FILES ARE STILL VALID
 
         # Perform the test
-        cmp_result = testing_compare_sorted_diff(testcase, outfile, reffile)
+        cmp_result = testing_compare_sorted_diff(testname, outfile, reffile)
 
         # Special case handling of stencil3dbench_messier
         if not cmp_result and testcase == "stencil3dbench_messier":
@@ -105,6 +136,23 @@ class testcase_Messier_Component(SSTTestCase):
 
         else:
             if (cmp_result == False):
-                diffdata = testing_get_diff_data(testcase)
+                diffdata = testing_get_diff_data(testname)
                 log_failure(diffdata)
             self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+        return outfile
+
+###
+
+    def _get_stat_line(self, outfile, stat):
+        # The accumulator fields of statistic 'stat', or None if it is not in outfile
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                if line.strip().startswith(stat + " :"):
+                    return line.split(":", 2)[2].strip()
+        return None
+
+    def _get_stat_count(self, outfile, stat):
+        fields = self._get_stat_line(outfile, stat)
+        if fields is None:
+            return None
+        return [f.split("=")[1].strip() for f in fields.split(";") if f.strip().startswith("Count.")][0]
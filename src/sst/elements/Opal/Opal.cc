@@ -69,6 +69,12 @@ Opal::Opal(SST::ComponentId_t id, SST::Params& params): Component(id) {
 		sprintf(buffer, "mempool%" PRIu32 ".", i);
 		Params memPoolParams = sharedMemParams.find_prefix_params(buffer);
 		sharedMemoryInfo[i] = new MemoryPrivateInfo(opalBase, i, memPoolParams);
+		char* poolSubID = (char*) malloc(sizeof(char) * 32);
+		sprintf(poolSubID, "%" PRIu32, i);
+		sharedMemoryInfo[i]->pool->setStatistics(registerStatistic<uint64_t>("shared_mempool_alloc_latency", poolSubID),
+				registerStatistic<uint64_t>("shared_mempool_fragmentation_2M", poolSubID),
+				registerStatistic<uint64_t>("shared_mempool_fragmentation_1G", poolSubID));
+		free(poolSubID);
 		std::cerr << getName().c_str() << "Configuring Shared " << buffer << std::endl;
 		shared_mem_size += memPoolParams.find<uint64_t>("size", 0);
 		memset(buffer, 0 , 256);
@@ -103,6 +109,9 @@ Opal::Opal(SST::ComponentId_t id, SST::Params& params): Component(id) {
 		sprintf(subID, "%" PRIu32, i);
 		nodeInfo[i]->statLocalMemUsage = registerStatistic<uint64_t>("local_mem_usage", subID );
 		nodeInfo[i]->statSharedMemUsage = registerStatistic<uint64_t>("shared_mem_usage", subID );
+		nodeInfo[i]->pool->setStatistics(registerStatistic<uint64_t>("local_mempool_alloc_latency", subID),
+				registerStatistic<uint64_t>("local_mempool_fragmentation_2M", subID),
+				registerStatistic<uint64_t>("local_mempool_fragmentation_1G", subID));
 		free(subID);
 	}
 
@@ -249,7 +258,35 @@ REQRESPONSE Opal::isAddressReserved(int node, uint64_t vAddress)
 	return response;
 }
 
-REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages)
+// Allocate 'pages' pages of 'page_size' bytes from one pool, returns the last page or status 0 if the pool can not hold them all
+REQRESPONSE Opal::allocatePages(Pool *pool, int node, SST::OpalComponent::MemType memType, int pages, uint64_t page_size)
+{
+	REQRESPONSE response;
+	response.status = 0;
+
+	if( pool->available_frames < pages * pool->frames_per_page(page_size) )
+		return response;
+
+	// The buddy allocator can have enough free frames but no free block of the page size
+	std::vector<uint64_t> allocated;
+	for(int j=0; j<pages; j++) {
+		response = pool->allocate_page(page_size);
+		if(!response.status) {
+			for(uint64_t address : allocated)
+				pool->deallocate_frame(address, pool->frames_per_page(page_size));
+			return response;
+		}
+
+		allocated.push_back(response.address);
+		nodeInfo[node]->profileEvent(memType);
+	}
+
+	response.pages = pages;
+	response.status = 1;
+	return response;
+}
+
+REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages, uint64_t page_size)
 {
 	REQRESPONSE response;
 	response.status = 0;
@@ -265,21 +302,9 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 
 		for(uint32_t i = 0; i<num_shared_mempools; i++)
 		{
-			if( sharedMemoryInfo[i]->pool->available_frames >= pages )
-			{
-				Pool *pool = sharedMemoryInfo[i]->pool;
-				for(int j=0; j<pages; j++) {
-					response = pool->allocate_frame(1);
-					if(!response.status)
-						output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
-
-					nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-				}
-
-				response.pages = pages;
-				response.status = 1;
+			response = allocatePages(sharedMemoryInfo[i]->pool, node, SST::OpalComponent::MemType::SHARED, pages, page_size);
+			if( response.status )
 				break;
-			}
 		}
 
 		if(!response.status)
@@ -288,19 +313,9 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 		return response;
 	}
 
-	if( sharedMemoryInfo[sharedMemPoolId]->pool->available_frames >= pages ) {
-		Pool *pool = sharedMemoryInfo[sharedMemPoolId]->pool;
-		for(int j=0; j<pages; j++) {
-			response = pool->allocate_frame(1);
-			if(!response.status)
-				output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
-
-			nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-		}
-
+	response = allocatePages(sharedMemoryInfo[sharedMemPoolId]->pool, node, SST::OpalComponent::MemType::SHARED, pages, page_size);
+	if( response.status ) {
 		setNextMemPool( node,fault_level );
-		response.pages = pages;
-		response.status = 1;
 	}
 	else
 	{
@@ -312,19 +327,9 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 
 			sharedMemPoolId = nodeInfo[node]->allocatedmempool - 1;
 
-			if( sharedMemoryInfo[sharedMemPoolId]->pool->available_frames >= pages ) {
-				Pool *pool = sharedMemoryInfo[sharedMemPoolId]->pool;
-				for(int j=0; j<pages; j++) {
-					response = pool->allocate_frame(1);
-					if(!response.status)
-						output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
-
-					nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-				}
-
+			response = allocatePages(sharedMemoryInfo[sharedMemPoolId]->pool, node, SST::OpalComponent::MemType::SHARED, pages, page_size);
+			if( response.status ) {
 				setNextMemPool( node,fault_level );
-				response.pages = pages;
-				response.status = 1;
 				break;
 			}
 		}
@@ -337,32 +342,22 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 	return response;
 }
 
-REQRESPONSE Opal::allocateLocalMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages)
+REQRESPONSE Opal::allocateLocalMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages, uint64_t page_size)
 {
 
 	REQRESPONSE response;
 	response.status = 0;
 
 
-	if(nodeInfo[node]->pool->available_frames >= pages) {
-		Pool *pool = nodeInfo[node]->pool;
-		for(int i=0; i<pages; i++) {
-			response = pool->allocate_frame(1);
-			if(!response.status)
-				output->fatal(CALL_INFO, -1, "Opal: Allocating local memory. This should never happen\n");
-
-			nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::LOCAL);
-		}
-
-		response.pages = pages;
-		response.status = 1;
+	response = allocatePages(nodeInfo[node]->pool, node, SST::OpalComponent::MemType::LOCAL, pages, page_size);
+	if( response.status ) {
 		setNextMemPool( node,fault_level );
 	}
 	else {
 		OPAL_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Node%" PRIu32 " Local Memory is drained out\n", node));
 
 		setNextMemPool( node,fault_level );
-		response = allocateSharedMemory(node, coreId, vAddress, fault_level, pages);
+		response = allocateSharedMemory(node, coreId, vAddress, fault_level, pages, page_size);
 	}
 
 
@@ -370,7 +365,7 @@ REQRESPONSE Opal::allocateLocalMemory(int node, int coreId, uint64_t vAddress, i
 
 }
 
-REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddress, uint64_t vAddress, int pages)
+REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddress, uint64_t vAddress, int pages, uint64_t page_size)
 {
 	REQRESPONSE response;
 	response.status = 0;
@@ -386,10 +381,10 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 
 		for(uint32_t i = 0; i<num_shared_mempools; i++) {
 
-			if( sharedMemoryInfo[i]->pool->available_frames >= pages ) {
+			if( sharedMemoryInfo[i]->pool->available_frames >= pages_reserved * sharedMemoryInfo[i]->pool->frames_per_page(page_size) ) {
 				Pool *pool = sharedMemoryInfo[i]->pool;
 				for(int j=0; j<pages_reserved; j++) {
-					response = pool->allocate_frame(1);
+					response = pool->allocate_page(page_size);
 					reserved_pAddress->push_back( response.address );
 
 					if(!response.status)
@@ -433,15 +428,14 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 	REQRESPONSE response;
 	response.status = 0;
 
-	int pages = ceil(size/(nodeInfo[node]->page_size));
-
-	// If multiple pages are requested how are the physical addresses sent to the requester as in future sue to opal parallelization continuous addresses cannot be allocated
-	if(pages != 1)
-		output->fatal(CALL_INFO, -1, "Opal: currently opal does not support multiple page allocations\n");
+	// A fault is served with one page of the node's page size, or with one huge page if the fault asks for more,
+	// as the physical addresses of multiple pages could not be sent back to the requester
+	uint64_t page_size = std::max((uint64_t) size, nodeInfo[node]->page_size);
+	int pages = 1;
 
 	// if the page fault request is for CR3 register allocate the memory from local memory
 	if(4 == fault_level)
-		response = allocateLocalMemory(node, coreId, vAddress, fault_level, pages);
+		response = allocateLocalMemory(node, coreId, vAddress, fault_level, pages, page_size);
 	else
 	{
 
@@ -449,15 +443,15 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 		response = isAddressReserved(node, vAddress);
 
 		if( response.status )
-			response = allocateFromReservedMemory(node, response.address, vAddress, pages);
+			response = allocateFromReservedMemory(node, response.address, vAddress, pages, nodeInfo[node]->page_size);
 
 		else {
 			if( !nodeInfo[node]->allocatedmempool ) {
-				response = allocateLocalMemory(node, coreId, vAddress, fault_level, pages);
+				response = allocateLocalMemory(node, coreId, vAddress, fault_level, pages, page_size);
 				//std::cerr << getName() << " Node: " << node << " core " << coreId << " response page address: " << vAddress << " allocated local address: " << response.address << " pages: "<< pages << " level: " << fault_level  << std::endl;
 			}
 			else {
-				response = allocateSharedMemory(node, coreId, vAddress, fault_level, pages);
+				response = allocateSharedMemory(node, coreId, vAddress, fault_level, pages, page_size);
 				//std::cerr << getName() << " Node: " << node << " core " << coreId << " response page address: " << vAddress << " allocated shared address: " << response.address << " pages: " << " level: " << fault_level << std::endl;
 			}
 		}
@@ -465,7 +459,7 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 
 	if( response.status ) {
 		OpalEvent *tse = new OpalEvent(EventType::RESPONSE);
-		tse->setResp(vAddress, response.address, response.pages*nodeInfo[node]->page_size);
+		tse->setResp(vAddress, response.address, response.pages*page_size);
 		tse->setCoreId(coreId);
 		nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
 	}
@@ -267,11 +267,13 @@ namespace SST
 
 				void setNextMemPool( int node,int fault_level );
 
-				REQRESPONSE allocateLocalMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages);
+				REQRESPONSE allocatePages(Pool *pool, int node, SST::OpalComponent::MemType memType, int pages, uint64_t page_size);
 
-				REQRESPONSE allocateSharedMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages);
+				REQRESPONSE allocateLocalMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages, uint64_t page_size);
 
-				REQRESPONSE allocateFromReservedMemory(int node, uint64_t reserved_vAddress, uint64_t vAddress, int pages);
+				REQRESPONSE allocateSharedMemory(int node, int coreId, uint64_t vAddress, int fault_level, int pages, uint64_t page_size);
+
+				REQRESPONSE allocateFromReservedMemory(int node, uint64_t reserved_vAddress, uint64_t vAddress, int pages, uint64_t page_size);
 
 				REQRESPONSE isAddressReserved(int node, uint64_t vAddress);
 
@@ -322,10 +324,14 @@ namespace SST
 							{"shared_mem.mempool%(shared_mempools).size", "Size of each shared memory pool in KBs", "1024"},
 							{"shared_mem.mempool%(shared_mempools).frame_size", "Size of each shared memory pool in KBs", "4"},
 							{"shared_mem.mempool%(shared_mempools).mem_tech", "memory technology of each shared memory pool in KBs", "0"},
+							{"shared_mem.mempool%(shared_mempools).allocator", "frame allocator of each shared memory pool, 'list' or 'buddy' (bitmap buddy allocator with contiguous power of two blocks)", "list"},
+							{"shared_mem.mempool%(shared_mempools).max_frame_size", "largest block the buddy allocator hands out in KBs, a power of two multiple of frame_size", "1048576"},
 							{"local_mem.mempool%(num_nodes).start", "the starting physical address of each local memory pool in KBs", "0"},
 							{"local_mem.mempool%(num_nodes).size", "Size of each local memory pool in KBs", "1024"},
 							{"local_mem.mempool%(num_nodes).frame_size", "frame size of each local memory pool in KBs", "4"},
 							{"local_mem.mempool%(num_nodes).mem_tech", "memory technology of each local memory pool in KBs", "0"},
+							{"local_mem.mempool%(num_nodes).allocator", "frame allocator of each local memory pool, 'list' or 'buddy' (bitmap buddy allocator with contiguous power of two blocks)", "list"},
+							{"local_mem.mempool%(num_nodes).max_frame_size", "largest block the buddy allocator hands out in KBs, a power of two multiple of frame_size", "1048576"},
 							{"startaddress%(num_pools)", "the starting physical address of the pool", "0"},
 							{"type%(num_pools)", "0 means private for specific NUMA domain, 1 means shared among specific NUMA domains, 2 means public", "2"},
 							{"cluster_size", "This determines the number of NUMA domains in each cluster, if clustering is used", "1"},
@@ -337,6 +343,12 @@ namespace SST
 					SST_ELI_DOCUMENT_STATISTICS(
 							{ "local_mem_usage", "Number of pages allocated in local memory", "requests", 1},
 							{ "shared_mem_usage", "Number of pages allocated in shared memory", "requests", 1},
+							{ "local_mempool_alloc_latency", "Buddy allocator work per allocation from a local pool (orders searched plus blocks split)", "operations", 2},
+							{ "local_mempool_fragmentation_2M", "Percent of free local pool memory not in free 2MB blocks, sampled at each buddy allocation", "percent", 2},
+							{ "local_mempool_fragmentation_1G", "Percent of free local pool memory not in free 1GB blocks, sampled at each buddy allocation", "percent", 2},
+							{ "shared_mempool_alloc_latency", "Buddy allocator work per allocation from a shared pool (orders searched plus blocks split)", "operations", 2},
+							{ "shared_mempool_fragmentation_2M", "Percent of free shared pool memory not in free 2MB blocks, sampled at each buddy allocation", "percent", 2},
+							{ "shared_mempool_fragmentation_1G", "Percent of free shared pool memory not in free 1GB blocks, sampled at each buddy allocation", "percent", 2},
 							)
 
 					SST_ELI_DOCUMENT_PORTS(
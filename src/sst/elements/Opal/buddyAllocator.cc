@@ -0,0 +1,207 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include <sst_config.h>
+
+#include "buddyAllocator.h"
+
+
+void FrameBitmap::resize(uint64_t bits)
+{
+	levels.clear();
+
+	uint64_t words = (bits + 63) / 64;
+	if(words == 0)
+		words = 1;
+
+	while(true) {
+		levels.push_back(std::vector<uint64_t>(words, 0));
+		if(words == 1)
+			break;
+		words = (words + 63) / 64;
+	}
+}
+
+void FrameBitmap::set(uint64_t index)
+{
+	for(size_t l = 0; l < levels.size(); l++) {
+		uint64_t &word = levels[l][index >> 6];
+		bool was_empty = (word == 0);
+		word |= ((uint64_t) 1) << (index & 63);
+
+		// The summary bit above is already set
+		if(!was_empty)
+			break;
+
+		index >>= 6;
+	}
+}
+
+void FrameBitmap::clear(uint64_t index)
+{
+	for(size_t l = 0; l < levels.size(); l++) {
+		uint64_t &word = levels[l][index >> 6];
+		word &= ~(((uint64_t) 1) << (index & 63));
+
+		// Other bits in this word keep the summary bit above set
+		if(word != 0)
+			break;
+
+		index >>= 6;
+	}
+}
+
+uint64_t FrameBitmap::findFirst() const
+{
+	if(empty())
+		return npos;
+
+	uint64_t index = __builtin_ctzll(levels.back()[0]);
+	for(size_t l = levels.size() - 1; l > 0; l--)
+		index = (index << 6) + __builtin_ctzll(levels[l - 1][index]);
+
+	return index;
+}
+
+
+BuddyAllocator::BuddyAllocator(uint64_t frames, int maxOrder)
+{
+	num_frames = frames;
+	free_frames = frames;
+	max_order = maxOrder;
+
+	free_blocks.resize(max_order + 1);
+	alloc_blocks.resize(max_order + 1);
+	free_count.resize(max_order + 1, 0);
+
+	for(int k = 0; k <= max_order; k++) {
+		free_blocks[k].resize((num_frames >> k) + 1);
+		alloc_blocks[k].resize((num_frames >> k) + 1);
+	}
+
+	// Cover the pool with the largest aligned blocks that fit, the pool
+	// size does not have to be a multiple of the largest block
+	uint64_t frame = 0;
+	while(frame < num_frames) {
+		int k = max_order;
+		while(k > 0 && ((frame & ((((uint64_t) 1) << k) - 1)) != 0 || frame + (((uint64_t) 1) << k) > num_frames))
+			k--;
+
+		free_blocks[k].set(frame >> k);
+		free_count[k]++;
+		frame += ((uint64_t) 1) << k;
+	}
+}
+
+uint64_t BuddyAllocator::allocate(int order, uint64_t &cost)
+{
+	cost = 0;
+
+	if(order > max_order)
+		return FrameBitmap::npos;
+
+	int k = order;
+	while(k <= max_order && free_blocks[k].empty()) {
+		k++;
+		cost++;
+	}
+
+	if(k > max_order)
+		return FrameBitmap::npos;
+
+	uint64_t block = free_blocks[k].findFirst();
+	free_blocks[k].clear(block);
+	free_count[k]--;
+	cost++;
+
+	// Split down to the requested order, keeping the lower half each time
+	while(k > order) {
+		k--;
+		block <<= 1;
+		free_blocks[k].set(block + 1);
+		free_count[k]++;
+		cost++;
+	}
+
+	alloc_blocks[order].set(block);
+	free_frames -= ((uint64_t) 1) << order;
+
+	return block << order;
+}
+
+int BuddyAllocator::deallocate(uint64_t frame)
+{
+	if(frame >= num_frames)
+		return -1;
+
+	int order = -1;
+	for(int k = 0; k <= max_order; k++) {
+		if((frame & ((((uint64_t) 1) << k) - 1)) != 0)
+			break;
+
+		if(alloc_blocks[k].test(frame >> k)) {
+			order = k;
+			break;
+		}
+	}
+
+	if(order < 0)
+		return -1;
+
+	alloc_blocks[order].clear(frame >> order);
+	free_frames += ((uint64_t) 1) << order;
+
+	// Merge with the buddy for as long as it is free as a whole
+	int k = order;
+	uint64_t block = frame >> order;
+	while(k < max_order && free_blocks[k].test(block ^ 1)) {
+		free_blocks[k].clear(block ^ 1);
+		free_count[k]--;
+		block >>= 1;
+		k++;
+	}
+
+	free_blocks[k].set(block);
+	free_count[k]++;
+
+	return order;
+}
+
+bool BuddyAllocator::isAllocated(uint64_t frame) const
+{
+	if(frame >= num_frames)
+		return false;
+
+	for(int k = 0; k <= max_order; k++) {
+		if(alloc_blocks[k].test(frame >> k))
+			return true;
+	}
+
+	return false;
+}
+
+uint64_t BuddyAllocator::freeFramesAtOrder(int order) const
+{
+	uint64_t frames = 0;
+	for(int k = order; k <= max_order; k++)
+		frames += free_count[k] << k;
+
+	return frames;
+}
+
+uint64_t BuddyAllocator::fragmentation(int order) const
+{
+	if(free_frames == 0)
+		return 0;
+
+	return 100 - (freeFramesAtOrder(order) * 100) / free_frames;
+}
@@ -0,0 +1,107 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef _H_SST_OPAL_BUDDY_ALLOCATOR
+#define _H_SST_OPAL_BUDDY_ALLOCATOR
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+
+// A bitmap with summary levels above it, each bit of a summary word says
+// whether the word below it has any bit set. Finding the lowest set bit
+// visits one word per level, so it stays cheap for pools with hundreds of
+// millions of frames.
+class FrameBitmap {
+
+	public:
+
+		static const uint64_t npos = ~((uint64_t) 0);
+
+		FrameBitmap() {}
+
+		void resize(uint64_t bits);
+
+		bool test(uint64_t index) const {
+			return (levels[0][index >> 6] >> (index & 63)) & 1;
+		}
+
+		void set(uint64_t index);
+
+		void clear(uint64_t index);
+
+		// Lowest set bit or npos if none
+		uint64_t findFirst() const;
+
+		bool empty() const { return levels.empty() || levels.back()[0] == 0; }
+
+	private:
+
+		// levels[0] holds the bits, levels.back() is a single word
+		std::vector<std::vector<uint64_t> > levels;
+
+};
+
+
+// Binary buddy allocator over a range of frames. A block of order k is 2^k
+// contiguous frames aligned to 2^k frames, so with 4KB frames order 9 is a
+// 2MB page and order 18 a 1GB page. For each order one bitmap marks the
+// free blocks and another the allocated blocks; no per-frame objects are
+// kept. Blocks are handed out lowest address first.
+class BuddyAllocator {
+
+	public:
+
+		BuddyAllocator(uint64_t frames, int maxOrder);
+
+		// Allocate a block of 2^order frames, returns the first frame number
+		// or FrameBitmap::npos if there is no free block large enough.
+		// cost is set to the number of orders searched plus blocks split.
+		uint64_t allocate(int order, uint64_t &cost);
+
+		// Free the allocated block starting at frame, returns the order of
+		// the block or -1 if no block starts there
+		int deallocate(uint64_t frame);
+
+		// True if frame lies inside an allocated block
+		bool isAllocated(uint64_t frame) const;
+
+		uint64_t freeFrames() const { return free_frames; }
+
+		// Free frames that are in free blocks of at least the given order
+		uint64_t freeFramesAtOrder(int order) const;
+
+		// Percentage of the free memory that can not be used for a block of
+		// the given order, 0 if nothing is free
+		uint64_t fragmentation(int order) const;
+
+		int getMaxOrder() const { return max_order; }
+
+	private:
+
+		uint64_t num_frames;
+
+		uint64_t free_frames;
+
+		int max_order;
+
+		std::vector<FrameBitmap> free_blocks;
+
+		std::vector<FrameBitmap> alloc_blocks;
+
+		// Number of free blocks of each order
+		std::vector<uint64_t> free_count;
+
+};
+
+#endif
@@ -31,12 +31,22 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 
 	output = new SST::Output("OpalMemPool[@f:@l:@p] ", 16, 0, SST::Output::STDOUT);
 
-	size = params.find<uint32_t>("size", 0); // in KB's
+	size = params.find<uint64_t>("size", 0); // in KB's
 
 	start = params.find<uint64_t>("start", 0);
 
 	frsize = params.find<int>("frame_size", 4); //4KB frame size
 
+	std::string allocator = params.find<std::string>("allocator", "list");
+
+	uint64_t max_frame_size = params.find<uint64_t>("max_frame_size", 1048576); // in KB's, 1GB pages by default
+
+	buddy = nullptr;
+	buddy_max_order = -1;
+	statAllocLatency = nullptr;
+	statFragmentation2M = nullptr;
+	statFragmentation1G = nullptr;
+
 	memType = mem_type;
 
 	poolId = id;
@@ -75,6 +85,15 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 	}
 
 	std::cerr << "Pool start: " << start << " size: " << size << " frame size: " << frsize << " mem tech: " << mem_tech << std::endl;
+
+	if(allocator == "buddy") {
+		buddy_max_order = frameOrder(max_frame_size);
+		if(buddy_max_order < 0)
+			output->fatal(CALL_INFO, -1, "Opal memory pool %d: max_frame_size (%" PRIu64 "KB) must be a power of two multiple of the frame size (%dKB)\n", poolId, max_frame_size, frsize);
+	}
+	else if(allocator != "list")
+		output->fatal(CALL_INFO, -1, "Opal memory pool %d: allocator must be 'list' or 'buddy', got '%s'\n", poolId, allocator.c_str());
+
 	build_mem();
 
 }
@@ -82,7 +101,7 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 //Create free frames of size framesize, note that the size is in KB
 void Pool::build_mem()
 {
-	int i=0;
+	uint64_t i=0;
 	num_frames = ceil(size/frsize);
 	real_size = num_frames * frsize;
 
@@ -94,8 +113,16 @@ void Pool::build_mem()
 	//unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
 	//std::shuffle(numbers.begin(), numbers.end(), std::default_random_engine(seed));
 
-	for(i=0; i< num_frames; i++) {
-		freelist.push_back(((uint64_t) i*frsize*1024) + start);
+	// The buddy allocator keeps bitmaps rather than a list entry per frame
+	if(buddy_max_order >= 0) {
+		buddy = new BuddyAllocator(num_frames, buddy_max_order);
+		order_2M = (frameOrder(2048) <= buddy_max_order) ? frameOrder(2048) : -1;
+		order_1G = (frameOrder(1048576) <= buddy_max_order) ? frameOrder(1048576) : -1;
+	}
+	else {
+		for(i=0; i< num_frames; i++) {
+			freelist.push_back(((uint64_t) i*frsize*1024) + start);
+		}
 	}
 
 	available_frames = num_frames;
@@ -110,7 +137,28 @@ REQRESPONSE Pool::allocate_frames(int pages)
 	REQRESPONSE response;
 	response.status =0;
 
-	if(available_frames < pages) {
+	if(available_frames < (uint64_t) pages) {
+		return response;
+	}
+
+	// Frames need not be contiguous, so take them one at a time
+	if(buddy) {
+		std::list<uint64_t> frames_allocated;
+		for(int i = 0; i < pages; i++) {
+			REQRESPONSE frame = buddy_allocate(1);
+			if(!frame.status) {
+				while(!frames_allocated.empty()) {
+					deallocate_frame(frames_allocated.front(), 1);
+					frames_allocated.pop_front();
+				}
+				return response;
+			}
+			frames_allocated.push_back(frame.address);
+		}
+
+		response.address = frames_allocated.front();
+		response.pages = pages;
+		response.status = 1;
 		return response;
 	}
 
@@ -154,6 +202,21 @@ REQRESPONSE Pool::allocate_frames(int pages)
 
 }
 
+// Allocate one page, the buddy allocator hands out huge pages as a single block of frames
+REQRESPONSE Pool::allocate_page(uint64_t page_size)
+{
+	uint64_t frames = frames_per_page(page_size);
+
+	if(buddy)
+		return buddy_allocate(frames);
+
+	// The free list has no contiguous blocks, so a page larger than a frame takes frames one at a time
+	if(frames == 1)
+		return allocate_frame(1);
+
+	return allocate_frames(frames);
+}
+
 // Allocate N contigiuous frames, returns the starting address if successfull, or -1 if it fails!
 REQRESPONSE Pool::allocate_frame(int N)
 {
@@ -161,6 +224,8 @@ REQRESPONSE Pool::allocate_frame(int N)
 	REQRESPONSE response;
 	response.status = 0;
 
+	if(buddy)
+		return buddy_allocate(N);
 
 	// Make sure we have free frames first
 	if(freelist.empty())
@@ -198,6 +263,20 @@ REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 	uint64_t pAddress = starting_pAddress;
 	uint64_t frame_number;
 
+	if(buddy) {
+		for(int i = 0; i < pages; i++) {
+			uint64_t frameAddr = starting_pAddress + (uint64_t) i*frsize*1024;
+			if(!deallocate_frame(frameAddr, 1).status) {
+				response.address = frameAddr;
+				response.pages = pages - i;
+				response.status = 0;
+				return response;
+			}
+		}
+		response.status = 1;
+		return response;
+	}
+
 	while(frames) {
 
 		// If we can find the frame to be free in the allocated list
@@ -235,6 +314,18 @@ REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 	REQRESPONSE response;
 	response.status = 0;
 
+	// The block size is known from the allocation, N is not needed
+	if(buddy) {
+		if(X < start || (X - start) % ((uint64_t) frsize*1024))
+			return response;
+
+		int order = buddy->deallocate((X - start) / ((uint64_t) frsize*1024));
+		if(order >= 0) {
+			available_frames += ((uint64_t) 1) << order;
+			response.status = 1;
+		}
+		return response;
+	}
 
 	// For now, we will assume you can free only 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating and freeing contigous physical spaces
 	if(N>1)
@@ -262,12 +353,60 @@ REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 
 bool Pool::isAllocated(uint64_t address)
 {
+	if(buddy)
+		return address >= start && buddy->isAllocated((address - start) / ((uint64_t) frsize*1024));
+
 	if(alloclist.find(address)==alloclist.end())
 		return false;
 
 	return true;
 }
 
+// Number of frames in a block of 'kbytes' as a power of two, -1 if it is not one
+int Pool::frameOrder(uint64_t kbytes)
+{
+	if(kbytes < (uint64_t) frsize || kbytes % frsize)
+		return -1;
+
+	uint64_t frames = kbytes / frsize;
+	if(frames & (frames - 1))
+		return -1;
+
+	return __builtin_ctzll(frames);
+}
+
+// Allocate a block of at least N contiguous frames from the buddy allocator, N is rounded up to a power of two
+REQRESPONSE Pool::buddy_allocate(uint64_t N)
+{
+	REQRESPONSE response;
+	response.status = 0;
+
+	int order = 0;
+	while((((uint64_t) 1) << order) < N)
+		order++;
+
+	uint64_t cost;
+	uint64_t frame = buddy->allocate(order, cost);
+
+	if(statAllocLatency)
+		statAllocLatency->addData(cost);
+
+	if(frame == FrameBitmap::npos)
+		return response;
+
+	available_frames -= ((uint64_t) 1) << order;
+
+	if(statFragmentation2M && order_2M >= 0)
+		statFragmentation2M->addData(buddy->fragmentation(order_2M));
+	if(statFragmentation1G && order_1G >= 0)
+		statFragmentation1G->addData(buddy->fragmentation(order_1G));
+
+	response.address = start + frame*frsize*1024;
+	response.pages = 1 << order;
+	response.status = 1;
+	return response;
+}
+
 /*REQRESPONSE Pool::allocate_frame_address(uint64_t address)
 {
 
@@ -19,7 +19,9 @@
  */
 
 #include "Opal_Event.h"
+#include "buddyAllocator.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <cmath>
@@ -77,12 +79,14 @@ class Pool{
 				Frame* frame = it->second;
 				delete frame;
 			}
+
+			delete buddy;
 		}
 
 		void finish() {}
 
 		// The size of the memory pool in KBs
-		uint32_t size;
+		uint64_t size;
 
 		// The starting address of the memory pool
 		uint64_t start;
@@ -93,6 +97,12 @@ class Pool{
 		// Allocate 'size' contigiuous memory, returns a structure with starting address and number of frames allocated
 		REQRESPONSE allocate_frames(int pages);
 
+		// Allocate one page of 'page_size' bytes, as a single contiguous block with the buddy allocator
+		REQRESPONSE allocate_page(uint64_t page_size);
+
+		// Number of frames that back a page of 'page_size' bytes
+		uint64_t frames_per_page(uint64_t page_size) { return std::max((uint64_t) 1, (page_size + (uint64_t) frsize*1024 - 1) / ((uint64_t) frsize*1024)); }
+
 		REQRESPONSE allocate_frame_address(uint64_t address, int N);
 
 		// Freeing N frames starting from Address X, this will return -1 if we find that these frames were not allocated
@@ -104,19 +114,19 @@ class Pool{
 		bool isAllocated(uint64_t address);
 
 		// Current number of free frames
-		int freeframes() { return freelist.size(); }
+		uint64_t freeframes() { return buddy ? available_frames : freelist.size(); }
 
 		// Frame size in KBs
 		int frsize;
 
 		//Total number of frames
-		int num_frames;
+		uint64_t num_frames;
 
 		//real size of the memory pool
-		uint32_t real_size;
+		uint64_t real_size;
 
 		//number of free frames
-		int available_frames;
+		uint64_t available_frames;
 
 		void set_memPool_type(SST::OpalComponent::MemType _memType) { memType = _memType; }
 
@@ -134,6 +144,13 @@ class Pool{
 
 		void profileStats(int stat, int value);
 
+		// Statistics are owned by Opal, only sampled with the buddy allocator
+		void setStatistics(Statistic<uint64_t>* latency, Statistic<uint64_t>* frag2M, Statistic<uint64_t>* frag1G) {
+			statAllocLatency = latency;
+			statFragmentation2M = frag2M;
+			statFragmentation1G = frag1G;
+		}
+
 	private:
 
 		Output *output;
@@ -155,5 +172,22 @@ class Pool{
 		// The list of allocated frames --- the key is the starting physical address
 		std::map<uint64_t, Frame*> alloclist;
 
+		// With allocator = buddy, frames come from this instead of freelist/alloclist
+		BuddyAllocator *buddy;
+
+		int buddy_max_order;
+
+		// Block orders of a 2MB and a 1GB page, -1 if larger than the largest block
+		int order_2M;
+		int order_1G;
+
+		Statistic<uint64_t>* statAllocLatency;
+		Statistic<uint64_t>* statFragmentation2M;
+		Statistic<uint64_t>* statFragmentation1G;
+
+		int frameOrder(uint64_t kbytes);
+
+		REQRESPONSE buddy_allocate(uint64_t N);
+
 };
 
@@ -0,0 +1,166 @@
+import sst
+import sys
+
+# A miranda GUPS core whose page faults are served by Opal through Samba.
+# Local memory only holds a few pages, so most faults are served from the
+# shared pool.
+#
+# Options are given as key=value arguments:
+#   allocator  - frame allocator of both pools, 'list' or 'buddy'
+#   page_size  - page size of the node in KB, also the local pool frame size
+#   frame_size - frame size of the shared pool in KB
+#   sst gupsgen_buddy.py -- allocator=buddy page_size=2048 frame_size=4
+
+options = { "allocator" : "list", "page_size" : "4", "frame_size" : "4" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    options[key.lstrip("-")] = value
+
+allocator = options["allocator"]
+page_size = int(options["page_size"])
+frame_size = int(options["frame_size"])
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "0 ns")
+
+# Tell SST what statistics handling we want
+sst.setStatisticLoadLevel(4)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+clock = "2GHz"
+memory_mb = 1024
+local_memory_kb = 4 * page_size
+shared_memory_kb = 256 * 1024
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "miranda.BaseCPU")
+comp_cpu.addParams({
+	"verbose" : 1,
+})
+cpugen = comp_cpu.setSubComponent("generator", "miranda.GUPSGenerator")
+cpugen.addParams({
+	"verbose" : 0,
+	"count" : 2000,
+	"max_address" : ((memory_mb) // 2) * 1024 *1024,
+})
+
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "2",
+      "cache_frequency" : clock,
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "4",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "8KB",
+})
+
+comp_memory = sst.Component("memory", "memHierarchy.MemController")
+comp_memory.addParams({
+      "clock" : "1GHz"
+})
+mem = comp_memory.setSubComponent("backend", "memHierarchy.simpleMem")
+mem.addParams({
+      "access_time" : "50 ns",
+      "mem_size" : str(memory_mb * 1024 * 1024) + "B",
+})
+
+mmu = sst.Component("mmu0", "Samba")
+mmu.addParams({
+        "os_page_size": 4,
+        "corecount": 1,
+        "sizes_L1": 3,
+        "page_size1_L1": 4,
+        "page_size2_L1": 2048,
+        "page_size3_L1": 1024*1024,
+        "assoc1_L1": 4,
+        "size1_L1": 64,
+        "assoc2_L1": 4,
+        "size2_L1": 32,
+        "assoc3_L1": 4,
+        "size3_L1": 4,
+        "sizes_L2": 3,
+        "page_size1_L2": 4,
+        "page_size2_L2": 2048,
+        "page_size3_L2": 1024*1024,
+        "assoc1_L2": 12,
+        "size1_L2": 1536,
+        "assoc2_L2": 12,
+        "size2_L2": 1536,
+        "assoc3_L2": 4,
+        "size3_L2": 16,
+        "clock": clock,
+        "levels": 2,
+        "max_width_L1": 3,
+        "max_outstanding_L1": 2,
+        "latency_L1": 4,
+        "parallel_mode_L1": 1,
+        "max_outstanding_L2": 2,
+        "max_width_L2": 4,
+        "latency_L2": 10,
+        "parallel_mode_L2": 0,
+        "self_connected" : 1,
+        "page_walk_latency": 30,
+        "size1_PTWC": 32, # this just indicates the number entries of the page table walk cache level 1 (PTEs)
+        "assoc1_PTWC": 4, # this just indicates the associtativit the page table walk cache level 1 (PTEs)
+        "size2_PTWC": 32, # this just indicates the number entries of the page table walk cache level 1 (PMDs)
+        "assoc2_PTWC": 4, # this just indicates the associtativit the page table walk cache level 1 (PMDs)
+        "size3_PTWC": 32, # this just indicates the number entries of the page table walk cache level 1 (PUDs)
+        "assoc3_PTWC": 4, # this just indicates the associtativit the page table walk cache level 1 (PUDs)
+        "size4_PTWC": 32, # this just indicates the number entries of the page table walk cache level 1 (PGD)
+        "assoc4_PTWC": 4, # this just indicates the associtativit the page table walk cache level 1 (PGD)
+        "latency_PTWC": 10, # This is the latency of checking the page table walk cache
+        "max_outstanding_PTWC": 4,
+        "opal_latency": "30ps",
+        "emulate_faults": 1,
+})
+
+# MMU uses this page fault handler.
+pagefaulthandler = mmu.setSubComponent("pagefaulthandler", "Opal.PageFaultHandler")
+pagefaulthandler.addParams({
+    "opal_latency" : "30ps"
+})
+
+opal = sst.Component("opal","Opal")
+opal.addParams({
+	"clock"				: clock,
+	"num_nodes"			: 1,
+	"verbose"  			: 1,
+	"max_inst" 			: 32,
+	"shared_mempools" 		: 1,
+	"shared_mem.mempool0.start"	: local_memory_kb*1024,
+	"shared_mem.mempool0.size"	: shared_memory_kb,
+	"shared_mem.mempool0.frame_size": frame_size,
+	"shared_mem.mempool0.allocator"	: allocator,
+	"shared_mem.mempool0.max_frame_size" : 2048,
+	"node0.cores" 			: 1,
+	"node0.allocation_policy" 	: 0,
+	"node0.latency" 		: 2000,
+	"node0.memory.start" 		: 0,
+	"node0.memory.size" 		: local_memory_kb,
+	"node0.memory.frame_size" 	: page_size,
+	"node0.memory.allocator" 	: allocator,
+	"node0.memory.max_frame_size" 	: page_size,
+})
+opal.enableAllStatistics({"type":"sst.AccumulatorStatistic"})
+
+# Define the simulation links
+link_cpu_mmu_link = sst.Link("link_cpu_mmu_link")
+link_cpu_mmu_link.connect( (comp_cpu, "cache_link", "50ps"), (mmu, "cpu_to_mmu0", "50ps") )
+link_cpu_mmu_link.setNoCut()
+
+link_mmu_cache_link = sst.Link("link_mmu_cache_link")
+link_mmu_cache_link.connect( (mmu, "mmu_to_cache0", "50ps"), (comp_l1cache, "high_network_0", "50ps") )
+link_mmu_cache_link.setNoCut()
+
+link_ptw_opal_link = sst.Link("link_ptw_opal_link")
+link_ptw_opal_link.connect( (pagefaulthandler, "opal_link_0", "300ps"), (opal, "mmuLink0", "300ps") )
+link_ptw_opal_link.setNoCut()
+
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "low_network_0", "50ps"), (comp_memory, "direct_link", "50ps") )
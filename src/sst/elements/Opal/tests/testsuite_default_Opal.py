@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        try:
+            # Put your single instance Init Code Here
+            pass
+        except:
+            pass
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_Opal_Component(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    # With 4KB pages the buddy allocator hands out frames in the same order
+    # as the free list, so only the buddy statistics may differ
+    def test_Opal_buddy_matches_list(self):
+        listfile = self.Opal_test_template("list_4KB", "allocator=list page_size=4 frame_size=4")
+        buddyfile = self.Opal_test_template("buddy_4KB", "allocator=buddy page_size=4 frame_size=4")
+
+        self._assert_same_output(listfile, buddyfile, "mempool_")
+
+        # 4KB pages split 2MB blocks of the shared pool
+        stats = self._read_accumulator_stats(buddyfile)
+        self.assertTrue(stats["shared_mempool_fragmentation_2M.0"]["Count"] > 0, "Opal: no buddy allocations from the shared pool in {0}".format(buddyfile))
+        self.assertTrue(stats["shared_mempool_fragmentation_2M.0"]["Sum"] > 0, "Opal: 4KB pages did not fragment the shared pool in {0}".format(buddyfile))
+
+    # 2MB pages must be allocated from 4KB frames as whole 2MB blocks
+    def test_Opal_buddy_2MB_pages(self):
+        outfile = self.Opal_test_template("buddy_2MB", "allocator=buddy page_size=2048 frame_size=4")
+
+        stats = self._read_accumulator_stats(outfile)
+        pages = stats["shared_mem_usage.0"]["Count"]
+        self.assertTrue(pages > 0, "Opal: no pages allocated from the shared pool in {0}".format(outfile))
+        self.assertEqual(stats["shared_mempool_alloc_latency.0"]["Count"], pages,
+                         "Opal: expected one buddy allocation per shared page in {0}".format(outfile))
+        self.assertEqual(stats["shared_mempool_fragmentation_2M.0"]["Sum"], 0,
+                         "Opal: 2MB pages fragmented the shared pool in {0}".format(outfile))
+
+#####
+
+    def Opal_test_template(self, testcase, options, testtimeout=120):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_Opal_gupsgen_{0}".format(testcase)
+        sdlfile = "{0}/gupsgen_buddy.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        otherargs = '--model-options="{0}"'.format(options)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        # Opal reports its pool configuration on stderr, so only the run itself is checked
+        cmd = 'grep -q "Simulation is complete" {0} '.format(outfile)
+        self.assertTrue(os.system(cmd) == 0, "Output file {0} does not contain a simulation complete message".format(outfile))
+        return outfile
+
+###
+
+    def _assert_same_output(self, reffile, outfile, ignore):
+        cmd = "diff -b <(grep -v {2} {0}) <(grep -v {2} {1}) > /dev/null".format(reffile, outfile, ignore)
+        self.assertTrue(os.system("bash -c '{0}'".format(cmd)) == 0, "Output file {0} does not match {1}".format(outfile, reffile))
+
+    def _read_accumulator_stats(self, outfile):
+        # Returns {statistic.subid : {field : value}} for the Opal accumulator statistics in outfile
+        stats = {}
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                if not line.strip().startswith("opal."):
+                    continue
+                stat = line.split(":")[0].strip().split(".", 1)[1]
+                fields = dict((f.split("=")[0].strip().split(".")[0], int(f.split("=")[1])) for f in line.split(":")[2].split(";") if "=" in f)
+                stats[stat] = fields
+        return stats
@@ -26,10 +26,6 @@ using namespace SST;
 
 
 
-// This is and ID used to merely identify page walking requests
-long long int mmu_id=0;
-
-
 int max(int a, int b)
 {
 
@@ -96,6 +92,12 @@ PageTableWalker::PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker *
 
 	upper_link_latency = ((uint32_t) params.find<uint32_t>("upper_link_L"+LEVEL, 0));
 
+	slots = nullptr;
+
+	service_back = nullptr;
+
+	pending_misses = 0;
+
 
 	char* subID = (char*) malloc(sizeof(char) * 32);
 	sprintf(subID, "Core%d_PTWC", tlb_id);
@@ -199,13 +201,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
 			//if((*CR3) == -1)
 			if(!(*cr3_init))
 				fault_level = 4;
-			else if((*PGD).find(temp_ptr->getAddress()/page_size[3]) == (*PGD).end())
+			else if(!PGD->contains(temp_ptr->getAddress()/page_size[3]))
 				fault_level = 3;
-			else if((*PUD).find(temp_ptr->getAddress()/page_size[2]) == (*PUD).end())
+			else if(!PUD->contains(temp_ptr->getAddress()/page_size[2]))
 				fault_level = 2;
-			else if((*PMD).find(temp_ptr->getAddress()/page_size[1]) == (*PMD).end())
+			else if(!PMD->contains(temp_ptr->getAddress()/page_size[1]))
 				fault_level = 1;
-			else if((*PTE).find(temp_ptr->getAddress()/page_size[0]) == (*PTE).end())
+			else if(!PTE->contains(temp_ptr->getAddress()/page_size[0]))
 				fault_level = 0;
 			else
 				output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
@@ -214,10 +216,10 @@ void PageTableWalker::handleEvent( SST::Event* e )
 		{
 			uint64_t offset = (uint64_t)512*512*512*512;
 			if(!(*cr3_init)) fault_level = 4;
-			else if((*PGD).find((temp_ptr->getAddress()/page_size[3])%512) == (*PGD).end()) fault_level = 3;
-			else if((*PUD).find((temp_ptr->getAddress()/page_size[2])%(512*512)) == (*PUD).end()) fault_level = 2;
-			else if((*PMD).find((temp_ptr->getAddress()/page_size[1])%(512*512*512)) == (*PMD).end()) fault_level = 1;
-			else if((*PTE).find((temp_ptr->getAddress()/page_size[0])%offset) == (*PTE).end()) fault_level = 0;
+			else if(!PGD->contains((temp_ptr->getAddress()/page_size[3])%512)) fault_level = 3;
+			else if(!PUD->contains((temp_ptr->getAddress()/page_size[2])%(512*512))) fault_level = 2;
+			else if(!PMD->contains((temp_ptr->getAddress()/page_size[1])%(512*512*512))) fault_level = 1;
+			else if(!PTE->contains((temp_ptr->getAddress()/page_size[0])%offset)) fault_level = 0;
 	 		else output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
 		}
 
@@ -252,7 +254,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 				(*PGD)[stall_addr/page_size[3]] = temp_ptr->getPaddress();
 			else
 			{
-				if((*PGD).find((stall_addr/page_size[3])%512) != (*PGD).end())
+				if(PGD->contains((stall_addr/page_size[3])%512))
 					output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PGD!!\n");
 				(*PGD)[(stall_addr/page_size[3])%512] = temp_ptr->getPaddress();
 				(*PENDING_PAGE_FAULTS_PGD).erase((stall_addr/page_size[3])%(512));
@@ -267,7 +269,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 				(*PUD)[stall_addr/page_size[2]] = temp_ptr->getPaddress();
 			else
 			{
-				if((*PUD).find((stall_addr/page_size[2])%(512*512)) != (*PUD).end())
+				if(PUD->contains((stall_addr/page_size[2])%(512*512)))
 					output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PUD!!\n");
 				(*PUD)[(stall_addr/page_size[2])%(512*512)] = temp_ptr->getPaddress();
 				(*PENDING_PAGE_FAULTS_PUD).erase((stall_addr/page_size[2])%(512*512));
@@ -293,7 +295,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 			else
 			{
 				uint64_t offset = 512*512*512;
-				if((*PMD).find((stall_addr/page_size[1])%offset) != (*PMD).end())
+				if(PMD->contains((stall_addr/page_size[1])%offset))
 					output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PMD!!\n");
 				(*PMD)[(stall_addr/page_size[1])%offset] = temp_ptr->getPaddress();
 				(*PENDING_PAGE_FAULTS_PMD).erase((stall_addr/page_size[1])%offset);
@@ -318,7 +320,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 			else
 			{
 				uint64_t offset = (uint64_t)512*512*512*512;
-				if((*PTE).find((stall_addr/page_size[0])%offset) != (*PTE).end())
+				if(PTE->contains((stall_addr/page_size[0])%offset))
 					output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PTE!!\n");
 				(*PTE)[(stall_addr/page_size[0])%offset] = temp_ptr->getPaddress();
 			}
@@ -375,27 +377,31 @@ void PageTableWalker::recvResp(SST::Event * event)
 	MemEvent * ev = static_cast<MemEvent*>(event);
 
 
-	long long int pw_id;
+	std::unordered_map<id_type, uint32_t, EventIdHash>::iterator req;
 	if(!self_connected)
-		pw_id = MEM_REQ[ev->getResponseToID()];
+		req = MEM_REQ.find(ev->getResponseToID());
 	else
-		pw_id = MEM_REQ[ev->getID()];
+		req = MEM_REQ.find(ev->getID());
+
+	if(req == MEM_REQ.end())
+		output->fatal(CALL_INFO, -1, "PTW received a response that does not match any page walk request\n");
 
-	insert_way(WID_Add[pw_id], find_victim_way(WID_Add[pw_id], WSR_COUNT[pw_id]), WSR_COUNT[pw_id]);
+	uint32_t id = req->second;
+	TranslationSlot & slot = (*slots)[id];
 
-	Address_t addr = WID_Add[pw_id];
+	insert_way(slot.vaddr, find_victim_way(slot.vaddr, slot.walk_level), slot.walk_level);
 
-	WSR_READY[pw_id]=true;
+	Address_t addr = slot.vaddr;
 
 	// Avoiding memory leak by deleting the newly generated dummy requests
-	MEM_REQ.erase(ev->getID());
+	MEM_REQ.erase(req);
 	delete ev;
 
-	if(WSR_COUNT[pw_id]==0)
+	if(slot.walk_level==0)
 	{
-		ready_by[WID_EV[pw_id]] =  currTime + latency + 2*upper_link_latency;
+		slot.size = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
-		ready_by_size[WID_EV[pw_id]] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+		ready_by.push(id, currTime + latency + 2*upper_link_latency);
 	}
 	else
 	{
@@ -409,28 +415,28 @@ void PageTableWalker::recvResp(SST::Event * event)
 			if(!ptw_confined)
 			{
 				Address_t page_table_start = 0;
-				if(WSR_COUNT[pw_id]==4)
+				if(slot.walk_level==4)
 					page_table_start = (*PGD)[addr/page_size[3]];
-				else if(WSR_COUNT[pw_id]==3)
+				else if(slot.walk_level==3)
 					page_table_start = (*PUD) [addr/page_size[2]];
-				else if(WSR_COUNT[pw_id]==2)
+				else if(slot.walk_level==2)
 					page_table_start = (*PMD) [addr/page_size[1]];
-				else if (WSR_COUNT[pw_id] == 1)
+				else if (slot.walk_level == 1)
 					page_table_start = (*PTE) [addr/page_size[0]];
 
-				dummy_add = page_table_start + (addr/page_size[WSR_COUNT[pw_id]-1])%512;
+				dummy_add = page_table_start + (addr/page_size[slot.walk_level-1])%512;
 			}
 			else
 			{
-				if(WSR_COUNT[pw_id]==4) {
+				if(slot.walk_level==4) {
 					dummy_add = (*CR3) + ((addr/page_size[3])%512)*8;
 				}
-				else if(WSR_COUNT[pw_id]==3) {
+				else if(slot.walk_level==3) {
 					dummy_add = (*PGD)[(addr/page_size[3])%512] + ((addr/page_size[2])%512)*8;
 				}
-				else if(WSR_COUNT[pw_id]==2) {
+				else if(slot.walk_level==2) {
 					dummy_add = (*PUD)[(addr/page_size[2])%(512*512)] + ((addr/page_size[1])%512)*8;}
-				else if(WSR_COUNT[pw_id]==1) {
+				else if(slot.walk_level==1) {
 					uint64_t offset = (uint64_t)512*512*512;
 					dummy_add = (*PMD)[(addr/page_size[1])%offset] + ((addr/page_size[0])%512)*8;
 				}
@@ -442,8 +448,8 @@ void PageTableWalker::recvResp(SST::Event * event)
 		MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
 		e->setVirtualAddress(addr);
 
-		WSR_COUNT[pw_id]--;
-		MEM_REQ[e->getID()]=pw_id;
+		slot.walk_level--;
+		MEM_REQ[e->getID()]=id;
 		to_mem->send(e);
 
 
@@ -466,7 +472,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 		if(!ptw_confined)
 		{
 			//std::cout<< getName().c_str() << " Core: " << coreId << " stalled with stall address: " << stall_addr << std::endl;
-			if((*PENDING_PAGE_FAULTS).find(stall_addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
+			if(!PENDING_PAGE_FAULTS->contains(stall_addr/page_size[0])) {
 				stall = false;
 				*hold = 0;
 			}
@@ -478,10 +484,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 			switch(stall_at_levels) {
 			case 4:
 			{
-				if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end() &&
-					(*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-					(*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-					(*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+				if(!PENDING_PAGE_FAULTS_PGD->contains((stall_addr/page_size[3])%(512)) &&
+					!PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512)) &&
+					!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+					!PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
 				{
 					release = 1;
 				}
@@ -490,9 +496,9 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 				break;
 			case 3:
 			{
-				if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-					(*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-					(*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+				if(!PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512)) &&
+					!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+					!PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
 				{
 					release = 1;
 				}
@@ -500,8 +506,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 				break;
 			case 2:
 			{
-				if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-					(*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+				if(!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+					!PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
 				{
 					release = 1;
 				}
@@ -509,10 +515,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 				break;
 			case 1:
 			{
-				if(stall_at_PGD) {if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) release = 1;}
-				else if(stall_at_PUD) {if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) release = 1;}
-				else if(stall_at_PMD) {if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) release = 1;}
-				else if(stall_at_PTE) {if((*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) release = 1;}
+				if(stall_at_PGD) {if(!PENDING_PAGE_FAULTS_PGD->contains((stall_addr/page_size[3])%(512))) release = 1;}
+				else if(stall_at_PUD) {if(!PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512))) release = 1;}
+				else if(stall_at_PMD) {if(!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512))) release = 1;}
+				else if(stall_at_PTE) {if(!PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset))) release = 1;}
 				else output->fatal(CALL_INFO, -1, "MMU: PTW DANGER!!.. stall at level not recognized..\n");
 			}
 				break;
@@ -531,7 +537,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 
 	// The actual dipatching process... here we take a request and place it in the right queue based on being miss or hit and the number of pending misses
-	std::vector<MemHierarchy::MemEventBase *>::iterator st_1,en_1;
+	std::vector<uint32_t>::iterator st_1,en_1;
 	st_1 = not_serviced.begin();
 	en_1 = not_serviced.end();
 
@@ -544,8 +550,9 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 		if(dispatched > max_width)
 			break;
 
-                MemHierarchy::MemEventBase* ev = *st_1;
-		Address_t addr = ((MemEvent*) ev)->getVirtualAddress();
+		uint32_t id = *st_1;
+		TranslationSlot & slot = (*slots)[id];
+		Address_t addr = slot.vaddr;
 
 		// A sneak-peak if the access is going to cause a page fault
 		if(emulate_faults==1)
@@ -554,13 +561,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 			bool fault = true;
 			if(!ptw_confined)
 			{
-				if((*MAPPED_PAGE_SIZE4KB).find(addr/page_size[0])!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find(addr/page_size[1])!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find(addr/page_size[2])!=(*MAPPED_PAGE_SIZE1GB).end())
+				if(MAPPED_PAGE_SIZE4KB->contains(addr/page_size[0]) || MAPPED_PAGE_SIZE2MB->contains(addr/page_size[1]) || MAPPED_PAGE_SIZE1GB->contains(addr/page_size[2]))
 					fault = false;
 
 				if(fault)
 				{
 					stall_addr = addr;
-					if((*PENDING_PAGE_FAULTS).find(addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
+					if(!PENDING_PAGE_FAULTS->contains(addr/page_size[0])) {
 						(*PENDING_PAGE_FAULTS)[addr/page_size[0]] = 0;
 						SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
 						//std::cout<< getName().c_str() << " Core id: " << coreId << " Fault at address "<<addr<<std::endl;
@@ -578,20 +585,20 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 			else
 			{
 				uint64_t offset = (uint64_t)512*512*512*512;
-				if((*MAPPED_PAGE_SIZE4KB).find((addr/page_size[0])%offset)!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find((addr/page_size[1])%(512*512*512))!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find((addr/page_size[2])%(512*512))!=(*MAPPED_PAGE_SIZE1GB).end())
+				if(MAPPED_PAGE_SIZE4KB->contains((addr/page_size[0])%offset) || MAPPED_PAGE_SIZE2MB->contains((addr/page_size[1])%(512*512*512)) || MAPPED_PAGE_SIZE1GB->contains((addr/page_size[2])%(512*512)))
  					fault = false;
 
 	 			if(fault)
 	 			{
 					stall_addr = addr;
 					if(to_mem!=NULL) {
-					if((*PGD).find((addr/page_size[3])%512) == (*PGD).end()) {
+					if(!PGD->contains((addr/page_size[3])%512)) {
 						stall_at_levels = 1;
 						stall_at_PGD = 1;
 						stall_at_PUD = 0;
 						stall_at_PMD = 0;
 						stall_at_PTE = 0;
-						if((*PENDING_PAGE_FAULTS_PGD).find((addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) {
+						if(!PENDING_PAGE_FAULTS_PGD->contains((addr/page_size[3])%(512))) {
 							(*PENDING_PAGE_FAULTS_PGD)[(addr/page_size[3])%512] = 0;
 							(*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
 							(*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
@@ -605,13 +612,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 							return false;
 						}
 					}
-					else if((*PUD).find((addr/page_size[2])%(512*512)) == (*PUD).end()) {
+					else if(!PUD->contains((addr/page_size[2])%(512*512))) {
 						stall_at_levels = 1;
 						stall_at_PGD = 0;
 						stall_at_PUD = 1;
 						stall_at_PMD = 0;
 						stall_at_PTE = 0;
-						if((*PENDING_PAGE_FAULTS_PUD).find((addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) {
+						if(!PENDING_PAGE_FAULTS_PUD->contains((addr/page_size[2])%(512*512))) {
 							(*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
 							(*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
 							(*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
@@ -624,13 +631,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 							return false;
 						}
 					}
-					else if((*PMD).find((addr/page_size[1])%(512*512*512)) == (*PMD).end()) {
+					else if(!PMD->contains((addr/page_size[1])%(512*512*512))) {
 						stall_at_levels = 1;
 						stall_at_PGD = 0;
 						stall_at_PUD = 0;
 						stall_at_PMD = 1;
 						stall_at_PTE = 0;
-						if((*PENDING_PAGE_FAULTS_PMD).find((addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) {
+						if(!PENDING_PAGE_FAULTS_PMD->contains((addr/page_size[1])%(512*512*512))) {
 							(*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
 							(*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
 							stall_at_levels += 1;
@@ -642,13 +649,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 							return false;
 						}
 					}
-					else if((*PTE).find((addr/page_size[0])%(offset)) == (*PTE).end()) {
+					else if(!PTE->contains((addr/page_size[0])%(offset))) {
 						stall_at_levels = 1;
 						stall_at_PGD = 0;
 						stall_at_PUD = 0;
 						stall_at_PMD = 0;
 						stall_at_PTE = 1;
-						if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
+						if(!PENDING_PAGE_FAULTS_PTE->contains((addr/page_size[0])%(offset))) {
 							(*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
 							SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
 							tse->setResp(addr,0,4096);
@@ -668,7 +675,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 						stall_at_PUD = 0;
 						stall_at_PMD = 0;
 						stall_at_PTE = 1;
-						if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
+						if(!PENDING_PAGE_FAULTS_PTE->contains((addr/page_size[0])%(offset))) {
 							(*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
 							SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
 							tse->setResp(addr,0,4096);
@@ -704,13 +711,14 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 			update_lru(addr, hit_id);
 			hits++;
 			statPageTableWalkerHits->addData(1);
-			if(parallel_mode)
-				ready_by[ev] = x;
-			else
-				ready_by[ev] = x + latency;
 
 			// Tracking the hit request size
-			ready_by_size[ev] = os_page_size; //page_size[hit_id]/1024;
+			slot.size = os_page_size; //page_size[hit_id]/1024;
+
+			if(parallel_mode)
+				ready_by.push(id, x);
+			else
+				ready_by.push(id, x + latency);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -726,16 +734,15 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 				k = max(k-2, 1);
 
 
-			if((int) pending_misses.size() < (int) max_outstanding)
+			if(pending_misses < max_outstanding)
 			{
 				statPageTableWalkerMisses->addData(1);
 				misses++;
-				pending_misses.push_back(*st_1);
+				slot.pending |= 1; // The page table walker is always bit 0
+				pending_misses++;
 				if(to_mem!=nullptr)
 				{
 
-					WID_EV[++mmu_id] = (*st_1);
-
 					Address_t dummy_add = rand()%10000000;
 
 					// Use actual page table base to start the walking if we have real page tables
@@ -769,14 +776,11 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 
 
-					WSR_COUNT[mmu_id] = k-1;
-					//		WID_EV[mmu_id] = e;
-					WID_Add[mmu_id] = addr;
+					slot.walk_level = k-1;
 					e->setVirtualAddress(addr);
-					WSR_READY[mmu_id] = false;
 
 					// Add it to the tracking structure
-					MEM_REQ[e->getID()]=mmu_id;
+					MEM_REQ[e->getID()]=id;
 
 					//					std::cout<<"Sending a new request with address "<<std::hex<<dummy_add<<std::endl;
 					// Actually send the event to the cache
@@ -792,9 +796,9 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 
 
-					ready_by[ev] = x + latency + 2*upper_link_latency + page_walk_latency;  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
+					slot.size = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
-					ready_by_size[ev] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+					ready_by.push(id, x + latency + 2*upper_link_latency + page_walk_latency);  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
 
 					st_1 = not_serviced.erase(st_1);
 				}
@@ -809,89 +813,57 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 	}
 
 
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare>::iterator st, en;
-	st = ready_by.begin();
-	en = ready_by.end();
-
-	while(st!=en)
+	// We check the list of being serviced request to see if any has finished by this cycle
+	ready_by.popReady(x, ready);
+	for(uint32_t id : ready)
 	{
+		TranslationSlot & slot = (*slots)[id];
 
-		bool deleted=false;
-		if(st->second <= x)
-		{
-
-
-			Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
+		Address_t addr = slot.vaddr;
 
-			// Double checking that we actually still don't have it inserted
-			//std::cout<<"The address is"<<addr<<std::endl;
-			if(!check_hit(addr, 0))
-			{
-				insert_way(addr, find_victim_way(addr, 0), 0);
-				update_lru(addr, 0);
-			}
-			else
-				update_lru(addr, 0);
+		// Double checking that we actually still don't have it inserted
+		//std::cout<<"The address is"<<addr<<std::endl;
+		if(!check_hit(addr, 0))
+		{
+			insert_way(addr, find_victim_way(addr, 0), 0);
+			update_lru(addr, 0);
+		}
+		else
+			update_lru(addr, 0);
 
 
-			service_back->push_back(st->first);
+		// The size of the translation travels back with the slot
+		service_back->push_back(id);
 
 
-			if(emulate_faults)
+		if(emulate_faults)
+		{
+			if(!ptw_confined)
 			{
-				if(!ptw_confined)
+				if(!PTE->contains(addr/4096))
 				{
-					if((*PTE).find(addr/4096)==(*PTE).end())
-                	{
-						std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
-						std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
-                    }
-                }
-                else
-                {
-                	uint64_t offset = (uint64_t)512*512*512*512;
-					if((*PTE).find((addr/4096)%offset)==(*PTE).end())
-                    {
- 						std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
- 						std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
-					}
-                }
-            }
-
-			(*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-			ready_by_size.erase(st->first);
-
-
-
-
-			deleted = true;
-
-
-			// Deleting it from pending requests
-			std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
-			st2 = pending_misses.begin();
-			en2 = pending_misses.end();
-
-
-			while(st2!=en2)
+					std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
+					std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
+				}
+			}
+			else
 			{
-				if(*st2 == st->first)
+				uint64_t offset = (uint64_t)512*512*512*512;
+				if(!PTE->contains((addr/4096)%offset))
 				{
-					pending_misses.erase(st2);
-					break;
+					std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
+					std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
 				}
-				st2++;
 			}
+		}
 
-			ready_by.erase(st);
 
+		// Deleting it from pending requests
+		if(slot.pending & 1)
+		{
+			slot.pending &= ~1u;
+			pending_misses--;
 		}
-		if(deleted)
-			st=ready_by.begin();
-		else
-			st++;
 
 	}
 
@@ -912,7 +884,7 @@ void PageTableWalker::initaitePageMigration(Address_t vaddress, Address_t paddre
 	//std::cout << getName().c_str() << " Core ID: " << coreId << " sending TLB shootdown with address: " << std::hex << vaddress << " new paddress: " << paddress << std::endl;
 	stall_addr = vaddress;
 	/*
-	if((*PENDING_SHOOTDOWN_EVENTS).find(vaddress/page_size[0]) == (*PENDING_SHOOTDOWN_EVENTS).end()) {
+	if(!PENDING_SHOOTDOWN_EVENTS->contains(vaddress/page_size[0])) {
 		(*PENDING_SHOOTDOWN_EVENTS)[vaddress/page_size[0]] = 0;
 		(*PENDING_PAGE_FAULTS)[vaddress/page_size[0]] = 0;		//add to pending page faults list
 		(*MAPPED_PAGE_SIZE4KB).erase(vaddress/page_size[0]); 	//unmap the page
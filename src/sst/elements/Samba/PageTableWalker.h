@@ -30,8 +30,12 @@
 #include <sst/core/sst_types.h>
 
 #include "utils.h"
+#include "RadixTable.h"
+#include "SlotTable.h"
 #include "PageFaultHandler.h"
 
+#include <unordered_map>
+
 // This file defines the page table walker and
 
 typedef std::pair<uint64_t, int> id_type;
@@ -91,29 +95,29 @@ namespace SST { namespace SambaComponent{
 		int *cr3_init;
 
 		// Holds the PGD physical pointers, the key is the 9 bits 39-47, i.e., VA/(4096*512*512*512)
-		std::map<Address_t, Address_t> * PGD;
+		PageTable * PGD;
 
 		// Holds the PUD physical pointers, the key is the 9 bits 30-38, i.e., VA/(4096*512*512)
-		std::map<Address_t, Address_t> * PUD;
+		PageTable * PUD;
 
 		// Holds the PMD physical pointers, the key is the 9 bits 21-29, i.e., VA/(4096*512)
-		std::map<Address_t, Address_t> * PMD;
+		PageTable * PMD;
 
 		// Holds the PTE physical pointers, the key is the 9 bits 12-20, i.e., VA/(4096)
-		std::map<Address_t, Address_t> * PTE; // This should give you the exact physical address of the page
+		PageTable * PTE; // This should give you the exact physical address of the page
 
 
 		// The structures below are used to quickly check if the page is mapped or not
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+		PageStatus * MAPPED_PAGE_SIZE4KB;
+		PageStatus * MAPPED_PAGE_SIZE2MB;
+		PageStatus * MAPPED_PAGE_SIZE1GB;
 
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
-		std::map<Address_t,int> *PENDING_SHOOTDOWN_EVENTS;
+		PageStatus *PENDING_PAGE_FAULTS;
+		PageStatus *PENDING_PAGE_FAULTS_PGD;
+		PageStatus *PENDING_PAGE_FAULTS_PUD;
+		PageStatus *PENDING_PAGE_FAULTS_PMD;
+		PageStatus *PENDING_PAGE_FAULTS_PTE;
+		PageStatus *PENDING_SHOOTDOWN_EVENTS;
 
 
 
@@ -158,29 +162,23 @@ namespace SST { namespace SambaComponent{
 
 		int parallel_mode; // very specific case for L1 PageTableWalker in case of overlapping with accessing the cache
 
-		std::vector<MemHierarchy::MemEventBase *> * service_back; // This is used to pass ready requests back to the previous level
-
-		std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * service_back_size; // This is used to pass the size of the  requests back to the previous level
-
-		std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare > ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
+		SlotTable * slots; // The per-request slot table shared by this core's TLB hierarchy, requests are passed around by slot index
 
-		std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // this one is used to keep track of requests' sizes inside this structure
+		std::vector<uint32_t> * service_back; // This is used to pass ready requests back to the previous level, the translation size is carried in the slot
 
-		std::vector<MemHierarchy::MemEventBase *> pushed_back; // This is what we got returned from other structures
+		ReadyQueue ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
 
-		std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> pushed_back_size; // This is the sizes of the translations we got returned from other structures
+		std::vector<uint32_t> ready; // Scratch list of the requests that became ready on this cycle
 
-		std::vector<MemHierarchy::MemEventBase *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
+		int pending_misses; // This the number of pending misses, only decremented when the walk completes
 
-		std::vector<MemHierarchy::MemEventBase *> not_serviced; // This holds those accesses not serviced yet
+		std::vector<uint32_t> not_serviced; // This holds those accesses not serviced yet
 
 
 		int self_connected; // his parameter indidicates if the PTW is self-connected or actually connected to the memory hierarchy
 
 		int page_walk_latency; // this is really nothing than the page walk latency in case of having no walkers
 
-		long long int mmu_id=0;
-
 		SST::Cycle_t currTime;
 
 		uint64_t line_size; // For setting base address of MemEvents
@@ -192,9 +190,9 @@ namespace SST { namespace SambaComponent{
 		PageTableWalker(ComponentId_t id, int page_size, int assoc, PageTableWalker * next_level, int size);
 		PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker * Next_level,int level, SST::Params& params);
 
-		void setPageTablePointers( Address_t * cr3, std::map<Address_t, Address_t> * pgd,  std::map<Address_t, Address_t> * pud,  std::map<Address_t, Address_t> * pmd, std::map<Address_t, Address_t> * pte,
-				std::map<Address_t,int> * gb,  std::map<Address_t,int> * mb,  std::map<Address_t,int> * kb, std::map<Address_t,int> * pr, int *cr3I, std::map<Address_t,int> *pf_pgd,  std::map<Address_t,int> *pf_pud,
-				std::map<Address_t,int> *pf_pmd, std::map<Address_t,int> * pf_pte)
+		void setPageTablePointers( Address_t * cr3, PageTable * pgd,  PageTable * pud,  PageTable * pmd, PageTable * pte,
+				PageStatus * gb,  PageStatus * mb,  PageStatus * kb, PageStatus * pr, int *cr3I, PageStatus *pf_pgd,  PageStatus *pf_pud,
+				PageStatus *pf_pmd, PageStatus * pf_pte)
 		{
 			CR3 = cr3;
 			PGD = pgd;
@@ -245,7 +243,9 @@ namespace SST { namespace SambaComponent{
 		// To insert the translaiton
 		int find_victim_way(Address_t vadd, int struct_id);
 
-		void setServiceBack( std::vector<MemHierarchy::MemEventBase *> * x) { service_back = x;}
+		void setServiceBack( std::vector<uint32_t> * x) { service_back = x;}
+
+		void setSlotTable( SlotTable * x) { slots = x; ready_by.setSlotTable(x); }
 
 		void setHold(int * tmp) { hold = tmp; }
 
@@ -265,19 +265,8 @@ namespace SST { namespace SambaComponent{
 
 		bool recvPageFaultResp(PageFaultHandler::PageFaultHandlerPacket pkt);
 
-		void setServiceBackSize( std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * x) { service_back_size = x;}
-
-		std::vector<MemHierarchy::MemEventBase *> * getPushedBack(){return & pushed_back;}
-
-		std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * getPushedBackSize(){return & pushed_back_size;}
-
-		std::map<long long int, int> WSR_COUNT;
-		std::map<long long int, bool> WSR_READY;
-
-		std::map<long long int, Address_t> WID_Add;
-
-		std::map<long long int, MemHierarchy::MemEventBase*> WID_EV;
-		std::map<id_type, long long int> MEM_REQ;
+		// Maps the ID of each outstanding page table memory access to the slot of the request being walked
+		std::unordered_map<id_type, uint32_t, EventIdHash> MEM_REQ;
 
 		void update_lru(Address_t vaddr, int struct_id);
 
@@ -294,7 +283,7 @@ namespace SST { namespace SambaComponent{
 		void insert_way(Address_t vaddr, int way, int struct_id);
 
 		// This one is to push a request to this structure
-		void push_request(MemHierarchy::MemEventBase * x) {not_serviced.push_back(x);}
+		void push_request(uint32_t x) {not_serviced.push_back(x);}
 
 		bool tick(SST::Cycle_t x);
 
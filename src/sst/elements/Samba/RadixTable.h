@@ -0,0 +1,180 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef _H_SST_SAMBA_RADIX_TABLE
+#define _H_SST_SAMBA_RADIX_TABLE
+
+#include <sst/core/sst_types.h>
+#include <cstring>
+
+// This file defines a radix tree keyed by page number, used to hold the page table levels (PGD/PUD/PMD/PTE) and the
+// mapped/pending page bookkeeping. Each inner level of the tree consumes 9 bits of the key, mirroring the x86-64 page table layout,
+// so a lookup touches at most one node per 9 bits of key instead of walking a balanced tree of every mapped page.
+// Leaves only hold 64 keys (one presence word) so that sparse keys, such as the pages touched by GUPS, do not each pin a 4KB leaf
+
+namespace SST { namespace SambaComponent {
+
+	template<typename T>
+	class RadixTable
+	{
+		static const int bits = 9;
+		static const uint64_t fanout = 1 << bits;
+		static const uint64_t mask = fanout - 1;
+
+		static const int leaf_bits = 6;
+		static const uint64_t leaf_fanout = 1 << leaf_bits;
+		static const uint64_t leaf_mask = leaf_fanout - 1;
+
+		static const int max_height = 1 + (64 - leaf_bits + bits - 1) / bits;
+
+		struct Node
+		{
+			void * child[fanout];
+			Node() { std::memset(child, 0, sizeof(child)); }
+		};
+
+		struct Leaf
+		{
+			T value[leaf_fanout];
+			uint64_t present;
+			Leaf() : value(), present(0) {}
+		};
+
+		void * root; // A Leaf when height is 1, otherwise a Node
+
+		int height; // Number of tree levels, including the leaf level
+
+		size_t count; // Number of keys present
+
+		// Returns true if the key can be stored without growing the tree
+		bool fits(uint64_t key) const
+		{
+			return height >= max_height || (key >> shift(height + 1)) == 0;
+		}
+
+		// Position of the key bits that index a node at the given level (the leaf level is 1)
+		static int shift(int level)
+		{
+			return leaf_bits + bits * (level - 2);
+		}
+
+		// Adds a level above the current root until the key fits
+		void grow(uint64_t key)
+		{
+			while (!fits(key))
+			{
+				Node * node = new Node();
+				node->child[0] = root;
+				root = node;
+				height++;
+			}
+		}
+
+		Leaf * findLeaf(uint64_t key) const
+		{
+			if (root == nullptr || !fits(key))
+				return nullptr;
+
+			void * curr = root;
+			for (int level = height; level > 1 && curr != nullptr; level--)
+				curr = static_cast<Node*>(curr)->child[(key >> shift(level)) & mask];
+
+			return static_cast<Leaf*>(curr);
+		}
+
+		void destroy(void * curr, int level)
+		{
+			if (curr == nullptr)
+				return;
+
+			if (level == 1)
+			{
+				delete static_cast<Leaf*>(curr);
+				return;
+			}
+
+			Node * node = static_cast<Node*>(curr);
+			for (uint64_t i = 0; i < fanout; i++)
+				destroy(node->child[i], level - 1);
+			delete node;
+		}
+
+		RadixTable(const RadixTable&); // do not implement
+		void operator=(const RadixTable&); // do not implement
+
+		public:
+
+		RadixTable() : root(nullptr), height(1), count(0) {}
+
+		~RadixTable() { destroy(root, height); }
+
+		// Checks if a key is present
+		bool contains(uint64_t key) const
+		{
+			Leaf * leaf = findLeaf(key);
+			return leaf != nullptr && (leaf->present & (1ULL << (key & leaf_mask)));
+		}
+
+		// Returns the entry for key, inserting a value-initialized one if it is not present (same semantics as std::map)
+		T& operator[](uint64_t key)
+		{
+			grow(key);
+
+			if (root == nullptr)
+				root = (height == 1) ? static_cast<void*>(new Leaf()) : static_cast<void*>(new Node());
+
+			void * curr = root;
+			for (int level = height; level > 1; level--)
+			{
+				void *& next = static_cast<Node*>(curr)->child[(key >> shift(level)) & mask];
+				if (next == nullptr)
+					next = (level == 2) ? static_cast<void*>(new Leaf()) : static_cast<void*>(new Node());
+				curr = next;
+			}
+
+			Leaf * leaf = static_cast<Leaf*>(curr);
+			uint64_t idx = key & leaf_mask;
+			if (!(leaf->present & (1ULL << idx)))
+			{
+				leaf->present |= (1ULL << idx);
+				leaf->value[idx] = T();
+				count++;
+			}
+			return leaf->value[idx];
+		}
+
+		// Removes a key, node storage is kept for reuse since page tables rarely shrink
+		void erase(uint64_t key)
+		{
+			Leaf * leaf = findLeaf(key);
+			uint64_t bit = 1ULL << (key & leaf_mask);
+			if (leaf != nullptr && (leaf->present & bit))
+			{
+				leaf->present &= ~bit;
+				count--;
+			}
+		}
+
+		size_t size() const { return count; }
+
+		bool empty() const { return count == 0; }
+	};
+
+	// Page table levels map a virtual page number at that level to the physical address of the next level (or the page itself)
+	typedef RadixTable<uint64_t> PageTable;
+
+	// Used to quickly check if a page is mapped or has a fault in flight
+	typedef RadixTable<int> PageStatus;
+
+}}
+
+#endif
@@ -38,6 +38,7 @@
 #include "TLBhierarchy.h"
 #include "PageTableWalker.h"
 #include "PageFaultHandler.h"
+#include "RadixTable.h"
 #include <sst/elements/memHierarchy/memEventBase.h>
 
 //#include "arielcore.h"
@@ -110,21 +111,21 @@ namespace SST {
 				// Note, the application might be multi-threaded, however, all threads will share the sambe page table components below
 
 				Address_t CR3;
-				std::map<Address_t, Address_t> PGD;
-				std::map<Address_t, Address_t> PUD;
-				std::map<Address_t, Address_t> PMD;
-				std::map<Address_t, Address_t> PTE;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE4KB;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE2MB;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE1GB;
-
-				std::map<Address_t,int> PENDING_PAGE_FAULTS;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PGD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PUD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PMD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PTE;
+				PageTable PGD;
+				PageTable PUD;
+				PageTable PMD;
+				PageTable PTE;
+				PageStatus  MAPPED_PAGE_SIZE4KB;
+				PageStatus  MAPPED_PAGE_SIZE2MB;
+				PageStatus  MAPPED_PAGE_SIZE1GB;
+
+				PageStatus PENDING_PAGE_FAULTS;
+                PageStatus PENDING_PAGE_FAULTS_PGD;
+                PageStatus PENDING_PAGE_FAULTS_PUD;
+                PageStatus PENDING_PAGE_FAULTS_PMD;
+                PageStatus PENDING_PAGE_FAULTS_PTE;
                 int cr3I;
-				std::map<Address_t,int> PENDING_SHOOTDOWN_EVENTS;
+				PageStatus PENDING_SHOOTDOWN_EVENTS;
 
 
 			private:
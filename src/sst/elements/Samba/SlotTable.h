@@ -0,0 +1,144 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef _H_SST_SAMBA_SLOT_TABLE
+#define _H_SST_SAMBA_SLOT_TABLE
+
+#include <sst/core/sst_types.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "utils.h"
+
+// This file defines the per-request slot table shared by a core's TLB units and page table walker.
+// A request is given a slot when it enters the TLB hierarchy and keeps it until it is sent on to the cache, so the units
+// pass slot indices between each other and keep all of a request's bookkeeping (arrival time, ready time, translation size,
+// outstanding misses, page walk progress) in one place rather than in per-unit maps keyed by the event
+
+namespace SST { namespace SambaComponent {
+
+	struct TranslationSlot
+	{
+		MemHierarchy::MemEventBase * ev; // The request being translated
+
+		uint64_t vaddr; // The virtual address of the request
+
+		SST::Cycle_t arrival; // The cycle the request entered the TLB hierarchy
+
+		SST::Cycle_t ready_by; // The cycle at which the unit currently holding the request can pass it back
+
+		long long int size; // The size (in KB) of the translation being passed back
+
+		uint32_t pending; // One bit per unit (PTW is bit 0, L1 TLB is bit 1, ...) that holds this request as an outstanding miss
+
+		int walk_level; // The number of page table levels the page table walker still has to fetch
+	};
+
+	class SlotTable
+	{
+		std::vector<TranslationSlot> slots;
+
+		std::vector<uint32_t> free_slots;
+
+		public:
+
+		// Allocates a slot for a new request
+		uint32_t allocate(MemHierarchy::MemEventBase * ev, SST::Cycle_t arrival)
+		{
+			uint32_t id;
+			if (free_slots.empty())
+			{
+				id = slots.size();
+				slots.push_back(TranslationSlot());
+			}
+			else
+			{
+				id = free_slots.back();
+				free_slots.pop_back();
+			}
+
+			TranslationSlot & slot = slots[id];
+			slot.ev = ev;
+			slot.vaddr = static_cast<MemHierarchy::MemEvent*>(ev)->getVirtualAddress();
+			slot.arrival = arrival;
+			slot.ready_by = 0;
+			slot.size = 0;
+			slot.pending = 0;
+			slot.walk_level = 0;
+			return id;
+		}
+
+		// Returns a slot to the free list once the request leaves the TLB hierarchy
+		void release(uint32_t id)
+		{
+			slots[id].ev = nullptr;
+			free_slots.push_back(id);
+		}
+
+		TranslationSlot & operator[](uint32_t id) { return slots[id]; }
+
+		size_t inUse() const { return slots.size() - free_slots.size(); }
+	};
+
+
+	// This holds the requests a unit is delaying to account for its latency, ordered by the cycle they become ready
+	class ReadyQueue
+	{
+		typedef std::pair<SST::Cycle_t, uint32_t> entry_t;
+
+		std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t> > heap;
+
+		SlotTable * table;
+
+		public:
+
+		ReadyQueue() : table(nullptr) {}
+
+		void setSlotTable(SlotTable * t) { table = t; }
+
+		void push(uint32_t id, SST::Cycle_t ready_by)
+		{
+			(*table)[id].ready_by = ready_by;
+			heap.push(entry_t(ready_by, id));
+		}
+
+		bool empty() const { return heap.empty(); }
+
+		size_t size() const { return heap.size(); }
+
+		// Removes every request that is ready by cycle x, returned in event order so that TLB updates happen in the
+		// same order regardless of when each request became ready
+		void popReady(SST::Cycle_t x, std::vector<uint32_t> & ready)
+		{
+			ready.clear();
+			while (!heap.empty() && heap.top().first <= x)
+			{
+				ready.push_back(heap.top().second);
+				heap.pop();
+			}
+
+			if (ready.size() > 1)
+			{
+				SlotTable * t = table;
+				MemEventPtrCompare cmp;
+				std::sort(ready.begin(), ready.end(), [t, &cmp](uint32_t a, uint32_t b) { return cmp((*t)[a].ev, (*t)[b].ev); });
+			}
+		}
+	};
+
+}}
+
+#endif
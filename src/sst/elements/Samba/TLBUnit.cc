@@ -74,6 +74,14 @@ TLB::TLB(ComponentId_t id, int tlb_id, TLB * Next_level, int Level, SST::Params&
 
 	upper_link_latency = ((uint32_t) params.find<uint32_t>("upper_link_L"+LEVEL, 0));
 
+	slots = nullptr;
+
+	service_back = nullptr;
+
+	pending_misses = 0;
+
+	pending_bit = 1u << level;
+
 
 	char* subID = (char*) malloc(sizeof(char) * 32);
 	sprintf(subID, "Core%d_L%d", tlb_id,level);
@@ -171,9 +179,10 @@ bool TLB::tick(SST::Cycle_t x)
 	{
 
 
-            MemHierarchy::MemEventBase * ev = pushed_back.back();
+		uint32_t id = pushed_back.back();
+		TranslationSlot & slot = (*slots)[id];
 
-		Address_t addr = ((MemEvent*) ev)->getVirtualAddress();
+		Address_t addr = slot.vaddr;
 
 
 		// Double checking that we actually still don't have it inserted
@@ -183,7 +192,7 @@ bool TLB::tick(SST::Cycle_t x)
 		lu_en=SIZE_LOOKUP.end();
 		while(lu_st!=lu_en)
 		{
-			if(pushed_back_size[ev] >= lu_st->first)
+			if(slot.size >= lu_st->first)
 			{
 				if(!check_hit(addr, lu_st->second))
 				{
@@ -197,47 +206,29 @@ bool TLB::tick(SST::Cycle_t x)
 		}
 
 		// Deleting it from pending requests
-		std::vector<SST::MemHierarchy::MemEventBase *>::iterator st, en;
-		st = pending_misses.begin();
-		en = pending_misses.end();
-
-
-		while(st!=en)
-		{
-			if(*st == ev)
-			{
-				pending_misses.erase(st);
-				break;
-			}
-			st++;
-		}
+		clear_pending(id);
 
 		// Note that here we are sustitiuing for latency of checking the tag before proceeing to the next level, we also add the upper link latency for the round trip
-		ready_by[ev]= x + latency + 2*upper_link_latency;
-
-		// We also track the size of tthe ready request
-		ready_by_size[ev]= pushed_back_size[ev];
+		// The size of the ready request is already in its slot
+		ready_by.push(id, x + latency + 2*upper_link_latency);
 
 
 		// Check if there are other misses that were going to the same translation and waiting for the response of this miss
-		if((level==1) && (SAME_MISS.find(addr/4096)!=SAME_MISS.end()))
+		if(level==1)
 		{
-		  std::map< MemHierarchy::MemEventBase*, int>::iterator same_st, same_en;
-		  same_st = SAME_MISS[addr/4096].begin();
-    		  same_en = SAME_MISS[addr/4096].end();
-   		   while(same_st!=same_en)
-		    {
-
-	    		ready_by[same_st->first] = x + latency + 2*upper_link_latency;
-	    		ready_by_size[same_st->first] = pushed_back_size[ev];
-			same_st++;
-		    }
-		  SAME_MISS.erase(addr/4096);
-		 // PENDING_MISS.erase(addr/4096);
+			std::unordered_map< Address_t, std::vector<uint32_t> >::iterator same = SAME_MISS.find(addr/4096);
+			if(same!=SAME_MISS.end())
+			{
+				for(uint32_t same_id : same->second)
+				{
+					(*slots)[same_id].size = slot.size;
+					ready_by.push(same_id, x + latency + 2*upper_link_latency);
+				}
+				SAME_MISS.erase(same);
+			}
 		}
 		PENDING_MISS.erase(addr/4096);
 
-		pushed_back_size.erase(ev);
 		pushed_back.pop_back();
 
 	}
@@ -245,7 +236,7 @@ bool TLB::tick(SST::Cycle_t x)
 
 
 	// The actual dipatching process... here we take a request and place it in the right queue based on being miss or hit and the number of pending misses
-	std::vector<MemHierarchy::MemEventBase*>::iterator st_1,en_1;
+	std::vector<uint32_t>::iterator st_1,en_1;
 	st_1 = not_serviced.begin();
 	en_1 = not_serviced.end();
 
@@ -260,8 +251,9 @@ bool TLB::tick(SST::Cycle_t x)
 		if(dispatched > max_width)
 			break;
 
-                MemHierarchy::MemEventBase * ev = *st_1;
-		Address_t addr = ((MemEvent*) ev)->getVirtualAddress();
+		uint32_t id = *st_1;
+		TranslationSlot & slot = (*slots)[id];
+		Address_t addr = slot.vaddr;
 
 
 		// Those track if any hit in one of the supported pages' structures
@@ -284,13 +276,14 @@ bool TLB::tick(SST::Cycle_t x)
 			update_lru(addr, hit_id);
 			hits++;
 			statTLBHits->addData(1);
-			if(parallel_mode)
-				ready_by[ev] = x;
-			else
-				ready_by[ev] = x + latency;
 
 			// Tracking the hit request size
-			ready_by_size[ev] = page_size[hit_id]/1024;
+			slot.size = page_size[hit_id]/1024;
+
+			if(parallel_mode)
+				ready_by.push(id, x);
+			else
+				ready_by.push(id, x + latency);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -298,7 +291,7 @@ bool TLB::tick(SST::Cycle_t x)
 		{
 
 			// Making sure we have a room for an additional miss, i.e., less than the maximum outstanding misses
-			if((int) pending_misses.size() < (int) max_outstanding)
+			if(pending_misses < max_outstanding)
 			{
 
 				// Check if the miss is not currently being handled
@@ -306,13 +299,13 @@ bool TLB::tick(SST::Cycle_t x)
 				if((level==1) && (PENDING_MISS.find(addr/4096) != PENDING_MISS.end()))
 				{
 
-					SAME_MISS[addr/4096][ev]=1; // Just adding it to the 2D map, so we later hand it back once the master miss is complete
+					SAME_MISS[addr/4096].push_back(id); // We later hand it back once the master miss is complete
 					currently_handled = true;
 				}
 				else if(level==1)
 				{
 
-					PENDING_MISS[addr/4096]=1;
+					PENDING_MISS.insert(addr/4096);
 
 				}
 
@@ -322,17 +315,18 @@ bool TLB::tick(SST::Cycle_t x)
 				if(!currently_handled)
 				{
 
-					pending_misses.push_back(*st_1);
+					slot.pending |= pending_bit;
+					pending_misses++;
 					// Check if the last level TLB or not, if last-level, pass the request to the page table walker
 					if(next_level!=nullptr)
 					{
 
-						next_level->push_request(ev);
+						next_level->push_request(id);
 						st_1 = not_serviced.erase(st_1);
 					}
 					else // Passs it to the page table walker
 					{
-						PTW->push_request(ev);
+						PTW->push_request(id);
 						st_1 = not_serviced.erase(st_1);
 					}
 				}
@@ -351,71 +345,35 @@ bool TLB::tick(SST::Cycle_t x)
 	}
 
 
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t>::iterator st, en;
-	st = ready_by.begin();
-	en = ready_by.end();
-
-	// We iterate over the list of being serviced request to see if any has finished by this cycle
-	while(st!=en)
+	// We check the list of being serviced request to see if any has finished by this cycle
+	ready_by.popReady(x, ready);
+	for(uint32_t id : ready)
 	{
+		TranslationSlot & slot = (*slots)[id];
 
-		bool deleted=false;
-		if(st->second <= x)
-		{
-
-			//	std::cout<<"The request was read at "<<st->second<<" The time now is "<<x<<std::endl;
+		Address_t addr = slot.vaddr;
 
-			Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
 
-
-			if(SIZE_LOOKUP.find(ready_by_size[st->first])!= SIZE_LOOKUP.end())
+		std::map<long long int, int>::iterator lookup = SIZE_LOOKUP.find(slot.size);
+		if(lookup != SIZE_LOOKUP.end())
+		{
+			// Double checking that we actually still don't have it inserted
+			if(!check_hit(addr, lookup->second))
 			{
-				// Double checking that we actually still don't have it inserted
-				if(!check_hit(addr, SIZE_LOOKUP[ready_by_size[st->first]]))
-				{
-					insert_way(addr, find_victim_way(addr, SIZE_LOOKUP[ready_by_size[st->first]]), SIZE_LOOKUP[ready_by_size[st->first]]);
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
-				}
-				else
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
+				insert_way(addr, find_victim_way(addr, lookup->second), lookup->second);
+				update_lru(addr, lookup->second);
 			}
+			else
+				update_lru(addr, lookup->second);
+		}
 
 
-
-			service_back->push_back(st->first);
-
-			(*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-
-			ready_by_size.erase(st->first);
-
-			deleted = true;
-
-
-			// Deleting it from pending requests
-			std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
-			st2 = pending_misses.begin();
-			en2 = pending_misses.end();
+		// The size of the translation travels back with the slot
+		service_back->push_back(id);
 
 
-			while(st2!=en2)
-			{
-				if(*st2 == st->first)
-				{
-					pending_misses.erase(st2);
-					break;
-				}
-				st2++;
-			}
-
-			ready_by.erase(st);
-
-		}
-		if(deleted)
-			st=ready_by.begin();
-		else
-			st++;
+		// Deleting it from pending requests
+		clear_pending(id);
 
 	}
 
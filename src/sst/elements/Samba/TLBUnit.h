@@ -22,7 +22,10 @@
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
 #include "PageTableWalker.h"
+#include "SlotTable.h"
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "utils.h"
 
@@ -57,8 +60,8 @@ class TLB : public ComponentExtension
 
 	std::map<long long int, int> SIZE_LOOKUP; // This structure checks if a size is supported inside the structure, and its index structure
 
-	std::map< Address_t, std::map< MemHierarchy::MemEventBase *, int, MemEventPtrCompare>> SAME_MISS; // This tracks the misses for the same location and deduplicates them
-	std::map<Address_t, int> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
+	std::unordered_map< Address_t, std::vector<uint32_t> > SAME_MISS; // This tracks the misses for the same location and deduplicates them
+	std::unordered_set<Address_t> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
 
 	int  * sets; //stores the number of sets
 
@@ -82,21 +85,21 @@ class TLB : public ComponentExtension
 
 	int parallel_mode; // very specific case for L1 TLB in case of overlapping with accessing the cache
 
-	std::vector<MemHierarchy::MemEventBase *> * service_back; // This is used to pass ready requests back to the previous level
+	SlotTable * slots; // The per-request slot table shared by this core's TLB hierarchy, requests are passed around by slot index
 
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * service_back_size; // This is used to pass the size of the  requests back to the previous level
+	std::vector<uint32_t> * service_back; // This is used to pass ready requests back to the previous level, the translation size is carried in the slot
 
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare> ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
+	ReadyQueue ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
 
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // this one is used to keep track of requests' sizes inside this structure
+	std::vector<uint32_t> ready; // Scratch list of the requests that became ready on this cycle
 
-	std::vector<MemHierarchy::MemEventBase *> pushed_back; // This is what we got returned from other structures
+	std::vector<uint32_t> pushed_back; // This is what we got returned from other structures
 
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> pushed_back_size; // This is the sizes of the translations we got returned from other structures
+	int pending_misses; // This the number of pending misses, only decremented when pushed back from next level
 
-	std::vector<MemHierarchy::MemEventBase *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
+	uint32_t pending_bit; // The bit identifying this unit in a slot's pending mask
 
-	std::vector<MemHierarchy::MemEventBase *> not_serviced; // This holds those accesses not serviced yet
+	std::vector<uint32_t> not_serviced; // This holds those accesses not serviced yet
 
 
 	int page_walk_latency; // this is really nothing than the page walk latency in case of having no walkers
@@ -123,13 +126,22 @@ class TLB : public ComponentExtension
 	// To insert the translaiton
 	int find_victim_way(Address_t vadd, int struct_id);
 
-	void setServiceBack( std::vector<MemHierarchy::MemEventBase *> * x) { service_back = x;}
+	void setServiceBack( std::vector<uint32_t> * x) { service_back = x;}
 
-	void setServiceBackSize( std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * x) { service_back_size = x;}
+	void setSlotTable( SlotTable * x) { slots = x; ready_by.setSlotTable(x); }
 
-	std::vector<MemHierarchy::MemEventBase *> * getPushedBack(){return & pushed_back;}
+	std::vector<uint32_t> * getPushedBack(){return & pushed_back;}
 
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * getPushedBackSize(){return & pushed_back_size;}
+	// Clears this unit's outstanding miss for a request, if it has one
+	void clear_pending(uint32_t id)
+	{
+		TranslationSlot & slot = (*slots)[id];
+		if(slot.pending & pending_bit)
+		{
+			slot.pending &= ~pending_bit;
+			pending_misses--;
+		}
+	}
 
 	void update_lru(Address_t vaddr, int struct_id);
 
@@ -147,7 +159,7 @@ class TLB : public ComponentExtension
 	void insert_way(Address_t vaddr, int way, int struct_id);
 
 	// This one is to push a request to this structure
-	void push_request(MemHierarchy::MemEventBase * x) { not_serviced.push_back(x);}
+	void push_request(uint32_t x) { not_serviced.push_back(x);}
 
 	bool tick(SST::Cycle_t x);
 
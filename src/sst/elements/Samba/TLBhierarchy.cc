@@ -104,6 +104,7 @@ TLBhierarchy::TLBhierarchy(ComponentId_t id, int tlb_id, int Levels, Params& par
 	sprintf(subID, "%" PRIu32, coreID);
 
 	PTW = loadComponentExtension<PageTableWalker>(coreID, nullptr, 0, params);
+	PTW->setSlotTable(&slots);
 
 	total_waiting = registerStatistic<uint64_t>( "total_waiting", subID );
 
@@ -120,24 +121,23 @@ TLBhierarchy::TLBhierarchy(ComponentId_t id, int tlb_id, int Levels, Params& par
 
 		}
 
+		for(int level=1; level <=levels; level++)
+			TLB_CACHE[level]->setSlotTable(&slots);
+
 		for(int level=2; level <=levels; level++)
 		{
 			TLB_CACHE[level]->setServiceBack(TLB_CACHE[level-1]->getPushedBack());
-			TLB_CACHE[level]->setServiceBackSize(TLB_CACHE[level-1]->getPushedBackSize());
 
 		}
 
 		timeStamp = 0;
 		PTW->setServiceBack(TLB_CACHE[levels]->getPushedBack());
-		PTW->setServiceBackSize(TLB_CACHE[levels]->getPushedBackSize());
 
 		TLB_CACHE[1]->setServiceBack(&mem_reqs);
-		TLB_CACHE[1]->setServiceBackSize(&mem_reqs_sizes);
 	}
 	else
 	{
 		PTW->setServiceBack(&mem_reqs);
-		PTW->setServiceBackSize(&mem_reqs_sizes);
 	}
 
 	PTW->setHold(&hold);
@@ -177,10 +177,9 @@ void TLBhierarchy::handleEvent_CACHE( SST::Event * ev )
 
 void TLBhierarchy::handleEvent_CPU(SST::Event* event)
 {
-	// Push the request to the L1 TLB and time-stamp it
-	time_tracker[event]= curr_time;
+	// Push the request to the L1 TLB, its slot time-stamps it
         MemEventBase* mEvent = static_cast<MemEventBase*>(event);
-	TLB_CACHE[1]->push_request(mEvent);
+	TLB_CACHE[1]->push_request(slots.allocate(mEvent, curr_time));
 
 
 }
@@ -237,15 +236,8 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 	// Step 1, check if not empty, then propogate it to L1 cache
 	while(!mem_reqs.empty() && !shootdown && !hold)
 	{
-            MemHierarchy::MemEventBase * event= mem_reqs.back();
-
-		if(time_tracker.find(event) == time_tracker.end())
-		{
-			std::cout << "Danger! Something is terribly wrong..." << std::endl;
-			mem_reqs_sizes.erase(event);
-			mem_reqs.pop_back();
-			continue;
-		}
+		uint32_t id = mem_reqs.back();
+		MemHierarchy::MemEventBase * event = slots[id].ev;
 
 		// Here we override the physical address provided by ariel memory manage by the one provided by page fault handler
 		if(emulate_faults)
@@ -253,7 +245,7 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 			Address_t vaddr = ((MemEvent*) event)->getVirtualAddress();
 			if(!ptw_confined)
 			{
-				if((*PTE).find(vaddr/4096)==(*PTE).end())
+				if(!PTE->contains(vaddr/4096))
 					std::cout<<"Error: That page has never been mapped:  " << vaddr / 4096 << std::endl;
 
 				((MemEvent*) event)->setAddr((((*PTE)[vaddr / 4096] + vaddr % 4096) / 64) * 64);
@@ -262,7 +254,7 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 			else
 			{
 				uint64_t offset = (uint64_t)512*512*512*512;
-				if((*PTE).find((vaddr/4096)%offset)==(*PTE).end())
+				if(!PTE->contains((vaddr/4096)%offset))
 				std::cout<<"Error: That page has never been mapped:  " << vaddr / 4096 << std::endl;
 
 				((MemEvent*) event)->setAddr((((*PTE)[(vaddr / 4096)%offset] + vaddr % 4096)));
@@ -284,14 +276,13 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 
 		}
 
-		uint64_t time_diff = (uint64_t ) x - time_tracker[event];
-		time_tracker.erase(event);
+		uint64_t time_diff = (uint64_t ) x - slots[id].arrival;
 		total_waiting->addData(time_diff);
 
 		to_cache->send(event);
 
-		// We remove the size of that translation, we might for future versions use the translation size to obtain statistics
-		mem_reqs_sizes.erase(event);
+		// We release the slot, we might for future versions use the translation size in it to obtain statistics
+		slots.release(id);
 		mem_reqs.pop_back();
 	}
 
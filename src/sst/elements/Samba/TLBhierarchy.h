@@ -33,6 +33,8 @@
 #include "TLBentry.h"
 #include "TLBUnit.h"
 #include "PageTableWalker.h"
+#include "RadixTable.h"
+#include "SlotTable.h"
 
 #include<map>
 #include<vector>
@@ -79,8 +81,11 @@ namespace SST { namespace SambaComponent{
 		// Holds the current time
 		SST::Cycle_t curr_time;
 
-		// This vector holds the current requests to be translated
-		std::vector<SST::MemHierarchy::MemEventBase *> mem_reqs;
+		// This holds the bookkeeping of every request in flight in this TLB hierarchy, indexed by slot
+		SlotTable slots;
+
+		// This vector holds the slots of the translated requests, ready to be sent to the cache
+		std::vector<uint32_t> mem_reqs;
 
 		// This tells TLB hierarchy to stall due to emulated page fault
 		int hold;
@@ -97,12 +102,6 @@ namespace SST { namespace SambaComponent{
 		// This vector holds the invalidation requests
 		std::vector<std::pair<Address_t, int> > invalid_addrs;
 
-		// This vector holds the current requests to be translated
-		std::map<SST::MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> mem_reqs_sizes;
-
-
-		// This mapping is used to track the time spent of translating each request
-		std::map<SST::Event *, uint64_t> time_tracker;
 		// The access latency in ns
 		int latency;
 
@@ -117,29 +116,29 @@ namespace SST { namespace SambaComponent{
 		Address_t *CR3;
 		//
 		// Holds the PGD physical pointers, the key is the 9 bits 39-47, i.e., VA/(4096*512*512*512)
-		std::map<Address_t, Address_t> * PGD;
+		PageTable * PGD;
 
 		// Holds the PUD physical pointers, the key is the 9 bits 30-38, i.e., VA/(4096*512*512)
-		std::map<Address_t, Address_t> * PUD;
+		PageTable * PUD;
 
 		// Holds the PMD physical pointers, the key is the 9 bits 21-29, i.e., VA/(4096*512)
-		std::map<Address_t, Address_t> * PMD;
+		PageTable * PMD;
 
 		// Holds the PTE physical pointers, the key is the 9 bits 12-20, i.e., VA/(4096)
-		std::map<Address_t, Address_t> * PTE; // This should give you the exact physical address of the page
+		PageTable * PTE; // This should give you the exact physical address of the page
 
 
 		// The structures below are used to quickly check if the page is mapped or not
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+		PageStatus * MAPPED_PAGE_SIZE4KB;
+		PageStatus * MAPPED_PAGE_SIZE2MB;
+		PageStatus * MAPPED_PAGE_SIZE1GB;
 
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
-		std::map<Address_t,int> *PENDING_SHOOTDOWN_EVENTS;
+		PageStatus *PENDING_PAGE_FAULTS;
+		PageStatus *PENDING_PAGE_FAULTS_PGD;
+		PageStatus *PENDING_PAGE_FAULTS_PUD;
+		PageStatus *PENDING_PAGE_FAULTS_PMD;
+		PageStatus *PENDING_PAGE_FAULTS_PTE;
+		PageStatus *PENDING_SHOOTDOWN_EVENTS;
 
 		uint64_t memory_size;
 
@@ -154,9 +153,9 @@ namespace SST { namespace SambaComponent{
 		void handleEvent_CPU(SST::Event * event);
 
 
-		void setPageTablePointers( Address_t * cr3, std::map<Address_t, Address_t> * pgd,  std::map<Address_t, Address_t> * pud,  std::map<Address_t, Address_t> * pmd, std::map<Address_t, Address_t> * pte,
-				std::map<Address_t,int> * gb,  std::map<Address_t,int> * mb,  std::map<Address_t,int> * kb, std::map<Address_t,int> * pr, int *cr3I, std::map<Address_t,int> *pf_pgd,
-				std::map<Address_t,int> *pf_pud,  std::map<Address_t,int> *pf_pmd, std::map<Address_t,int> * pf_pte)
+		void setPageTablePointers( Address_t * cr3, PageTable * pgd,  PageTable * pud,  PageTable * pmd, PageTable * pte,
+				PageStatus * gb,  PageStatus * mb,  PageStatus * kb, PageStatus * pr, int *cr3I, PageStatus *pf_pgd,
+				PageStatus *pf_pud,  PageStatus *pf_pmd, PageStatus * pf_pte)
 		{
 	                CR3 = cr3;
                         PGD = pgd;
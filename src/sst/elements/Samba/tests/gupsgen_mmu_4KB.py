@@ -1,4 +1,20 @@
 import sst
+import sys
+
+# Options are given as key=value arguments:
+#   emulate_faults - 1 to have Opal serve page faults, so that Samba builds
+#                    its page tables as the pages are first touched
+#   sst gupsgen_mmu_4KB.py -- emulate_faults=1
+
+options = { "emulate_faults" : "0" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    options[key.lstrip("-")] = value
+
+emulate_faults = int(options["emulate_faults"])
 
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
@@ -101,6 +117,40 @@ mmu.addParams({
 
 mmu.enableAllStatistics({"type":"sst.AccumulatorStatistic"})
 
+if emulate_faults:
+    mmu.addParams({
+        "emulate_faults": 1,
+        "opal_latency": "30ps",
+    })
+
+    # MMU uses this page fault handler.
+    pagefaulthandler = mmu.setSubComponent("pagefaulthandler", "Opal.PageFaultHandler")
+    pagefaulthandler.addParams({
+        "opal_latency" : "30ps"
+    })
+
+    # Local memory holds every page GUPS can touch
+    opal = sst.Component("opal","Opal")
+    opal.addParams({
+        "clock"                         : "2GHz",
+        "num_nodes"                     : 1,
+        "max_inst"                      : 32,
+        "shared_mempools"               : 1,
+        "shared_mem.mempool0.start"     : memory_mb * 1024 * 1024,
+        "shared_mem.mempool0.size"      : memory_mb * 1024,
+        "shared_mem.mempool0.frame_size": 4,
+        "node0.cores"                   : 1,
+        "node0.allocation_policy"       : 0,
+        "node0.latency"                 : 2000,
+        "node0.memory.start"            : 0,
+        "node0.memory.size"             : memory_mb * 1024,
+        "node0.memory.frame_size"       : 4,
+    })
+
+    link_ptw_opal_link = sst.Link("link_ptw_opal_link")
+    link_ptw_opal_link.connect( (pagefaulthandler, "opal_link_0", "300ps"), (opal, "mmuLink0", "300ps") )
+    link_ptw_opal_link.setNoCut()
+
 # Define the simulation links
 link_cpu_mmu_link = sst.Link("link_cpu_mmu_link")
 
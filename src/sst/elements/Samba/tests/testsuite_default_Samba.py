@@ -49,6 +49,12 @@ class testcase_Samba_Component(SSTTestCase):
     def test_Samba_gupsgen_mmu_4KB(self):
         self.Samba_test_template("gupsgen_mmu_4KB")
 
+    def test_Samba_gupsgen_mmu_4KB_faults(self):
+        # With emulated faults every translation goes through the page tables
+        # Samba builds as Opal maps pages. Timing changes but the same GUPS
+        # stream must be issued as in the reference run without faults
+        self.Samba_requests_template("gupsgen_mmu_4KB", "emulate_faults=1", ["read_reqs", "write_reqs", "total_bytes_read", "total_bytes_write"])
+
     def test_Samba_gupsgen_mmu_three_levels(self):
         self.Samba_test_template("gupsgen_mmu_three_levels")
 
@@ -112,8 +118,41 @@ class testcase_Samba_Component(SSTTestCase):
         else:
             self.assertTrue(cmp_result, "Diffed compared Output file {0} does not match Reference File {1}".format(outfile, reffile))
 
+    def Samba_requests_template(self, testcase, options, cpu_stats, testtimeout=120):
+        # Runs testcase with options and checks that the CPU statistics in
+        # cpu_stats match the testcase's existing reference file
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_Samba_{0}_{1}".format(testcase, options.replace("=", "").replace(" ", "_"))
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        reffile = "{0}/refFiles/test_Samba_{1}.out".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args='--model-options="{0}"'.format(options),
+                     mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        self.assertFalse(os_test_file(errfile, "-s"), "Samba test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+
+        for stat in cpu_stats:
+            ref = self._get_stat_line(reffile, "cpu." + stat)
+            out = self._get_stat_line(outfile, "cpu." + stat)
+            self.assertTrue(ref is not None, "Reference file {0} has no {1} statistic".format(reffile, stat))
+            self.assertEqual(out, ref, "{0}: {1} does not match reference file {2}".format(testDataFileName, stat, reffile))
+
 ###
 
+    def _get_stat_line(self, in_file, stat):
+        with open(in_file, 'r') as fp:
+            for line in fp:
+                if line.strip().startswith(stat + " "):
+                    return line.strip()
+        return None
+
     def _get_file_data_counts(self, in_file):
         cmd = "wc {0} | awk '{{print $1, $2}}' > {1}".format(in_file, self.tmp_file)
         os.system(cmd)
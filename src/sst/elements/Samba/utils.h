@@ -13,6 +13,7 @@
 #define _H_SST_SAMBA_UTILS
 
 #include <sst/core/sst_types.h>
+#include <functional>
 #include <sst/core/event.h>
 #include <sst/elements/memHierarchy/memEventBase.h>
 
@@ -22,13 +23,20 @@ namespace SambaComponent {
     // Comparator for MemEventBase pointers for deterministic ordering when pointers are used as map keys
     struct MemEventPtrCompare {
         bool operator()(const MemHierarchy::MemEventBase* ptrA, const MemHierarchy::MemEventBase* ptrB) const {
-            if (ptrA->getID().second < ptrB->getID().second) { // Compare on rank
-                return true;
+            if (ptrA->getID().second != ptrB->getID().second) { // Compare on rank
+                return ptrA->getID().second < ptrB->getID().second;
             } else {
                 return ptrA->getID().first < ptrB->getID().first;
             }
         }
     };
+
+    // Hash for event IDs when they are used as unordered map keys
+    struct EventIdHash {
+        size_t operator()(const SST::Event::id_type& id) const {
+            return std::hash<uint64_t>()(id.first ^ ((uint64_t)id.second << 48));
+        }
+    };
 }
 }
 
@@ -41,6 +41,7 @@
 #endif
 
 #define ARIEL_MAX_PAYLOAD_SIZE 64
+#define ARIEL_MAX_BATCH_SIZE 84
 
 namespace SST {
 namespace ArielComponent {
@@ -64,6 +65,7 @@ enum ArielShmemCmd_t {
     ARIEL_ISSUE_CUDA = 144,
     ARIEL_FLUSHLINE_INSTRUCTION = 154,
     ARIEL_FENCE_INSTRUCTION = 155,
+    ARIEL_PERFORM_BATCH = 160,
 };
 
 #ifdef HAVE_CUDA
@@ -171,6 +173,11 @@ struct ArielCommand {
         struct {
             uint64_t vaddr;
         } flushline;
+        struct {
+            uint16_t count;     /* Number of instructions packed into data */
+            uint16_t length;    /* Number of bytes of data in use */
+            uint8_t  data[ARIEL_MAX_BATCH_SIZE];
+        } batch;
 #ifdef HAVE_CUDA
         struct {
             GpuApi_t name;
@@ -180,6 +187,155 @@ struct ArielCommand {
     };
 };
 
+/*
+ * Batched instruction records
+ *
+ * An ARIEL_PERFORM_BATCH command carries several instructions in a single
+ * tunnel message, replacing the START/READ/WRITE/END (or NOOP) messages that
+ * are otherwise sent for each instruction. Each instruction is packed as:
+ *   - a header byte: bit 0 = has read, bit 1 = has write, bits 2-4 = instClass,
+ *     bit 5 = a SIMD element count follows (otherwise it is 1)
+ *   - the SIMD element count as a varint, if present
+ *   - for the read, then the write: the size as a varint followed by the
+ *     zigzag-encoded varint delta from the previous address in the batch
+ * Write payloads are not carried, so batching is only used when write
+ * payload tracing is disabled.
+ */
+#define ARIEL_BATCH_HAS_READ    0x01
+#define ARIEL_BATCH_HAS_WRITE   0x02
+#define ARIEL_BATCH_CLASS_SHIFT 2
+#define ARIEL_BATCH_CLASS_MASK  0x07
+#define ARIEL_BATCH_HAS_SIMD    0x20
+
+/* Largest encoded instruction: header + SIMD count + 2 x (size + address) */
+#define ARIEL_BATCH_MAX_RECORD  (1 + 5 + 2 * (5 + 10))
+
+struct ArielBatchRecord {
+    uint8_t  ops;           /* ARIEL_BATCH_HAS_READ | ARIEL_BATCH_HAS_WRITE, 0 for a no-op */
+    uint32_t instClass;
+    uint32_t simdElemCount;
+    uint64_t readAddr;
+    uint32_t readSize;
+    uint64_t writeAddr;
+    uint32_t writeSize;
+};
+
+/** Packs instructions into an ARIEL_PERFORM_BATCH command (frontend side) */
+class ArielBatchWriter {
+public:
+    ArielBatchWriter() { reset(); }
+
+    void reset() {
+        cmd.command = ARIEL_PERFORM_BATCH;
+        cmd.instPtr = 0;
+        cmd.batch.count = 0;
+        cmd.batch.length = 0;
+        lastAddr = 0;
+    }
+
+    bool empty() const { return 0 == cmd.batch.count; }
+
+    /** Adds an instruction, returns false (leaving the batch unchanged) if it does not fit */
+    bool append(const ArielBatchRecord& rec) {
+        uint8_t record[ARIEL_BATCH_MAX_RECORD];
+        uint32_t len = 0;
+        uint64_t addr = lastAddr;
+
+        uint8_t header = rec.ops | ((rec.instClass & ARIEL_BATCH_CLASS_MASK) << ARIEL_BATCH_CLASS_SHIFT);
+        if (rec.simdElemCount != 1) header |= ARIEL_BATCH_HAS_SIMD;
+
+        record[len++] = header;
+        if (header & ARIEL_BATCH_HAS_SIMD) putVarint(record, len, rec.simdElemCount);
+        if (header & ARIEL_BATCH_HAS_READ) putAccess(record, len, addr, rec.readAddr, rec.readSize);
+        if (header & ARIEL_BATCH_HAS_WRITE) putAccess(record, len, addr, rec.writeAddr, rec.writeSize);
+
+        if (cmd.batch.length + len > ARIEL_MAX_BATCH_SIZE) return false;
+
+        for (uint32_t i = 0; i < len; i++) {
+            cmd.batch.data[cmd.batch.length + i] = record[i];
+        }
+        cmd.batch.length += len;
+        cmd.batch.count++;
+        lastAddr = addr;
+        return true;
+    }
+
+    const ArielCommand& getCommand() const { return cmd; }
+
+private:
+    static void putVarint(uint8_t* buf, uint32_t& len, uint64_t v) {
+        while (v >= 0x80) {
+            buf[len++] = (uint8_t) (v | 0x80);
+            v >>= 7;
+        }
+        buf[len++] = (uint8_t) v;
+    }
+
+    static void putAccess(uint8_t* buf, uint32_t& len, uint64_t& prev, uint64_t addr, uint32_t size) {
+        const int64_t delta = (int64_t) (addr - prev);
+        putVarint(buf, len, size);
+        putVarint(buf, len, ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63));
+        prev = addr;
+    }
+
+    ArielCommand cmd;
+    uint64_t lastAddr;
+};
+
+/** Unpacks the instructions of an ARIEL_PERFORM_BATCH command (simulator side) */
+class ArielBatchReader {
+public:
+    ArielBatchReader() : remaining(0), offset(0), lastAddr(0) {}
+
+    void start(const ArielCommand& ac) {
+        cmd = ac;
+        remaining = ac.batch.count;
+        offset = 0;
+        lastAddr = 0;
+    }
+
+    bool empty() const { return 0 == remaining; }
+
+    /** Decodes the next instruction, returns false once the batch is exhausted */
+    bool next(ArielBatchRecord& rec) {
+        if (0 == remaining) return false;
+
+        const uint8_t header = cmd.batch.data[offset++];
+        rec.ops = header & (ARIEL_BATCH_HAS_READ | ARIEL_BATCH_HAS_WRITE);
+        rec.instClass = (header >> ARIEL_BATCH_CLASS_SHIFT) & ARIEL_BATCH_CLASS_MASK;
+        rec.simdElemCount = (header & ARIEL_BATCH_HAS_SIMD) ? (uint32_t) getVarint() : 1;
+        if (header & ARIEL_BATCH_HAS_READ) getAccess(rec.readAddr, rec.readSize);
+        if (header & ARIEL_BATCH_HAS_WRITE) getAccess(rec.writeAddr, rec.writeSize);
+        remaining--;
+        return true;
+    }
+
+private:
+    uint64_t getVarint() {
+        uint64_t v = 0;
+        int shift = 0;
+        uint8_t b;
+        do {
+            b = cmd.batch.data[offset++];
+            v |= ((uint64_t) (b & 0x7f)) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        return v;
+    }
+
+    void getAccess(uint64_t& addr, uint32_t& size) {
+        size = (uint32_t) getVarint();
+        const uint64_t zz = getVarint();
+        addr = lastAddr + (uint64_t) ((int64_t) (zz >> 1) ^ -((int64_t) (zz & 1)));
+        lastAddr = addr;
+    }
+
+    ArielCommand cmd;
+    uint32_t remaining;
+    uint32_t offset;
+    uint64_t lastAddr;
+};
+
 struct ArielSharedData {
     size_t numCores;
     uint64_t simTime;
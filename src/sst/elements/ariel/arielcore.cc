@@ -781,10 +781,66 @@ bool ArielCore::hasDrainCompleted() const {
         return false;
 }
 
+void ArielCore::countFPInstruction(uint32_t instClass, uint32_t simdElemCount) {
+    if(ARIEL_INST_SP_FP == instClass) {
+            statFPSPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPSPSIMDIns->addData(1);
+            } else {
+                statFPSPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 32)
+                statFPSPOps->addData(simdElemCount);
+    } else if(ARIEL_INST_DP_FP == instClass) {
+            statFPDPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPDPSIMDIns->addData(1);
+            } else {
+                statFPDPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 16)
+                statFPDPOps->addData(simdElemCount);
+    }
+}
+
+void ArielCore::unpackBatchInstruction() {
+    ArielBatchRecord rec;
+    batchReader.next(rec);
+
+    if(0 == rec.ops) {
+        createNoOpEvent();
+        return;
+    }
+
+    countFPInstruction(rec.instClass, rec.simdElemCount);
+
+    if(rec.ops & ARIEL_BATCH_HAS_READ) {
+        createReadEvent(rec.readAddr, rec.readSize);
+    }
+
+    if(rec.ops & ARIEL_BATCH_HAS_WRITE) {
+        // Batches do not carry write payloads, write events still expect a buffer of the write length
+        if(batchWritePayload.size() < rec.writeSize) {
+            batchWritePayload.resize(rec.writeSize, 0);
+        }
+        createWriteEvent(rec.writeAddr, rec.writeSize, &batchWritePayload[0]);
+    }
+}
+
 bool ArielCore::refillQueue() {
     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Refilling event queue for core %" PRIu32 "...\n", coreID));
 
     while(coreQ->size() < maxQLength) {
+        // Finish the batch in progress before reading another command
+        if(!batchReader.empty()) {
+            unpackBatchInstruction();
+            continue;
+        }
+
         ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Attempting to fill events for core: %" PRIu32 " current queue size=%" PRIu32 ", max length=%" PRIu32 "\n",
                             coreID, (uint32_t) coreQ->size(), (uint32_t) maxQLength));
 
@@ -806,29 +862,7 @@ bool ArielCore::refillQueue() {
                 break;
 
             case ARIEL_START_INSTRUCTION:
-                if(ARIEL_INST_SP_FP == ac.inst.instClass) {
-                        statFPSPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPSPSIMDIns->addData(1);
-                        } else {
-                            statFPSPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 32)
-                            statFPSPOps->addData(ac.inst.simdElemCount);
-                } else if(ARIEL_INST_DP_FP == ac.inst.instClass) {
-                        statFPDPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPDPSIMDIns->addData(1);
-                        } else {
-                            statFPDPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 16)
-                            statFPDPOps->addData(ac.inst.simdElemCount);
-                }
+                countFPInstruction(ac.inst.instClass, ac.inst.simdElemCount);
 
                 while(ac.command != ARIEL_END_INSTRUCTION) {
                         ac = tunnel->readMessage(coreID);
@@ -861,6 +895,12 @@ bool ArielCore::refillQueue() {
                 createNoOpEvent();
                 break;
 
+            case ARIEL_PERFORM_BATCH:
+                ARIEL_CORE_VERBOSE(32, output->verbose(CALL_INFO, 32, 0, "Unpacking batch of %" PRIu32 " instructions on core: %" PRIu32 "\n",
+                                    (uint32_t) ac.batch.count, coreID));
+                batchReader.start(ac);
+                break;
+
             case ARIEL_FLUSHLINE_INSTRUCTION:
                 createFlushEvent(ac.flushline.vaddr);
                 break;
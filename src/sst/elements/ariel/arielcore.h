@@ -35,6 +35,7 @@
 #include <string>
 #include <queue>
 #include <unordered_map>
+#include <vector>
 
 #include "arielmemmgr.h"
 #include "arielevent.h"
@@ -175,6 +176,8 @@ class ArielCore : public ComponentExtension {
     private:
         bool processNextEvent();
         bool refillQueue();
+        void unpackBatchInstruction();
+        void countFPInstruction(uint32_t instClass, uint32_t simdElemCount);
 
         bool writePayloads;
         uint32_t coreID;
@@ -207,6 +210,10 @@ class ArielCore : public ComponentExtension {
         SimpleMem* cacheLink;
         ArielTunnel *tunnel;
 
+        // Batched command being unpacked, resumed on the next refill if the queue fills
+        ArielBatchReader batchReader;
+        std::vector<uint8_t> batchWritePayload;
+
 #ifdef HAVE_CUDA
         Link* GpuLink;
         GpuReturnTunnel *tunnelR;
@@ -72,6 +72,7 @@ KNOB<UINT32> InterceptMemAllocations(KNOB_MODE_WRITEONCE, "pintool", "m", "1", "
 KNOB<string> UseMallocMap           (KNOB_MODE_WRITEONCE, "pintool", "u", "",  "Should intercept ariel_malloc_flag() and interpret using a malloc map: specify filename or leave blank for disabled");
 KNOB<UINT32> KeepMallocStackTrace   (KNOB_MODE_WRITEONCE, "pintool", "k", "1", "Should keep shadow stack and dump on malloc calls. 1 = enabled, 0 = disabled");
 KNOB<UINT32> DefaultMemoryPool      (KNOB_MODE_WRITEONCE, "pintool", "d", "0", "Default Ariel Memory Pool");
+KNOB<UINT32> BatchCommands          (KNOB_MODE_WRITEONCE, "pintool", "b", "0", "Pack memory instructions into batched commands (0 = disabled, 1 = enabled), ignored when write tracing");
 // GPGPUSim
 KNOB<string> SSTNamedPipe2          (KNOB_MODE_WRITEONCE, "pintool", "g", "",  "Named pipe to connect to SST simulator");
 KNOB<string> SSTNamedPipe3          (KNOB_MODE_WRITEONCE, "pintool", "x", "",  "Named pipe to connect to SST simulator");
@@ -94,6 +95,8 @@ PIN_LOCK mainLock;
 // Instrumentation control
 UINT32 instrument_instructions;
 bool writeTrace;
+bool batchCommands;
+ArielBatchWriter* batchWriters = NULL;
 UINT32 funcProfileLevel;
 typedef struct {
     int64_t insExecuted;
@@ -281,16 +284,63 @@ VOID InstrumentTrace (TRACE trace, VOID* args)
 /******************** END SHADOW STACK **************************/
 /****************************************************************/
 
+// In batched mode each thread packs its instructions into a thread-private
+// batch which is sent when it is full, before any other command from the
+// thread, and when the thread enters a system call or exits
+VOID FlushBatch(THREADID thr)
+{
+    if(!batchWriters[thr].empty()) {
+        tunnel->writeMessage(thr, batchWriters[thr].getCommand());
+        batchWriters[thr].reset();
+    }
+}
+
+VOID WriteCommand(THREADID thr, const ArielCommand& ac)
+{
+    if(batchCommands && thr < core_count) {
+        FlushBatch(thr);
+    }
+    tunnel->writeMessage(thr, ac);
+}
+
+VOID WriteBatchRecord(THREADID thr, const ArielBatchRecord& rec)
+{
+    if(!batchWriters[thr].append(rec)) {
+        FlushBatch(thr);
+        batchWriters[thr].append(rec);
+    }
+}
+
+VOID FlushBatchAtSyscall(THREADID thr, CONTEXT* ctxt, SYSCALL_STANDARD std, VOID* v)
+{
+    if(thr < core_count) {
+        FlushBatch(thr);
+    }
+}
+
+VOID FlushBatchAtThreadFini(THREADID thr, const CONTEXT* ctxt, INT32 code, VOID* v)
+{
+    if(thr < core_count) {
+        FlushBatch(thr);
+    }
+}
+
 VOID Fini(INT32 code, VOID* v)
 {
     if(SSTVerbosity.Value() > 0) {
         std::cout << "SSTARIEL: Execution completed, shutting down." << std::endl;
     }
 
+    if(batchCommands) {
+        for(UINT32 i = 0; i < core_count; i++) {
+            FlushBatch(i);
+        }
+    }
+
     ArielCommand ac;
     ac.command = ARIEL_PERFORM_EXIT;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(0, ac);
+    WriteCommand(0, ac);
 
     delete tunnelmgr;
 #ifdef HAVE_CUDA
@@ -338,7 +388,7 @@ VOID WriteFlushInstructionMarker(UINT32 thr, ADDRINT ip, ADDRINT vaddr)
     ac.instPtr = (uint64_t) ip;
     ac.flushline.vaddr = (uint32_t) vaddr;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -347,7 +397,7 @@ VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
     ac.command = ARIEL_FENCE_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRINT ip,
@@ -365,7 +415,7 @@ VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRI
     ac.inst.instClass = instClass;
     ac.inst.simdElemCount = simdOpWidth;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADDRINT ip,
@@ -397,7 +447,7 @@ VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADD
     }
     printf("\n");
 */
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -405,7 +455,7 @@ VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip)
     ArielCommand ac;
     ac.command = ARIEL_START_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -413,7 +463,7 @@ VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip)
     ArielCommand ac;
     ac.command = ARIEL_END_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
@@ -423,6 +473,19 @@ VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_READ | ARIEL_BATCH_HAS_WRITE;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.readAddr = (uint64_t) readAddr;
+                rec.readSize = readSize;
+                rec.writeAddr = (uint64_t) writeAddr;
+                rec.writeSize = writeSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker( thr, ip );
             WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
             WriteInstructionWrite( writeAddr, writeSize, thr, ip, instClass, simdOpWidth );
@@ -437,6 +500,17 @@ VOID WriteInstructionReadOnly(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_READ;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.readAddr = (uint64_t) readAddr;
+                rec.readSize = readSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker(thr, ip);
             WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
             WriteEndInstructionMarker(thr, ip);
@@ -449,10 +523,17 @@ VOID WriteNoOp(THREADID thr, ADDRINT ip)
 {
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = 0;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             ArielCommand ac;
             ac.command = ARIEL_NOOP;
             ac.instPtr = (uint64_t) ip;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         }
     }
 }
@@ -463,6 +544,17 @@ VOID WriteInstructionWriteOnly(THREADID thr, ADDRINT* writeAddr, UINT32 writeSiz
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_WRITE;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.writeAddr = (uint64_t) writeAddr;
+                rec.writeSize = writeSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker(thr, ip);
             WriteInstructionWrite(writeAddr, writeSize,  thr, ip, instClass, simdOpWidth);
             WriteEndInstructionMarker(thr, ip);
@@ -713,7 +805,7 @@ void mapped_ariel_output_stats()
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 // same effect as mapped_ariel_output_stats(), but it also sends a user-defined reference number back
@@ -723,7 +815,7 @@ void mapped_ariel_output_stats_buoy(uint64_t marker)
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) marker; //user the instruction pointer slot to send the marker number
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 void mapped_ariel_flushline(void *virtualAddress)
@@ -777,7 +869,7 @@ int ariel_mlm_memcpy(void* dest, void* source, size_t size) {
     ac.dma_start.dest = ariel_dest;
     ac.dma_start.len = length;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "Done with ariel memcpy.\n");
@@ -805,7 +897,7 @@ void ariel_mlm_set_pool(int new_pool)
     ArielCommand ac;
     ac.command = ARIEL_SWITCH_POOL;
     ac.switchPool.pool = newDefaultPool;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     // Keep track of the default pool
     default_pool = (UINT32) new_pool;
@@ -857,7 +949,7 @@ void* ariel_mmap_mlm(int fileID, size_t size, int level)
     std::cout<<"File ID at FESIMPLE IS : "<<ac.mlm_mmap.fileID<<std::endl;
     std::cout<<"After ******"<<std::endl;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mmap_mlm call allocates data at address: 0x%llx\n",
@@ -912,7 +1004,7 @@ void* ariel_mlm_malloc(size_t size, int level) {
         ac.mlm_map.alloc_level = allocationLevel;
     }
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mlm_malloc call allocates data at address: 0x%llx\n",
@@ -957,7 +1049,7 @@ void ariel_mlm_free(void* ptr)
         ArielCommand ac;
         ac.command = ARIEL_ISSUE_TLM_FREE;
         ac.mlm_free.vaddr = virtAddr;
-        tunnel->writeMessage(thr, ac);
+        WriteCommand(thr, ac);
 
     } else {
         fprintf(stderr, "ARIEL: Call to free in Ariel did not find a matching local allocation, this memory will be leaked.\n");
@@ -1009,14 +1101,14 @@ VOID ariel_postmalloc_instrument(ADDRINT allocLocation)
                 if (toFast[thr].count == 0) {
                     toFast[thr].valid = false;
                 }
-                tunnel->writeMessage(thr, ac);
+                WriteCommand(thr, ac);
             }
         } else if (shouldOverride) {
             ac.mlm_map.alloc_level = overridePool;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         } else if (InterceptMemAllocations.Value()) {
             ac.mlm_map.alloc_level = allocationLevel;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         }
 
         /*printf("ARIEL: Created a malloc of size: %" PRIu64 " in Ariel\n",
@@ -1043,7 +1135,7 @@ __host__ cudaError_t CUDARTAPI cudaMalloc(void **devPtr, size_t size){
     ac.API.name = GPU_MALLOC;
     ac.API.CA.cuda_malloc.dev_ptr = devPtr;
     ac.API.CA.cuda_malloc.size = size;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail = false;
@@ -1073,7 +1165,7 @@ void** CUDARTAPI __cudaRegisterFatBinary(void *fatCubin) {
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_REG_FAT_BINARY;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1114,7 +1206,7 @@ void CUDARTAPI __cudaRegisterFunction(
     ac.API.CA.register_function.fat_cubin_handle = (unsigned)(unsigned long long)fatCubinHandle;
     ac.API.CA.register_function.host_fun = reinterpret_cast<uint64_t>(hostFun);
     strncpy(ac.API.CA.register_function.device_fun, deviceFun, 512);
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1179,7 +1271,7 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
     ac.API.CA.cuda_memcpy.src = (uint64_t) src;
     ac.API.CA.cuda_memcpy.count = count;
     ac.API.CA.cuda_memcpy.kind = final_kind;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     if(final_kind == cudaMemcpyHostToDevice) {
         if(count <= max_page_size){
@@ -1308,7 +1400,7 @@ __host__ cudaError_t CUDARTAPI cudaConfigureCall(dim3 gridDim, dim3 blockDim, si
     ac.API.CA.cfg_call.bdz = blockDim.z;
     ac.API.CA.cfg_call.sharedMem = sharedMem;
     ac.API.CA.cfg_call.stream = stream;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1356,7 +1448,7 @@ __host__ cudaError_t CUDARTAPI cudaSetupArgument(const void *arg, size_t size, s
     ac.API.CA.set_arg.offset = offset;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_SET_ARG;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1381,7 +1473,7 @@ __host__ cudaError_t CUDARTAPI cudaLaunch(const void *func){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_LAUNCH;
     ac.API.CA.cuda_launch.func = reinterpret_cast<uint64_t>(func);
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1405,7 +1497,7 @@ __host__ cudaError_t CUDARTAPI cudaFree(void *devPtr){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_FREE;
     ac.API.CA.free_address = (uint64_t)devPtr;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1428,7 +1520,7 @@ __host__ __cudart_builtin__ cudaError_t CUDARTAPI cudaGetLastError(void){
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_GET_LAST_ERROR;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
     GpuCommand gc;
 
     bool avail=false;
@@ -1467,7 +1559,7 @@ void CUDARTAPI __cudaRegisterVar(
     ac.API.CA.register_var.size = size;
     ac.API.CA.register_var.constant = constant;
     ac.API.CA.register_var.global = global;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1503,7 +1595,7 @@ __host__ cudaError_t CUDARTAPI __maxActiveBlock(
     ac.API.CA.max_active_block.blockSize = blockSize;
     ac.API.CA.max_active_block.dynamicSMemSize = dynamicSMemSize;
     ac.API.CA.max_active_block.flags = flags;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1531,7 +1623,7 @@ VOID ariel_postfree_instrument(ADDRINT allocLocation)
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_TLM_FREE;
     ac.mlm_free.vaddr = virtAddr;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 void mapped_ariel_malloc_flag_fortran(int* mallocLocId, int* count, int* level)
@@ -1812,6 +1904,19 @@ int main(int argc, char *argv[])
     }
 
     core_count = MaxCoreCount.Value();
+
+    batchCommands = false;
+    if(BatchCommands.Value() > 0) {
+        if(writeTrace) {
+            fprintf(stderr, "ARIEL: Batched commands do not carry write payloads, batching is disabled while write tracing\n");
+        } else {
+            fprintf(stderr, "ARIEL: Memory instructions will be sent as batched commands\n");
+            batchCommands = true;
+            batchWriters = new ArielBatchWriter[core_count];
+            PIN_AddSyscallEntryFunction(FlushBatchAtSyscall, 0);
+            PIN_AddThreadFiniFunction(FlushBatchAtThreadFini, 0);
+        }
+    }
     instrument_instructions = InstrumentInstructions.Value();
 
 // Pin version specific tunnel attach
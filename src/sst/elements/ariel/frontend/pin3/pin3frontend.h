@@ -63,6 +63,7 @@ class Pin3Frontend : public ArielFrontend {
         {"mallocmapfile", "File with valid 'ariel_malloc_flag' ids", ""},
         {"tracePrefix", "Prefix when tracing is enable", ""},
         {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
+        {"batchcommands", "Pack memory instructions into batched tunnel commands to reduce frontend overhead, ignored if writepayloadtrace is set", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"})
 
         /* Ariel class */
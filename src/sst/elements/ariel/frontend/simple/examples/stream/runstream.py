@@ -1,9 +1,22 @@
 import sst
 import os
+import sys
+
+# Options are given as key=value arguments:
+#   batchcommands - 1 to have the Pin frontend send batched tunnel commands
+#   sst runstream.py -- batchcommands=1
+
+options = { "batchcommands" : "0" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    options[key.lstrip("-")] = value
 
 sst.setProgramOption("timebase", "1ps")
 
-sst_root = os.getenv( "SST_ROOT" )
+sst_root = os.getenv( "SST_ROOT", "" )
 app = sst_root + "/sst-elements/src/sst/elements/ariel/frontend/simple/examples/stream/stream"
 
 if not os.path.exists(app):
@@ -19,6 +32,7 @@ ariel.addParams({
         "arielmode" : "1",
         "launchparamcount" : 1,
         "launchparam0" : "-ifeellucky",
+        "batchcommands" : options["batchcommands"],
         })
 
 memmgr = ariel.setSubComponent("memmgr", "ariel.MemoryManagerSimple")
@@ -78,6 +78,7 @@ KNOB<UINT32> InterceptMemAllocations(KNOB_MODE_WRITEONCE, "pintool", "m", "1", "
 KNOB<string> UseMallocMap(KNOB_MODE_WRITEONCE, "pintool", "u", "", "Should intercept ariel_malloc_flag() and interpret using a malloc map: specify filename or leave blank for disabled");
 KNOB<UINT32> KeepMallocStackTrace(KNOB_MODE_WRITEONCE, "pintool", "k", "1", "Should keep shadow stack and dump on malloc calls. 1 = enabled, 0 = disabled");
 KNOB<UINT32> DefaultMemoryPool(KNOB_MODE_WRITEONCE, "pintool", "d", "0", "Default SST Memory Pool");
+KNOB<UINT32> BatchCommands(KNOB_MODE_WRITEONCE, "pintool", "b", "0", "Pack memory instructions into batched commands (0 = disabled, 1 = enabled), ignored when write tracing");
 // GPGPUSim
 KNOB<string> SSTNamedPipe2(KNOB_MODE_WRITEONCE, "pintool", "g", "", "Named pipe to connect to SST simulator");
 KNOB<string> SSTNamedPipe3(KNOB_MODE_WRITEONCE, "pintool", "x", "", "Named pipe to connect to SST simulator");
@@ -115,6 +116,8 @@ std::vector< std::set<ADDRINT> > instPtrsList;
 UINT32 overridePool;
 bool shouldOverride;
 bool writeTrace;
+bool batchCommands;
+ArielBatchWriter* batchWriters = NULL;
 
 // For gettimeofday/get_clocktime overrides:
 struct timeval offset_tv;
@@ -282,16 +285,63 @@ VOID InstrumentTrace (TRACE trace, VOID* args)
 /******************** END SHADOW STACK **************************/
 /****************************************************************/
 
+// In batched mode each thread packs its instructions into a thread-private
+// batch which is sent when it is full, before any other command from the
+// thread, and when the thread enters a system call or exits
+VOID FlushBatch(THREADID thr)
+{
+    if(!batchWriters[thr].empty()) {
+        tunnel->writeMessage(thr, batchWriters[thr].getCommand());
+        batchWriters[thr].reset();
+    }
+}
+
+VOID WriteCommand(THREADID thr, const ArielCommand& ac)
+{
+    if(batchCommands && thr < core_count) {
+        FlushBatch(thr);
+    }
+    tunnel->writeMessage(thr, ac);
+}
+
+VOID WriteBatchRecord(THREADID thr, const ArielBatchRecord& rec)
+{
+    if(!batchWriters[thr].append(rec)) {
+        FlushBatch(thr);
+        batchWriters[thr].append(rec);
+    }
+}
+
+VOID FlushBatchAtSyscall(THREADID thr, CONTEXT* ctxt, SYSCALL_STANDARD std, VOID* v)
+{
+    if(thr < core_count) {
+        FlushBatch(thr);
+    }
+}
+
+VOID FlushBatchAtThreadFini(THREADID thr, const CONTEXT* ctxt, INT32 code, VOID* v)
+{
+    if(thr < core_count) {
+        FlushBatch(thr);
+    }
+}
+
 VOID Fini(INT32 code, VOID* v)
 {
     if(SSTVerbosity.Value() > 0) {
         std::cout << "SSTARIEL: Execution completed, shutting down." << std::endl;
     }
 
+    if(batchCommands) {
+        for(UINT32 i = 0; i < core_count; i++) {
+            FlushBatch(i);
+        }
+    }
+
     ArielCommand ac;
     ac.command = ARIEL_PERFORM_EXIT;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(0, ac);
+    WriteCommand(0, ac);
 
     delete tunnelmgr;
 #ifdef HAVE_CUDA
@@ -339,7 +389,7 @@ VOID WriteFlushInstructionMarker(UINT32 thr, ADDRINT ip, ADDRINT vaddr)
     ac.instPtr = (uint64_t) ip;
     ac.flushline.vaddr = (uint32_t) vaddr;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -348,7 +398,7 @@ VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
     ac.command = ARIEL_FENCE_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRINT ip,
@@ -366,7 +416,7 @@ VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRI
     ac.inst.instClass = instClass;
     ac.inst.simdElemCount = simdOpWidth;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADDRINT ip,
@@ -398,7 +448,7 @@ VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADD
     }
     printf("\n");
 */
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -406,7 +456,7 @@ VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip)
     ArielCommand ac;
     ac.command = ARIEL_START_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -414,7 +464,7 @@ VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip)
     ArielCommand ac;
     ac.command = ARIEL_END_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
@@ -424,6 +474,19 @@ VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_READ | ARIEL_BATCH_HAS_WRITE;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.readAddr = (uint64_t) readAddr;
+                rec.readSize = readSize;
+                rec.writeAddr = (uint64_t) writeAddr;
+                rec.writeSize = writeSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker( thr, ip );
             WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
             WriteInstructionWrite( writeAddr, writeSize, thr, ip, instClass, simdOpWidth );
@@ -438,6 +501,17 @@ VOID WriteInstructionReadOnly(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_READ;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.readAddr = (uint64_t) readAddr;
+                rec.readSize = readSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker(thr, ip);
             WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
             WriteEndInstructionMarker(thr, ip);
@@ -450,10 +524,17 @@ VOID WriteNoOp(THREADID thr, ADDRINT ip)
 {
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = 0;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             ArielCommand ac;
             ac.command = ARIEL_NOOP;
             ac.instPtr = (uint64_t) ip;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         }
     }
 }
@@ -464,6 +545,17 @@ VOID WriteInstructionWriteOnly(THREADID thr, ADDRINT* writeAddr, UINT32 writeSiz
 
     if(enable_output) {
         if(thr < core_count) {
+            if(batchCommands) {
+                ArielBatchRecord rec;
+                rec.ops = ARIEL_BATCH_HAS_WRITE;
+                rec.instClass = instClass;
+                rec.simdElemCount = simdOpWidth;
+                rec.writeAddr = (uint64_t) writeAddr;
+                rec.writeSize = writeSize;
+                WriteBatchRecord(thr, rec);
+                return;
+            }
+
             WriteStartInstructionMarker(thr, ip);
             WriteInstructionWrite(writeAddr, writeSize,  thr, ip, instClass, simdOpWidth);
             WriteEndInstructionMarker(thr, ip);
@@ -711,7 +803,7 @@ void mapped_ariel_output_stats()
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 // same effect as mapped_ariel_output_stats(), but it also sends a user-defined reference number back
@@ -721,7 +813,7 @@ void mapped_ariel_output_stats_buoy(uint64_t marker)
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) marker; //user the instruction pointer slot to send the marker number
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 void mapped_ariel_flushline(void *virtualAddress)
@@ -775,7 +867,7 @@ int ariel_mlm_memcpy(void* dest, void* source, size_t size) {
     ac.dma_start.dest = ariel_dest;
     ac.dma_start.len = length;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "Done with ariel memcpy.\n");
@@ -803,7 +895,7 @@ void ariel_mlm_set_pool(int new_pool)
     ArielCommand ac;
     ac.command = ARIEL_SWITCH_POOL;
     ac.switchPool.pool = newDefaultPool;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     // Keep track of the default pool
     default_pool = (UINT32) new_pool;
@@ -858,7 +950,7 @@ void* ariel_mmap_mlm(int fileID, size_t size, int level)
     std::cout<<"File ID at FESIMPLE IS : "<<ac.mlm_mmap.fileID<<std::endl;
     std::cout<<"After ******"<<std::endl;
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mmap_mlm call allocates data at address: 0x%llx\n",
@@ -916,7 +1008,7 @@ void* ariel_mlm_malloc(size_t size, int level) {
         ac.mlm_map.alloc_level = allocationLevel;
     }
 
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mlm_malloc call allocates data at address: 0x%llx\n",
@@ -961,7 +1053,7 @@ void ariel_mlm_free(void* ptr)
         ArielCommand ac;
         ac.command = ARIEL_ISSUE_TLM_FREE;
         ac.mlm_free.vaddr = virtAddr;
-        tunnel->writeMessage(thr, ac);
+        WriteCommand(thr, ac);
 
     } else {
         fprintf(stderr, "ARIEL: Call to free in Ariel did not find a matching local allocation, this memory will be leaked.\n");
@@ -1013,14 +1105,14 @@ VOID ariel_postmalloc_instrument(ADDRINT allocLocation)
                 if (toFast[thr].count == 0) {
                     toFast[thr].valid = false;
                 }
-                tunnel->writeMessage(thr, ac);
+                WriteCommand(thr, ac);
             }
         } else if (shouldOverride) {
             ac.mlm_map.alloc_level = overridePool;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         } else if (InterceptMemAllocations.Value()) {
             ac.mlm_map.alloc_level = allocationLevel;
-            tunnel->writeMessage(thr, ac);
+            WriteCommand(thr, ac);
         }
 
         /*printf("ARIEL: Created a malloc of size: %" PRIu64 " in Ariel\n",
@@ -1047,7 +1139,7 @@ __host__ cudaError_t CUDARTAPI cudaMalloc(void **devPtr, size_t size){
     ac.API.name = GPU_MALLOC;
     ac.API.CA.cuda_malloc.dev_ptr = devPtr;
     ac.API.CA.cuda_malloc.size = size;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail = false;
@@ -1077,7 +1169,7 @@ void** CUDARTAPI __cudaRegisterFatBinary(void *fatCubin) {
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_REG_FAT_BINARY;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1118,7 +1210,7 @@ void CUDARTAPI __cudaRegisterFunction(
     ac.API.CA.register_function.fat_cubin_handle = (unsigned)(unsigned long long)fatCubinHandle;
     ac.API.CA.register_function.host_fun = reinterpret_cast<uint64_t>(hostFun);
     strncpy(ac.API.CA.register_function.device_fun, deviceFun, 512);
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1183,7 +1275,7 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
     ac.API.CA.cuda_memcpy.src = (uint64_t) src;
     ac.API.CA.cuda_memcpy.count = count;
     ac.API.CA.cuda_memcpy.kind = final_kind;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     if(final_kind == cudaMemcpyHostToDevice) {
         if(count <= max_page_size){
@@ -1312,7 +1404,7 @@ __host__ cudaError_t CUDARTAPI cudaConfigureCall(dim3 gridDim, dim3 blockDim, si
     ac.API.CA.cfg_call.bdz = blockDim.z;
     ac.API.CA.cfg_call.sharedMem = sharedMem;
     ac.API.CA.cfg_call.stream = stream;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1360,7 +1452,7 @@ __host__ cudaError_t CUDARTAPI cudaSetupArgument(const void *arg, size_t size, s
     ac.API.CA.set_arg.offset = offset;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_SET_ARG;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1385,7 +1477,7 @@ __host__ cudaError_t CUDARTAPI cudaLaunch(const void *func){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_LAUNCH;
     ac.API.CA.cuda_launch.func = reinterpret_cast<uint64_t>(func);
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1409,7 +1501,7 @@ __host__ cudaError_t CUDARTAPI cudaFree(void *devPtr){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_FREE;
     ac.API.CA.free_address = (uint64_t)devPtr;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1432,7 +1524,7 @@ __host__ __cudart_builtin__ cudaError_t CUDARTAPI cudaGetLastError(void){
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_GET_LAST_ERROR;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
     GpuCommand gc;
 
     bool avail=false;
@@ -1471,7 +1563,7 @@ void CUDARTAPI __cudaRegisterVar(
     ac.API.CA.register_var.size = size;
     ac.API.CA.register_var.constant = constant;
     ac.API.CA.register_var.global = global;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1507,7 +1599,7 @@ __host__ cudaError_t CUDARTAPI __maxActiveBlock(
     ac.API.CA.max_active_block.blockSize = blockSize;
     ac.API.CA.max_active_block.dynamicSMemSize = dynamicSMemSize;
     ac.API.CA.max_active_block.flags = flags;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1535,7 +1627,7 @@ VOID ariel_postfree_instrument(ADDRINT allocLocation)
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_TLM_FREE;
     ac.mlm_free.vaddr = virtAddr;
-    tunnel->writeMessage(thr, ac);
+    WriteCommand(thr, ac);
 }
 
 void mapped_ariel_malloc_flag_fortran(int* mallocLocId, int* count, int* level)
@@ -1816,6 +1908,19 @@ int main(int argc, char *argv[])
     }
 
     core_count = MaxCoreCount.Value();
+
+    batchCommands = false;
+    if(BatchCommands.Value() > 0) {
+        if(writeTrace) {
+            fprintf(stderr, "ARIEL: Batched commands do not carry write payloads, batching is disabled while write tracing\n");
+        } else {
+            fprintf(stderr, "ARIEL: Memory instructions will be sent as batched commands\n");
+            batchCommands = true;
+            batchWriters = new ArielBatchWriter[core_count];
+            PIN_AddSyscallEntryFunction(FlushBatchAtSyscall, 0);
+            PIN_AddThreadFiniFunction(FlushBatchAtThreadFini, 0);
+        }
+    }
     instrument_instructions = InstrumentInstructions.Value();
 
     tunnelmgr = new SST::Core::Interprocess::SHMChild<ArielTunnel>(SSTNamedPipe.Value());
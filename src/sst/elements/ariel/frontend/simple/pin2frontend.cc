@@ -47,6 +47,7 @@ Pin2Frontend::Pin2Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     output = new SST::Output("Pin2Frontend[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
 
     int instrument_instructions = params.find<int>("instrument_instructions", 1);
+    uint32_t batch_commands = (uint32_t) params.find<uint32_t>("batchcommands", 0);
     core_count = cores;
 
     /////////////////////////////////////////////////////////////////////////////////////
@@ -119,7 +120,7 @@ Pin2Frontend::Pin2Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     appLauncher = params.find<std::string>("launcher", PINTOOL_EXECUTABLE);
 
     const uint32_t launch_param_count = (uint32_t) params.find<uint32_t>("launchparamcount", 0);
-    const uint32_t pin_arg_count = 37 + launch_param_count;
+    const uint32_t pin_arg_count = 39 + launch_param_count;
 
     execute_args = (char**) malloc(sizeof(char*) * (pin_arg_count + app_argc));
 
@@ -173,6 +174,9 @@ Pin2Frontend::Pin2Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
         execute_args[arg++] = const_cast<char*>("1");
     }
 
+    execute_args[arg++] = const_cast<char*>("-b");
+    execute_args[arg++] = (char*) malloc(sizeof(char) * 8);
+    sprintf(execute_args[arg-1], "%" PRIu32, batch_commands);
     execute_args[arg++] = const_cast<char*>("-E");
     execute_args[arg++] = (char*) malloc(sizeof(char) * 8);
     sprintf(execute_args[arg-1], "%d", instrument_instructions);
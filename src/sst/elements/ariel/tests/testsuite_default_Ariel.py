@@ -0,0 +1,167 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+import os
+import shutil
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+pin_exec_path = ""
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        try:
+            # Put your single instance Init Code Here
+            class_inst._setup_stream_test_files()
+        except:
+            pass
+        module_init = 1
+    module_sema.release()
+
+###
+
+def is_PIN_loaded():
+    # Look to see if PIN is available
+    pindir_found = False
+    pin_path = os.environ.get('INTEL_PIN_DIRECTORY')
+    if pin_path is not None:
+        pindir_found = os.path.isdir(pin_path)
+    log_debug("Ariel Test - Intel_PIN_Path = {0}; Valid Dir = {1}".format(pin_path, pindir_found))
+    return pindir_found
+
+def is_PIN_Compiled():
+    global pin_exec_path
+    pin_exec = sst_elements_config_include_file_get_value_str("PINTOOL_EXECUTABLE", "", True)
+    log_debug("Ariel Test - Detected PIN_EXEC = {0}".format(pin_exec))
+    pin_exec_path = pin_exec
+    return pin_exec != ""
+
+################################################################################
+
+class testcase_Ariel(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+    pin_compiled = is_PIN_Compiled()
+    pin_loaded = is_PIN_loaded()
+
+    @unittest.skipIf(not pin_compiled, "Ariel: Requires PIN, but PinTool is not compiled with Elements. In sst_element_config.h PINTOOL_EXECUTABLE={0}".format(pin_exec_path))
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
+    def test_Ariel_runstream(self):
+        self.Ariel_stream_template("runstream", "batchcommands=0")
+
+    @unittest.skipIf(not pin_compiled, "Ariel: Requires PIN, but PinTool is not compiled with Elements. In sst_element_config.h PINTOOL_EXECUTABLE={0}".format(pin_exec_path))
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
+    def test_Ariel_runstream_batched(self):
+        # Batching changes how instructions reach the core, not which ones.
+        # Cycle counts follow the frontend's progress and are not compared
+        self.Ariel_stream_template("runstream", "batchcommands=1", ["read_requests", "write_requests", "instruction_count"])
+
+#####
+
+    def Ariel_stream_template(self, testcase, options, core_stats=None, testtimeout=300):
+        # Runs testcase with options against the testcase's existing reference
+        # file. If core_stats is given only those core statistics are compared
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+        streamDir = os.path.abspath("{0}/../frontend/simple/examples/stream".format(test_path))
+
+        testDataFileName="test_Ariel_{0}_{1}".format(testcase, options.replace("=", ""))
+        sdlfile = "{0}/{1}.py".format(streamDir, testcase)
+        reffile = "{0}/tests/refFiles/test_Ariel_{1}.out".format(streamDir, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        self.tmp_file = "{0}/{1}.tmp".format(tmpdir, testDataFileName)
+
+        # The SDL falls back to OMP_EXE when the example is not built in place
+        os.environ["OMP_EXE"] = "{0}/testarielstream/stream".format(tmpdir)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args='--model-options="{0}"'.format(options),
+                     mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        self.assertFalse(os_test_file(errfile, "-s"), "Ariel test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+
+        if core_stats is not None:
+            for stat in core_stats:
+                ref = self._get_stat_line(reffile, "a0." + stat)
+                out = self._get_stat_line(outfile, "a0." + stat)
+                self.assertTrue(ref is not None, "Reference file {0} has no {1} statistic".format(reffile, stat))
+                self.assertEqual(out, ref, "{0}: {1} does not match reference file {2}".format(testDataFileName, stat, reffile))
+            return
+
+        cmp_result = testing_compare_diff(testDataFileName, outfile, reffile)
+        if cmp_result != True:
+            diff_data = testing_get_diff_data(testDataFileName)
+            log_debug("{0} - DIFF DATA =\n{1}".format(self.get_testcase_name(), diff_data))
+
+            # Timing follows the frontend, so fall back to the word/line count
+            ref_wc_data = self._get_file_data_counts(reffile)
+            out_wc_data = self._get_file_data_counts(outfile)
+            cmp_result = ref_wc_data == out_wc_data
+            if not cmp_result:
+                log_failure("{0} - DIFF DATA\nref_wc_data = {1}\nout_wc_data = {2}".format(self.get_testcase_name(), ref_wc_data, out_wc_data))
+            self.assertTrue(cmp_result, "Output file {0} word/line count does NOT match Reference file {1} word/line count".format(outfile, reffile))
+
+###
+
+    def _setup_stream_test_files(self):
+        # NOTE: This routine is called a single time at module startup
+        log_debug("_setup_stream_test_files() Running")
+        test_path = self.get_testsuite_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        streamDir = os.path.abspath("{0}/../frontend/simple/examples/stream".format(test_path))
+        testArielStreamDir = "{0}/testarielstream".format(tmpdir)
+
+        # Create a clean build directory for the stream binary
+        if os.path.isdir(testArielStreamDir):
+            shutil.rmtree(testArielStreamDir, True)
+        os.makedirs(testArielStreamDir)
+
+        shutil.copy("{0}/Makefile".format(streamDir), testArielStreamDir)
+        os_symlink_file(streamDir, testArielStreamDir, "stream.c")
+
+        cmd = "make stream"
+        rtn = OSCommand(cmd, set_cwd=testArielStreamDir).run()
+        log_debug("Make result = {0}; output =\n{1}".format(rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "stream.c failed to compile")
+
+    def _get_stat_line(self, in_file, stat):
+        with open(in_file, 'r') as fp:
+            for line in fp:
+                if line.strip().startswith(stat + " "):
+                    return line.strip()
+        return None
+
+    def _get_file_data_counts(self, in_file):
+        cmd = "wc {0} | awk '{{print $1, $2}}' > {1}".format(in_file, self.tmp_file)
+        os.system(cmd)
+        cmd = "cat {0}".format(self.tmp_file)
+        cmd_rtn = os_simple_command(cmd)
+        cat_out = cmd_rtn[1]
+        return cat_out
@@ -0,0 +1,340 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "streamprefetch.h"
+
+#include <vector>
+#include "stdlib.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+// Aggressiveness levels: lines prefetched per access and how far ahead of
+// the demand stream (in strides) prefetching may run
+static const uint32_t STREAM_LEVELS = 5;
+static const uint32_t streamDegree[STREAM_LEVELS]   = { 1, 1, 2, 4, 4 };
+static const int64_t  streamDistance[STREAM_LEVELS] = { 4, 8, 16, 32, 64 };
+
+void StreamPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+    const NotifyResultType notifyResType = notify.getResultType();
+    const Addr addr = notify.getPhysicalAddress();
+    const int64_t line = addr / blockSize;
+
+    uint64_t& filterSlot = prefetchFilter[line & filterMask];
+    const bool prefetched = (filterSlot == (uint64_t) line + 1);
+
+    if (notifyType == EVICT) {
+        if (prefetched) {
+            statPrefetchUseless->addData(1);
+            filterSlot = 0;
+        }
+        return;
+    }
+
+    if (notifyType == PREFETCH) {
+        // Our own prefetch found the line already present
+        if (prefetched && notifyResType == HIT) {
+            statPrefetchRedundant->addData(1);
+            filterSlot = 0;
+        }
+        return;
+    }
+
+    if (notifyType != READ && notifyType != WRITE)
+        return;
+
+    if (prefetched) {
+        statPrefetchUseful->addData(1);
+        intervalUseful++;
+
+        // The demand request caught up with the prefetch before it completed
+        if (notifyResType == MISS) {
+            statPrefetchLate->addData(1);
+            intervalLate++;
+        }
+
+        filterSlot = 0;
+    } else if (notifyResType == MISS) {
+        statDemandMissesUncovered->addData(1);
+        intervalUncovered++;
+    }
+
+    const Addr ip = notify.getInstructionPointer();
+    const uint64_t key = (keyByPC && ip != 0) ? (ip << 1) : (((addr / pageSize) << 1) | 1);
+
+    StreamEntry* stream = findStream(key);
+    train(stream, line);
+
+    if (stream->confidence >= confidenceThreshold && stream->stride != 0) {
+        statPrefetchOpportunities->addData(1);
+        issuePrefetches(stream, line);
+    }
+}
+
+StreamEntry* StreamPrefetcher::findStream(uint64_t key) {
+    const uint64_t hash = key ^ (key >> 17) ^ (key >> 31);
+    StreamEntry* set = &streamTable[(hash & (streamSets - 1)) * streamWays];
+    StreamEntry* victim = set;
+
+    streamUse++;
+
+    for (uint32_t i = 0; i < streamWays; ++i) {
+        if (set[i].valid && set[i].key == key) {
+            set[i].lastUse = streamUse;
+            return &set[i];
+        }
+
+        if (!set[i].valid) {
+            victim = &set[i];
+        } else if (victim->valid && set[i].lastUse < victim->lastUse) {
+            victim = &set[i];
+        }
+    }
+
+    statStreamAllocations->addData(1);
+
+    victim->valid = false;
+    victim->key = key;
+    victim->lastUse = streamUse;
+    return victim;
+}
+
+void StreamPrefetcher::train(StreamEntry* stream, int64_t line) {
+    if (!stream->valid) {
+        stream->valid = true;
+        stream->lastLine = line;
+        stream->stride = 0;
+        stream->confidence = 0;
+        stream->nextLine = line;
+        return;
+    }
+
+    const int64_t delta = line - stream->lastLine;
+
+    if (delta == 0)
+        return;
+
+    if (delta == stream->stride) {
+        if (stream->confidence < confidenceMax)
+            stream->confidence++;
+    } else if (stream->confidence > 0) {
+        stream->confidence--;
+    } else if (delta <= maxStride && delta >= -maxStride) {
+        // Start over with the new stride, nothing of it has been prefetched yet
+        stream->stride = delta;
+        stream->nextLine = line + delta;
+    }
+
+    stream->lastLine = line;
+}
+
+void StreamPrefetcher::issuePrefetches(StreamEntry* stream, int64_t line) {
+    const int64_t stride = stream->stride;
+    const int64_t limit = line + streamDistance[level] * stride;
+
+    // Lines the demand stream has already passed are not worth fetching
+    if ((stride > 0 && stream->nextLine <= line) || (stride < 0 && stream->nextLine >= line))
+        stream->nextLine = line + stride;
+
+    for (uint32_t i = 0; i < streamDegree[level]; ++i) {
+        const int64_t target = stream->nextLine;
+
+        if ((stride > 0 && target > limit) || (stride < 0 && target < limit))
+            break;
+
+        if (target < 0)
+            break;
+
+        if (!overrunPageBoundary && ((Addr) target * blockSize) / pageSize != ((Addr) line * blockSize) / pageSize) {
+            output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
+            statPrefetchIssueCanceledByPageBoundary->addData(1);
+            break;
+        }
+
+        issuePrefetch(target);
+        stream->nextLine = target + stride;
+    }
+}
+
+void StreamPrefetcher::issuePrefetch(int64_t line) {
+    uint64_t& filterSlot = prefetchFilter[line & filterMask];
+
+    if (filterSlot == (uint64_t) line + 1) {
+        statPrefetchIssueCanceledByHistory->addData(1);
+        return;
+    }
+
+    filterSlot = (uint64_t) line + 1;
+
+    const Addr prefetchAddr = (Addr) line * blockSize;
+
+    output->verbose(CALL_INFO, 2, 0, "Issue prefetch, prefetch address: %" PRIx64 ", level=%" PRIu32 "\n", prefetchAddr, level);
+
+    statPrefetchEventsIssued->addData(1);
+
+    // Cycle over each registered call back and notify them that we want to issue a prefetch request
+    for (std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+        // Create a new read request, we cannot issue a write because the data will get
+        // overwritten and corrupt memory (even if we really do want to do a write)
+        MemEvent* newEv = new MemEvent(getName(), prefetchAddr, prefetchAddr, Command::GetS);
+        newEv->setSize(blockSize);
+        newEv->setPrefetchFlag(true);
+        (*(*callbackItr))(newEv);
+    }
+
+    if (++intervalIssued >= feedbackInterval)
+        recordFeedback();
+}
+
+// Feedback directed throttling: inaccurate prefetching backs off, accurate
+// prefetching that arrives late runs further ahead
+void StreamPrefetcher::recordFeedback() {
+    const uint64_t accuracy = (intervalUseful * 100) / intervalIssued;
+    const uint64_t lateness = intervalUseful ? (intervalLate * 100) / intervalUseful : 0;
+    const uint64_t coverage = (intervalUseful + intervalUncovered) ? (intervalUseful * 100) / (intervalUseful + intervalUncovered) : 0;
+
+    statPrefetchAccuracy->addData(accuracy);
+    statPrefetchLateness->addData(lateness);
+    statPrefetchCoverage->addData(coverage);
+
+    if (throttle) {
+        if (accuracy < accuracyLow) {
+            if (level > 0)
+                level--;
+        } else if (lateness > latenessThreshold) {
+            if (level < STREAM_LEVELS - 1)
+                level++;
+        } else if (accuracy >= accuracyHigh && intervalLate == 0 && intervalUncovered > intervalUseful) {
+            // Accurate and on time but most misses are still not covered
+            if (level < STREAM_LEVELS - 1)
+                level++;
+        }
+    }
+
+    statPrefetchLevel->addData(level);
+
+    output->verbose(CALL_INFO, 1, 0, "Feedback: accuracy=%" PRIu64 "%%, lateness=%" PRIu64 "%%, coverage=%" PRIu64 "%%, level=%" PRIu32 "\n",
+        accuracy, lateness, coverage, level);
+
+    intervalIssued = 0;
+    intervalUseful = 0;
+    intervalLate = 0;
+    intervalUncovered = 0;
+}
+
+
+StreamPrefetcher::StreamPrefetcher(ComponentId_t id, Params& params) : CacheListener(id, params) {
+    Simulation::getSimulation()->requireEvent("memHierarchy.MemEvent");
+
+    verbosity = params.find<int>("verbose", 0);
+
+    char* new_prefix = (char*) malloc(sizeof(char) * 128);
+    sprintf(new_prefix, "StreamPrefetcher[%s | @f:@p:@l] ", getName().c_str());
+    output = new Output(new_prefix, verbosity, 0, Output::STDOUT);
+    free(new_prefix);
+
+    blockSize = params.find<uint64_t>("cache_line_size", 64);
+    pageSize = params.find<uint64_t>("page_size", 4096);
+
+    uint32_t overrunPB = params.find<uint32_t>("overrun_page_boundaries", 0);
+    overrunPageBoundary = (overrunPB == 0) ? false : true;
+
+    std::string streamKey = params.find<std::string>("stream_key", "pc");
+    if (streamKey == "pc") {
+        keyByPC = true;
+    } else if (streamKey == "page") {
+        keyByPC = false;
+    } else {
+        output->fatal(CALL_INFO, -1, "%s, Error: stream_key must be 'pc' or 'page', got '%s'\n", getName().c_str(), streamKey.c_str());
+    }
+
+    streamSets = params.find<uint32_t>("stream_table_sets", 16);
+    streamWays = params.find<uint32_t>("stream_table_ways", 4);
+    if (streamSets == 0 || (streamSets & (streamSets - 1)) != 0 || streamWays == 0) {
+        output->fatal(CALL_INFO, -1, "%s, Error: stream_table_sets must be a power of two and stream_table_ways at least 1, got %" PRIu32 " and %" PRIu32 "\n",
+            getName().c_str(), streamSets, streamWays);
+    }
+
+    StreamEntry emptyStream = { false, 0, 0, 0, 0, 0, 0 };
+    streamTable.assign(streamSets * streamWays, emptyStream);
+    streamUse = 0;
+
+    confidenceMax = params.find<uint32_t>("confidence_max", 3);
+    confidenceThreshold = params.find<uint32_t>("confidence_threshold", 2);
+    if (confidenceThreshold > confidenceMax) {
+        output->fatal(CALL_INFO, -1, "%s, Error: confidence_threshold (%" PRIu32 ") must not exceed confidence_max (%" PRIu32 ")\n",
+            getName().c_str(), confidenceThreshold, confidenceMax);
+    }
+
+    maxStride = params.find<int64_t>("max_stride", 64);
+
+    uint32_t filterSize = params.find<uint32_t>("filter_size", 256);
+    if (filterSize == 0 || (filterSize & (filterSize - 1)) != 0) {
+        output->fatal(CALL_INFO, -1, "%s, Error: filter_size must be a power of two, got %" PRIu32 "\n", getName().c_str(), filterSize);
+    }
+    prefetchFilter.assign(filterSize, 0);
+    filterMask = filterSize - 1;
+
+    level = params.find<uint32_t>("initial_level", 2);
+    if (level >= STREAM_LEVELS) {
+        output->fatal(CALL_INFO, -1, "%s, Error: initial_level must be between 0 and %" PRIu32 ", got %" PRIu32 "\n", getName().c_str(), STREAM_LEVELS - 1, level);
+    }
+
+    throttle = params.find<bool>("throttle", true);
+    feedbackInterval = params.find<uint32_t>("feedback_interval", 256);
+    if (feedbackInterval == 0)
+        feedbackInterval = 1;
+    accuracyHigh = params.find<uint32_t>("accuracy_high", 75);
+    accuracyLow = params.find<uint32_t>("accuracy_low", 40);
+    latenessThreshold = params.find<uint32_t>("lateness_threshold", 10);
+
+    intervalIssued = 0;
+    intervalUseful = 0;
+    intervalLate = 0;
+    intervalUncovered = 0;
+
+    output->verbose(CALL_INFO, 1, 0, "StreamPrefetcher created, cache line: %" PRIu64 ", page size: %" PRIu64 ", streams: %" PRIu32 "\n",
+        blockSize, pageSize, streamSets * streamWays);
+
+    statPrefetchOpportunities = registerStatistic<uint64_t>("prefetch_opportunities");
+    statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
+    statPrefetchIssueCanceledByPageBoundary = registerStatistic<uint64_t>("prefetches_canceled_by_page_boundary");
+    statPrefetchIssueCanceledByHistory = registerStatistic<uint64_t>("prefetches_canceled_by_history");
+    statPrefetchUseful = registerStatistic<uint64_t>("prefetches_useful");
+    statPrefetchLate = registerStatistic<uint64_t>("prefetches_late");
+    statPrefetchUseless = registerStatistic<uint64_t>("prefetches_useless");
+    statPrefetchRedundant = registerStatistic<uint64_t>("prefetches_redundant");
+    statDemandMissesUncovered = registerStatistic<uint64_t>("demand_misses_uncovered");
+    statStreamAllocations = registerStatistic<uint64_t>("stream_allocations");
+    statPrefetchAccuracy = registerStatistic<uint64_t>("prefetch_accuracy");
+    statPrefetchCoverage = registerStatistic<uint64_t>("prefetch_coverage");
+    statPrefetchLateness = registerStatistic<uint64_t>("prefetch_lateness");
+    statPrefetchLevel = registerStatistic<uint64_t>("prefetch_level");
+}
+
+StreamPrefetcher::~StreamPrefetcher() {
+    delete output;
+}
+
+void StreamPrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void StreamPrefetcher::printStats(Output &out) {
+}
@@ -0,0 +1,169 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_STREAM_PREFETCH
+#define _H_SST_STREAM_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include <sst/core/output.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * One detected stream. Streams are keyed by the instruction pointer of the
+ * access, or by the page when the cache does not pass instruction pointers
+ * down. Addresses are kept as cache line numbers.
+ */
+struct StreamEntry {
+    bool     valid;
+    uint64_t key;
+    int64_t  lastLine;
+    int64_t  stride;        // In cache lines
+    uint32_t confidence;
+    int64_t  nextLine;      // Next line of the stream that has not been prefetched
+    uint64_t lastUse;
+};
+
+class StreamPrefetcher : public SST::MemHierarchy::CacheListener {
+public:
+    StreamPrefetcher(ComponentId_t id, Params& params);
+    ~StreamPrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+    void registerResponseCallback(Event::HandlerBase *handler);
+    void printStats(Output &out);
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        StreamPrefetcher,
+            "cassini",
+            "StreamPrefetcher",
+            SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Multi-stream stride prefetcher with feedback throttling",
+            SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "verbose", "Controls the verbosity of the Cassini component", "0" },
+        { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
+        { "page_size", "Page size for this controller", "4096" },
+        { "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" },
+        { "stream_key", "Detect streams per instruction pointer (pc) or per page (page). With pc, accesses without an instruction pointer fall back to the page", "pc" },
+        { "stream_table_sets", "Number of sets in the stream table, must be a power of two", "16" },
+        { "stream_table_ways", "Number of streams per set in the stream table", "4" },
+        { "confidence_max", "Saturation value of the per-stream confidence counter", "3" },
+        { "confidence_threshold", "Confidence a stream needs before it is prefetched", "2" },
+        { "max_stride", "Largest stride in cache lines that is followed", "64" },
+        { "filter_size", "Number of recently prefetched lines tracked for feedback, must be a power of two", "256" },
+        { "initial_level", "Starting aggressiveness level, 0 (1 line, 4 strides ahead) to 4 (4 lines, 64 strides ahead)", "2" },
+        { "throttle", "Adjust the aggressiveness level from accuracy and lateness feedback, 0 is no, 1 is yes", "1" },
+        { "feedback_interval", "Number of issued prefetches between aggressiveness adjustments", "256" },
+        { "accuracy_high", "Accuracy (percent) at or above which the prefetcher may become more aggressive", "75" },
+        { "accuracy_low", "Accuracy (percent) below which the prefetcher becomes less aggressive", "40" },
+        { "lateness_threshold", "Percentage of useful prefetches arriving late above which the prefetcher becomes more aggressive", "10" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "prefetches_issued", "Number of prefetch requests issued", "prefetches", 1 },
+        { "prefetches_canceled_by_page_boundary",
+                "Prefetches which would not be executed because they span over a page boundary.", "prefetches", 1 },
+        { "prefetches_canceled_by_history",
+                "Prefetches which did not get issued because the line was recently prefetched", "prefetches", 1 },
+        { "prefetch_opportunities", "Count of accesses to a confident stream", "prefetches", 1 },
+        { "prefetches_useful", "Prefetched lines that were accessed by a demand request", "prefetches", 1 },
+        { "prefetches_late", "Prefetched lines that a demand request missed on because the prefetch had not completed", "prefetches", 1 },
+        { "prefetches_useless", "Prefetched lines that were evicted before being accessed", "prefetches", 1 },
+        { "prefetches_redundant", "Prefetches for lines that were already in the cache", "prefetches", 1 },
+        { "demand_misses_uncovered", "Demand misses to lines that were not prefetched", "misses", 1 },
+        { "stream_allocations", "Number of streams allocated in the stream table", "streams", 2 },
+        { "prefetch_accuracy", "Useful prefetches as a percentage of issued prefetches, recorded every feedback interval", "percent", 2 },
+        { "prefetch_coverage", "Useful prefetches as a percentage of demand misses without prefetching, recorded every feedback interval", "percent", 2 },
+        { "prefetch_lateness", "Late prefetches as a percentage of useful prefetches, recorded every feedback interval", "percent", 2 },
+        { "prefetch_level", "Aggressiveness level, recorded every feedback interval", "level", 2 }
+    )
+
+private:
+    StreamEntry* findStream(uint64_t key);
+    void train(StreamEntry* stream, int64_t line);
+    void issuePrefetches(StreamEntry* stream, int64_t line);
+    void issuePrefetch(int64_t line);
+    void recordFeedback();
+
+    Output* output;
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+    uint64_t blockSize;
+    uint64_t pageSize;
+    bool overrunPageBoundary;
+    bool keyByPC;
+    uint32_t verbosity;
+
+    std::vector<StreamEntry> streamTable;
+    uint32_t streamSets;
+    uint32_t streamWays;
+    uint64_t streamUse;
+    uint32_t confidenceMax;
+    uint32_t confidenceThreshold;
+    int64_t maxStride;
+
+    // Direct-mapped table of prefetched lines not yet accessed or evicted,
+    // each slot holds the line number plus one so that zero means empty
+    std::vector<uint64_t> prefetchFilter;
+    uint64_t filterMask;
+
+    uint32_t level;
+    bool throttle;
+    uint32_t feedbackInterval;
+    uint32_t accuracyHigh;
+    uint32_t accuracyLow;
+    uint32_t latenessThreshold;
+    uint64_t intervalIssued;
+    uint64_t intervalUseful;
+    uint64_t intervalLate;
+    uint64_t intervalUncovered;
+
+    Statistic<uint64_t>* statPrefetchOpportunities;
+    Statistic<uint64_t>* statPrefetchEventsIssued;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
+    Statistic<uint64_t>* statPrefetchUseful;
+    Statistic<uint64_t>* statPrefetchLate;
+    Statistic<uint64_t>* statPrefetchUseless;
+    Statistic<uint64_t>* statPrefetchRedundant;
+    Statistic<uint64_t>* statDemandMissesUncovered;
+    Statistic<uint64_t>* statStreamAllocations;
+    Statistic<uint64_t>* statPrefetchAccuracy;
+    Statistic<uint64_t>* statPrefetchCoverage;
+    Statistic<uint64_t>* statPrefetchLateness;
+    Statistic<uint64_t>* statPrefetchLevel;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -55,6 +55,33 @@ class testcase_cassini_prefetch(SSTTestCase):
     def test_cassini_prefetch_nextblock(self):
         self.cassini_prefetch_test_template("nbp")
 
+    # The stream prefetcher has no reference output, so its runs are checked
+    # against the invariants of its own statistics
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_stream skipped if threads > 3")
+    def test_cassini_prefetch_stream(self):
+        outfile = self.cassini_stream_test_template("stp")
+        stats = self._read_accumulator_stats(outfile)
+
+        issued = stats["prefetches_issued"]
+        self.assertTrue(issued > 0, "cassini_prefetch: no stream prefetches issued in {0}".format(outfile))
+        self.assertTrue(stats["prefetches_useful"] > 0, "cassini_prefetch: no useful stream prefetches in {0}".format(outfile))
+        self.assertTrue(stats["prefetches_late"] <= stats["prefetches_useful"],
+                        "cassini_prefetch: more late than useful prefetches in {0}".format(outfile))
+        resolved = stats["prefetches_useful"] + stats["prefetches_useless"] + stats["prefetches_redundant"]
+        self.assertTrue(resolved <= issued, "cassini_prefetch: {0} prefetches resolved but only {1} issued in {2}".format(resolved, issued, outfile))
+
+    # Running 64 lines ahead of the stream in a 16 line L1 evicts prefetched
+    # lines before the stream reaches them
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_stream_useless skipped if threads > 3")
+    def test_cassini_prefetch_stream_useless(self):
+        outfile = self.cassini_stream_test_template("stp", "cache_size=1KB initial_level=4 throttle=0")
+        stats = self._read_accumulator_stats(outfile)
+
+        self.assertTrue(stats["prefetches_useless"] > 0, "cassini_prefetch: no useless stream prefetches in {0}".format(outfile))
+        resolved = stats["prefetches_useful"] + stats["prefetches_useless"] + stats["prefetches_redundant"]
+        self.assertTrue(resolved <= stats["prefetches_issued"],
+                        "cassini_prefetch: {0} prefetches resolved but only {1} issued in {2}".format(resolved, stats["prefetches_issued"], outfile))
+
 #####
 
     def cassini_prefetch_test_template(self, testcase):
@@ -89,3 +116,44 @@ class testcase_cassini_prefetch(SSTTestCase):
         if not cmp_result:
             log_failure("{0} - DIFF DATA =\n{1}".format(self.get_testcase_name(), diff_data))
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    def cassini_stream_test_template(self, testcase, options=""):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_cassini_prefetch_{0}".format(testcase)
+        testRunName = testDataFileName
+        if options != "":
+            testRunName = "{0}_{1}".format(testDataFileName, options.replace("=", "").replace(" ", "_"))
+
+        sdlfile = "{0}/streamcpu-{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testRunName)
+        errfile = "{0}/{1}.err".format(outdir, testRunName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testRunName)
+        otherargs = '--model-options="{0}"'.format(options)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        self.assertFalse(os_test_file(errfile, "-s"), "cassini_prefetch test {0} has Non-empty Error File {1}".format(testRunName, errfile))
+
+        cmd = 'grep -q "Simulation is complete" {0} '.format(outfile)
+        self.assertTrue(os.system(cmd) == 0, "Output file {0} does not contain a simulation complete message".format(outfile))
+        return outfile
+
+    def _read_accumulator_stats(self, outfile):
+        # Returns {statistic : Sum} for the l1cache accumulator statistics in outfile
+        stats = {}
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                fields = line.split(":")
+                if len(fields) < 3 or not fields[0].strip().startswith("l1cache."):
+                    continue
+                stat = fields[0].strip().split(".", 1)[1]
+                for f in fields[2].split(";"):
+                    if f.strip().startswith("Sum."):
+                        stats[stat] = int(f.split("=")[1])
+        return stats
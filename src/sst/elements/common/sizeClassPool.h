@@ -0,0 +1,166 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_ELEMENTS_COMMON_SIZECLASSPOOL_H
+#define SST_ELEMENTS_COMMON_SIZECLASSPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace SST { namespace Elements {
+
+/**
+ * Recycling allocator for objects that are created and deleted at a high rate.
+ *
+ * A class routes its class-level operator new/delete here. Blocks are bucketed
+ * into size classes of 'granularity' bytes so that a class and its subclasses
+ * share the pool; larger blocks go to the heap. Each thread has its own free
+ * lists, and a block freed on a different thread than it was allocated on simply
+ * joins that thread's lists. Each list is capped at maxFree blocks so that a
+ * transient burst does not pin memory for the rest of the simulation.
+ *
+ * Each Tag type gets its own pools and counters. Header-only so that any element
+ * can use it without depending on another element.
+ */
+template <typename Tag, size_t granularity = 16, size_t numClasses = 32, uint32_t maxFree = 4096>
+class SizeClassPool {
+public:
+    /* Pool counters, summed across all threads */
+    struct Stats {
+        uint64_t allocs;        // Total allocations requested
+        uint64_t hits;          // Allocations satisfied from a free list
+        uint64_t frees;         // Total blocks released
+        uint64_t retained;      // Released blocks kept for reuse
+        uint64_t heapBytes;     // Bytes requested from the heap
+        uint64_t maxSize;       // Largest single allocation
+    };
+
+    static void* allocate(size_t size) {
+        ThreadPool * pool = local();
+        bump(pool->allocs);
+        if (size > pool->maxSize.load(std::memory_order_relaxed))
+            pool->maxSize.store(size, std::memory_order_relaxed);
+
+        size_t cls = sizeClass(size);
+        if (cls < numClasses && pool->head[cls] != nullptr) {
+            FreeBlock * block = pool->head[cls];
+            pool->head[cls] = block->next;
+            pool->count[cls]--;
+            bump(pool->hits);
+            return block;
+        }
+
+        size_t bytes = cls < numClasses ? (cls + 1) * granularity : size;
+        pool->heapBytes.store(pool->heapBytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+        return ::operator new(bytes);
+    }
+
+    static void release(void* ptr, size_t size) {
+        if (ptr == nullptr) return;
+        ThreadPool * pool = local();
+        bump(pool->frees);
+
+        size_t cls = sizeClass(size);
+        if (cls < numClasses && pool->count[cls] < maxFree) {
+            FreeBlock * block = static_cast<FreeBlock*>(ptr);
+            block->next = pool->head[cls];
+            pool->head[cls] = block;
+            pool->count[cls]++;
+            bump(pool->retained);
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    static Stats getStats() {
+        Stats stats = {0, 0, 0, 0, 0, 0};
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (ThreadPool * pool : registry()) {
+            stats.allocs += pool->allocs.load(std::memory_order_relaxed);
+            stats.hits += pool->hits.load(std::memory_order_relaxed);
+            stats.frees += pool->frees.load(std::memory_order_relaxed);
+            stats.retained += pool->retained.load(std::memory_order_relaxed);
+            stats.heapBytes += pool->heapBytes.load(std::memory_order_relaxed);
+            uint64_t maxSize = pool->maxSize.load(std::memory_order_relaxed);
+            if (maxSize > stats.maxSize) stats.maxSize = maxSize;
+        }
+        return stats;
+    }
+
+private:
+    static_assert(granularity >= sizeof(void*), "SizeClassPool: granularity must hold a free list pointer");
+
+    struct FreeBlock {
+        FreeBlock * next;
+    };
+
+    /* Counters are written only by the owning thread but may be read by any thread */
+    struct ThreadPool {
+        FreeBlock * head[numClasses];
+        uint32_t count[numClasses];
+        std::atomic<uint64_t> allocs;
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> frees;
+        std::atomic<uint64_t> retained;
+        std::atomic<uint64_t> heapBytes;
+        std::atomic<uint64_t> maxSize;
+
+        ThreadPool() : allocs(0), hits(0), frees(0), retained(0), heapBytes(0), maxSize(0) {
+            for (size_t i = 0; i < numClasses; i++) {
+                head[i] = nullptr;
+                count[i] = 0;
+            }
+        }
+    };
+
+    static size_t sizeClass(size_t size) {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    static void bump(std::atomic<uint64_t> &ctr) {
+        ctr.store(ctr.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static std::mutex& registryMutex() {
+        static std::mutex mtx;
+        return mtx;
+    }
+
+    static std::vector<ThreadPool*>& registry() {
+        static std::vector<ThreadPool*> * pools = new std::vector<ThreadPool*>();
+        return *pools;
+    }
+
+    /* Pools are intentionally never destroyed: objects may still be deleted during
+     * simulation teardown after the owning thread's thread_local storage is gone */
+    static ThreadPool* local() {
+        static thread_local ThreadPool * pool = nullptr;
+        if (pool == nullptr) {
+            pool = new ThreadPool();
+            std::lock_guard<std::mutex> lock(registryMutex());
+            registry().push_back(pool);
+        }
+        return pool;
+    }
+};
+
+}}
+
+#endif /* SST_ELEMENTS_COMMON_SIZECLASSPOOL_H */
@@ -0,0 +1,98 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "embermatchqueue.h"
+
+#define TAG 0xf00d0000
+
+using namespace SST::Ember;
+
+EmberMatchQueueGenerator::EmberMatchQueueGenerator(SST::ComponentId_t id, Params& params) :
+	EmberMessagePassingGenerator(id, params, "MatchQueue"),
+    m_startTime( 0 ),
+    m_stopTime( 0 ),
+    m_totalTime( 0 ),
+    m_loopIndex( 0 )
+{
+	m_msgSize    = (uint32_t) params.find("arg.msgSize", 0);
+	m_depth      = (uint32_t) params.find("arg.depth", 1024);
+	m_iterations = (uint32_t) params.find("arg.iterations", 1);
+	m_unexpected = params.find<bool>("arg.unexpected", false);
+    m_reqs.resize( m_depth );
+    m_resp.resize( m_depth );
+}
+
+bool EmberMatchQueueGenerator::generate( std::queue<EmberEvent*>& evQ)
+{
+    assert( 2 == size() );
+
+    // note that the first time through start and stop are 0
+    m_totalTime += m_stopTime - m_startTime;
+
+    // if are done printout results and exit
+    if ( m_loopIndex == m_iterations  ) {
+        if ( 1 == rank() ) {
+            double totalMsgs = (double) m_depth * m_iterations;
+            output("MatchQueue: %s depth %" PRIu32 ", msgSize %" PRIu32 ", totalTime %.6f sec, %.0f ns/msg\n",
+                        m_unexpected ? "unexpected" : "posted",
+                        m_depth, m_msgSize,
+                        (double) m_totalTime / 1000000000.0,
+                        m_totalTime / totalMsgs );
+        }
+        return true;
+    }
+
+    // Rank 0 sends in the reverse order of the tags rank 1 receives, so each
+    // match is against the far end of the posted (or unexpected) queue, the
+    // worst case for a linear search
+    if ( 0 == rank() ) {
+        if ( ! m_unexpected ) {
+            enQ_barrier( evQ, GroupWorld );
+        }
+        for ( unsigned int i = m_depth; i > 0; i-- ) {
+            enQ_isend( evQ, NULL, m_msgSize, CHAR, 1, TAG + i - 1,
+                                                GroupWorld, &m_reqs[i-1] );
+        }
+        enQ_waitall( evQ, m_depth, &m_reqs[0],
+                                        (MessageResponse**)&m_resp[0] );
+        if ( m_unexpected ) {
+            enQ_barrier( evQ, GroupWorld );
+        }
+    } else {
+        if ( m_unexpected ) {
+            enQ_barrier( evQ, GroupWorld );
+            enQ_getTime( evQ, &m_startTime );
+        }
+        for ( unsigned int i = 0; i < m_depth; i++ ) {
+            enQ_irecv( evQ, NULL, m_msgSize, CHAR, 0, TAG + i,
+                                                GroupWorld, &m_reqs[i] );
+        }
+        if ( ! m_unexpected ) {
+            enQ_barrier( evQ, GroupWorld );
+            enQ_getTime( evQ, &m_startTime );
+        }
+        enQ_waitall( evQ, m_depth, &m_reqs[0],
+                                        (MessageResponse**)&m_resp[0] );
+        enQ_getTime( evQ, &m_stopTime );
+    }
+
+    if ( ++m_loopIndex == m_iterations ) {
+        enQ_compute(evQ,0);
+    }
+
+    return false;
+}
@@ -0,0 +1,34 @@
+#!/bin/bash
+# Compare simulated receive matching time per message for the list and
+# hashed ctrlMsg match engines as the posted/unexpected queue gets deeper.
+# Usage: ./matchQueueBench.sh [posted|unexpected] [matchDelayModel]
+#
+# With the list engine ns/msg grows with depth; with the hashed engine it
+# should stay flat. pqs.maxUnexpectedMsg is raised to the depth so every
+# message can be buffered.
+
+MODE=${1:-posted}
+DELAYMODEL=${2:-perCompare}
+
+if [ "$MODE" == "unexpected" ] ; then
+    UNEXPECTED=1
+else
+    UNEXPECTED=0
+fi
+
+for depth in 64 256 1024 4096 ; do
+    for engine in list hashed ; do
+        result=$(sst --model-options=" \
+--topo=torus \
+--shape=2 \
+--numNodes=2 \
+--cmdLine=\"Init\" \
+--cmdLine=\"MatchQueue depth=${depth} unexpected=${UNEXPECTED}\" \
+--cmdLine=\"Fini\" \
+--param=hermes:hermesParams.ctrlMsg.pqs.matchEngine=${engine} \
+--param=hermes:hermesParams.ctrlMsg.pqs.matchDelayModel=${DELAYMODEL} \
+--param=hermes:hermesParams.ctrlMsg.pqs.maxUnexpectedMsg=${depth} \
+" emberLoad.py 2>&1 | grep "MatchQueue:" | sed -e 's/.*MatchQueue: //')
+        echo "${engine}: ${result}"
+    done
+done
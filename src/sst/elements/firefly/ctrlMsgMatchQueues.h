@@ -0,0 +1,261 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_CTRL_MSG_MATCH_QUEUES_H
+#define COMPONENTS_FIREFLY_CTRL_MSG_MATCH_QUEUES_H
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+#include "ctrlMsg.h"
+#include "ctrlMsgCommReq.h"
+
+namespace SST {
+namespace Firefly {
+namespace CtrlMsg {
+
+// A posted receive or unexpected message is filed under the
+// (communicator, source, tag) of its header. Receives that use AnySrc,
+// AnyTag or a tag mask can not be filed under a single key and are kept
+// in a separate list ordered by arrival.
+struct MatchKey {
+    MatchKey( MatchHdr& hdr ) :
+        group( hdr.group ), rank( hdr.rank ), tag( hdr.tag ) {}
+
+    bool operator==( const MatchKey& rhs ) const {
+        return group == rhs.group && rank == rhs.rank && tag == rhs.tag;
+    }
+
+    MP::Communicator group;
+    MP::RankID       rank;
+    uint64_t         tag;
+};
+
+struct MatchKeyHash {
+    size_t operator()( const MatchKey& key ) const {
+        uint64_t h = key.tag * 0x9e3779b97f4a7c15ULL;
+        h ^= ( (uint64_t) key.rank << 32 | key.group ) + 0x7f4a7c159e3779b9ULL + ( h << 6 ) + ( h >> 2 );
+        return h;
+    }
+};
+
+typedef std::function<bool( MatchHdr&, MatchHdr&, uint64_t )> MatchFunc;
+
+static inline bool isWildcard( MatchHdr& hdr, uint64_t ignore ) {
+    return ignore || AnyTag == hdr.tag || MP::AnySrc == hdr.rank;
+}
+
+// Posted receive queue. In list mode every receive is kept in the arrival
+// ordered list and a search walks it from the front, which is the original
+// firefly behavior. In hashed mode a message is compared against the bucket
+// for its key and the wildcard receives posted before the first bucket
+// match, so the number of headers compared does not grow with the number
+// of unrelated receives. In both modes the receive that matches is the
+// earliest posted one, as required by MPI ordering.
+class PostedRecvQueue {
+
+    struct Entry {
+        Entry( uint64_t _seq, _CommReq* _req ) : seq(_seq), req(_req) {}
+        uint64_t    seq;
+        _CommReq*   req;
+    };
+
+    typedef std::deque<Entry> EntryList;
+    typedef std::unordered_map<MatchKey, EntryList, MatchKeyHash> BucketMap;
+
+  public:
+    PostedRecvQueue() : m_hashed(false), m_seq(0), m_size(0) {}
+
+    void init( bool hashed, MatchFunc match ) {
+        m_hashed = hashed;
+        m_match = match;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return 0 == m_size; }
+
+    void push( _CommReq* req ) {
+        if ( ! m_hashed || isWildcard( req->hdr(), req->ignore() ) ) {
+            m_wild.push_back( Entry( m_seq++, req ) );
+        } else {
+            m_buckets[ MatchKey( req->hdr() ) ].push_back( Entry( m_seq++, req ) );
+        }
+        ++m_size;
+    }
+
+    // returns and removes the earliest posted receive that matches hdr,
+    // count is incremented for every posted header compared
+    _CommReq* search( MatchHdr& hdr, int& count ) {
+        BucketMap::iterator bucket = m_buckets.end();
+        EntryList::iterator found;
+        bool haveBucketMatch = false;
+
+        if ( m_hashed ) {
+            bucket = m_buckets.find( MatchKey( hdr ) );
+            if ( bucket != m_buckets.end() ) {
+                for ( found = bucket->second.begin(); found != bucket->second.end(); ++found ) {
+                    ++count;
+                    if ( m_match( hdr, found->req->hdr(), found->req->ignore() ) ) {
+                        haveBucketMatch = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // a wildcard receive only wins if it was posted before the bucket match
+        EntryList::iterator iter = m_wild.begin();
+        for ( ; iter != m_wild.end(); ++iter ) {
+            if ( haveBucketMatch && iter->seq > found->seq ) {
+                break;
+            }
+            ++count;
+            if ( m_match( hdr, iter->req->hdr(), iter->req->ignore() ) ) {
+                _CommReq* req = iter->req;
+                m_wild.erase( iter );
+                --m_size;
+                return req;
+            }
+        }
+
+        if ( haveBucketMatch ) {
+            _CommReq* req = found->req;
+            bucket->second.erase( found );
+            if ( bucket->second.empty() ) {
+                m_buckets.erase( bucket );
+            }
+            --m_size;
+            return req;
+        }
+        return NULL;
+    }
+
+    // Cancel is rare so this looks at every posted receive rather than
+    // dereferencing req, which the caller may no longer own
+    bool remove( _CommReq* req ) {
+        if ( erase( m_wild, req ) ) {
+            return true;
+        }
+        BucketMap::iterator bucket = m_buckets.begin();
+        for ( ; bucket != m_buckets.end(); ++bucket ) {
+            if ( erase( bucket->second, req ) ) {
+                if ( bucket->second.empty() ) {
+                    m_buckets.erase( bucket );
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    bool erase( EntryList& list, _CommReq* req ) {
+        EntryList::iterator iter = list.begin();
+        for ( ; iter != list.end(); ++iter ) {
+            if ( iter->req == req ) {
+                list.erase( iter );
+                --m_size;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool        m_hashed;
+    MatchFunc   m_match;
+    uint64_t    m_seq;
+    size_t      m_size;
+    EntryList   m_wild;
+    BucketMap   m_buckets;
+};
+
+// Unexpected message index used in hashed mode. Messages always have a
+// concrete source and tag so every message is filed under its key, and the
+// arrival order list is only walked for a wildcard receive.
+template< class T >
+class UnexpectedMsgIndex {
+
+    typedef std::list<T*> ArrivalList;
+    typedef std::deque<typename ArrivalList::iterator> EntryList;
+    typedef std::unordered_map<MatchKey, EntryList, MatchKeyHash> BucketMap;
+
+  public:
+    void init( MatchFunc match ) {
+        m_match = match;
+    }
+
+    size_t size() const { return m_arrival.size(); }
+    bool empty() const { return m_arrival.empty(); }
+
+    void push( T* msg ) {
+        m_buckets[ MatchKey( msg->hdr() ) ].push_back(
+                m_arrival.insert( m_arrival.end(), msg ) );
+    }
+
+    // returns and removes the earliest arrived message that matches the
+    // receive header, count is incremented for every message header compared
+    T* search( MatchHdr& want, uint64_t ignore, int& count ) {
+        if ( isWildcard( want, ignore ) ) {
+            typename ArrivalList::iterator iter = m_arrival.begin();
+            for ( ; iter != m_arrival.end(); ++iter ) {
+                ++count;
+                if ( m_match( (*iter)->hdr(), want, ignore ) ) {
+                    return remove( m_buckets.find( MatchKey( (*iter)->hdr() ) ), iter );
+                }
+            }
+        } else {
+            typename BucketMap::iterator bucket = m_buckets.find( MatchKey( want ) );
+            if ( bucket != m_buckets.end() ) {
+                typename EntryList::iterator iter = bucket->second.begin();
+                for ( ; iter != bucket->second.end(); ++iter ) {
+                    ++count;
+                    if ( m_match( (**iter)->hdr(), want, ignore ) ) {
+                        return remove( bucket, *iter );
+                    }
+                }
+            }
+        }
+        return NULL;
+    }
+
+  private:
+    T* remove( typename BucketMap::iterator bucket, typename ArrivalList::iterator pos ) {
+        T* msg = *pos;
+        typename EntryList::iterator iter = bucket->second.begin();
+        for ( ; iter != bucket->second.end(); ++iter ) {
+            if ( *iter == pos ) {
+                bucket->second.erase( iter );
+                break;
+            }
+        }
+        if ( bucket->second.empty() ) {
+            m_buckets.erase( bucket );
+        }
+        m_arrival.erase( pos );
+        return msg;
+    }
+
+    MatchFunc   m_match;
+    ArrivalList m_arrival;
+    BucketMap   m_buckets;
+};
+
+}
+}
+}
+
+#endif
@@ -50,8 +50,32 @@ ProcessQueuesState::ProcessQueuesState( ComponentId_t id, Params& params ) :
 
     m_dbg.init("", level, mask, Output::STDOUT );
 
+    std::string matchEngine = params.find<std::string>("pqs.matchEngine","list");
+    if ( matchEngine == "list" ) {
+        m_hashedMatch = false;
+    } else if ( matchEngine == "hashed" ) {
+        m_hashedMatch = true;
+    } else {
+        m_dbg.fatal(CALL_INFO,-1,"Error: unknown pqs.matchEngine '%s', expected list or hashed\n", matchEngine.c_str());
+    }
+
+    std::string matchDelayModel = params.find<std::string>("pqs.matchDelayModel","perCompare");
+    if ( matchDelayModel == "perCompare" ) {
+        m_matchDelayModel = PerCompare;
+    } else if ( matchDelayModel == "perMatch" ) {
+        m_matchDelayModel = PerMatch;
+    } else {
+        m_dbg.fatal(CALL_INFO,-1,"Error: unknown pqs.matchDelayModel '%s', expected perCompare or perMatch\n", matchDelayModel.c_str());
+    }
+
+    MatchFunc match = std::bind( &ProcessQueuesState::checkMatchHdr, this,
+                std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 );
+    m_pstdRcvQ.init( m_hashedMatch, match );
+    m_unexpectedIdx.init( match );
+
     m_statPstdRcv = registerStatistic<uint64_t>("posted_receive_list");
     m_statRcvdMsg = registerStatistic<uint64_t>("received_msg_list");
+    m_statMatchCmp = registerStatistic<uint64_t>("match_compares");
 
     m_msgTiming = loadAnonymousSubComponent< MsgTiming >( "firefly.msgTiming", "", 0, ComponentInfo::SHARE_NONE, params );
 
@@ -328,7 +352,19 @@ void ProcessQueuesState::processRecv_0( _CommReq* req )
 
 void ProcessQueuesState::processRecv_1( _CommReq* req )
 {
-    if ( ! m_unexpectedMsgQ.empty() ) {
+    if ( m_hashedMatch ) {
+        if ( m_unexpectedIdx.empty() ) {
+            processRecv_3( req, NULL );
+        } else {
+            dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"search unexpected index\n");
+            int count = 0;
+            Msg* msg = m_unexpectedIdx.search( req->hdr(), req->ignore(), count );
+            m_mem->walk(
+                std::bind( &ProcessQueuesState::processRecv_3, this, req, msg ),
+                matchCost( count )
+            );
+        }
+    } else if ( ! m_unexpectedMsgQ.empty() ) {
 
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"check unexpected queue\n");
 
@@ -343,7 +379,29 @@ void ProcessQueuesState::processRecv_1( _CommReq* req )
         processShortList_0( &m_funcStack );
     } else {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"post receive\n");
-        m_pstdRcvQ.push_back( req );
+        m_pstdRcvQ.push( req );
+        processRecv_2( NULL, req );
+    }
+}
+
+void ProcessQueuesState::processRecv_3( _CommReq* req, Msg* msg )
+{
+    if ( msg ) {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"matched unexpected msg\n");
+
+        ProcessQueuesCtx* ctx = new ProcessQueuesCtx(
+            std::bind( &ProcessQueuesState::processRecv_2, this, &m_funcStack, req )
+        );
+        m_funcStack.push_back( ctx );
+
+        ProcessShortListCtx* listCtx = new ProcessShortListCtx( msg );
+        listCtx->req = req;
+        m_funcStack.push_back( listCtx );
+
+        processShortList_2( &m_funcStack );
+    } else {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"post receive\n");
+        m_pstdRcvQ.push( req );
         processRecv_2( NULL, req );
     }
 }
@@ -358,7 +416,7 @@ void ProcessQueuesState::processRecv_2( Stack* stack, _CommReq* req )
 
     if ( ! m_pstdRcvPreQ.empty() ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"no match against unexpected queue move to pstRecvQ\n");
-        m_pstdRcvQ.push_back( m_pstdRcvPreQ.front() );
+        m_pstdRcvQ.push( m_pstdRcvPreQ.front() );
         m_pstdRcvPreQ.clear();
     }
 
@@ -408,15 +466,10 @@ void ProcessQueuesState::processMakeProgress( Stack* stack )
 
 void ProcessQueuesState::enterCancel( MP::MessageRequest req, uint64_t exitDelay ) {
 
-    std::deque< _CommReq* >:: iterator iter = m_pstdRcvQ.begin();
-    for ( ; iter != m_pstdRcvQ.end(); ++iter ) {
-
-		if ( *iter == req ) {
-    		dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",*iter);
-			delete( *iter );
-        	m_pstdRcvQ.erase(iter);
-			break;
-		}
+    _CommReq* commReq = static_cast<_CommReq*>( req );
+    if ( m_pstdRcvQ.remove( commReq ) ) {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",commReq);
+        delete commReq;
     }
     enterMakeProgress(m_exitDelay);
 }
@@ -536,7 +589,7 @@ void ProcessQueuesState::processWaitCtx_2( WaitCtx* ctx )
 void ProcessQueuesState::processQueues( Stack* stack )
 {
     dbg().debug(CALL_INFO,1,DBG_MSK_PQS_Q,"recvdMsgQ=%s m_unexpectedMsgQ=%zu m_pstdRecvPre=%zu m_pstdRcvQ=%zu\n",
-							recvdMsgQsize(), m_unexpectedMsgQ.size(), m_pstdRcvPreQ.size(), m_pstdRcvQ.size() );
+							recvdMsgQsize(), unexpectedMsgQsize(), m_pstdRcvPreQ.size(), m_pstdRcvQ.size() );
     dbg().debug(CALL_INFO,1,DBG_MSK_PQS_Q,"stack.size()=%lu\n", stack->size());
 
     assert ( ! m_intStack.empty() );
@@ -629,12 +682,14 @@ void ProcessQueuesState::processShortList_1( Stack* stack )
     if ( m_intStack.empty() ) {
         ctx->req = searchPostedRecv( m_pstdRcvPreQ, ctx->hdr(), count );
     } else {
-        ctx->req = searchPostedRecv( m_pstdRcvQ, ctx->hdr(), count );
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"posted size %lu\n",m_pstdRcvQ.size());
+        ctx->req = m_pstdRcvQ.search( ctx->hdr(), count );
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"req=%p\n",ctx->req);
     }
 
     m_mem->walk(
         std::bind( &ProcessQueuesState::processShortList_2, this, stack ),
-        count
+        matchCost( count )
     );
 }
 
@@ -654,7 +709,7 @@ void ProcessQueuesState::processShortList_2( Stack* stack )
         if ( m_intStack.empty() ) {
             ctx->incPos();
         } else {
-            m_unexpectedMsgQ.push_back( ctx->msg() );
+            pushUnexpectedMsg( ctx->msg() );
             ctx->unlinkMsg();
         }
         processShortList_5( stack );
@@ -28,6 +28,7 @@
 
 #include "ctrlMsgCommReq.h"
 #include "ctrlMsgWaitReq.h"
+#include "ctrlMsgMatchQueues.h"
 
 #define DBG_MSK_PQS_APP_SIDE 1 << 0
 #define DBG_MSK_PQS_INT 1 << 1
@@ -92,6 +93,8 @@ class ProcessQueuesState : public SubComponent
         {"recvStateDelay_ps","", "0"},
         {"waitallStateDelay_ps","", "0"},
         {"waitanyStateDelay_ps","", "0"},
+        {"pqs.matchEngine","Sets how posted receives and unexpected messages are matched: list or hashed", "list"},
+        {"pqs.matchDelayModel","Sets how matchDelay_ns is charged: perCompare charges each header compared, perMatch charges once per search that compared at least one header", "perCompare"},
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -100,7 +103,8 @@ class ProcessQueuesState : public SubComponent
     
     SST_ELI_DOCUMENT_STATISTICS(
         { "posted_receive_list", "", "count", 1 },
-        { "received_msg_list", "", "count", 1 }
+        { "received_msg_list", "", "count", 1 },
+        { "match_compares", "Number of headers compared per match search", "count", 1 }
     )
 
   private:
@@ -140,6 +144,11 @@ class ProcessQueuesState : public SubComponent
     int m_minPostedShortBuffers;
     int m_maxUnexpectedMsg;
 
+    enum MatchDelayModel { PerCompare, PerMatch };
+
+    bool m_hashedMatch;
+    MatchDelayModel m_matchDelayModel;
+
   public:
     ProcessQueuesState( ComponentId_t id, Params& params );
     ~ProcessQueuesState();
@@ -282,7 +291,11 @@ class ProcessQueuesState : public SubComponent
       public:
 
         ProcessShortListCtx( std::deque<Msg*>* msgQ ) :
-			m_msgQ(msgQ), m_iter( msgQ->begin() ), m_done(false) {}
+			m_done(false), m_msgQ(msgQ), m_iter( msgQ->begin() ) {}
+
+        // used when the message was already found by the unexpected index
+        ProcessShortListCtx( Msg* msg ) :
+			m_single( 1, msg ), m_done(false), m_msgQ(&m_single), m_iter( m_single.begin() ) {}
 
         MatchHdr&   hdr() { return (*m_iter)->hdr(); }
         std::vector<IoVec>& ioVec() { return (*m_iter)->ioVec(); }
@@ -301,6 +314,7 @@ class ProcessQueuesState : public SubComponent
         bool isDone() { return m_done || m_iter == m_msgQ->end();  }
         void incPos() { ++m_iter; }
       private:
+        std::deque<Msg*>                        m_single;
         bool m_done;
         std::deque<Msg*>*                       m_msgQ;
         typename std::deque<Msg*>::iterator 	m_iter;
@@ -342,6 +356,7 @@ class ProcessQueuesState : public SubComponent
     void processRecv_0( _CommReq* );
     void processRecv_1( _CommReq* );
     void processRecv_2( Stack*,_CommReq* );
+    void processRecv_3( _CommReq*, Msg* );
 
     void processMakeProgress( Stack* );
 
@@ -381,6 +396,26 @@ class ProcessQueuesState : public SubComponent
     bool        checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr, uint64_t ignore );
     _CommReq*	searchPostedRecv( std::deque< _CommReq* >& pstd, MatchHdr& hdr, int& delay );
 
+    int matchCost( int compared ) {
+        m_statMatchCmp->addData( compared );
+        if ( m_matchDelayModel == PerMatch ) {
+            return compared ? 1 : 0;
+        }
+        return compared;
+    }
+
+    size_t unexpectedMsgQsize() {
+        return m_hashedMatch ? m_unexpectedIdx.size() : m_unexpectedMsgQ.size();
+    }
+
+    void pushUnexpectedMsg( Msg* msg ) {
+        if ( m_hashedMatch ) {
+            m_unexpectedIdx.push( msg );
+        } else {
+            m_unexpectedMsgQ.push_back( msg );
+        }
+    }
+
     void exit( int delay = 0 ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"exit ProcessQueuesState\n");
         passCtrlToFunction( m_exitDelay + delay );
@@ -446,7 +481,7 @@ class ProcessQueuesState : public SubComponent
     }
     void passCtrlToFunction( uint64_t delay = 0 ) {
         dbg().debug(CALL_INFO,1,DBG_MSK_PQS_Q,"recvdMsgV=%zu,%zu:%d m_unexpectedMsgQ=%zu m_pstdRecvPre=%zu m_pstdRcvQ=%zu\n",
-                            m_recvdMsgQ[0].size(), m_recvdMsgQ[1].size(), m_recvdMsgQpos, m_unexpectedMsgQ.size(), m_pstdRcvPreQ.size(), m_pstdRcvQ.size() );
+                            m_recvdMsgQ[0].size(), m_recvdMsgQ[1].size(), m_recvdMsgQpos, unexpectedMsgQsize(), m_pstdRcvPreQ.size(), m_pstdRcvQ.size() );
         m_returnToCaller->send( delay, NULL );
     }
 
@@ -480,11 +515,12 @@ class ProcessQueuesState : public SubComponent
     int     m_numRecvLooped;
     bool    m_missedInt;
 
-    std::deque< _CommReq* >         m_pstdRcvQ;
+    PostedRecvQueue                 m_pstdRcvQ;
     std::deque< _CommReq* >         m_pstdRcvPreQ;
     std::vector<std::deque< Msg* >> m_recvdMsgQ;
 	int m_recvdMsgQpos;
     std::deque< Msg* >              m_unexpectedMsgQ;
+    UnexpectedMsgIndex< Msg >       m_unexpectedIdx;
 
     std::deque< _CommReq* >         m_longGetFiniQ;
     std::deque< GetInfo* >          m_longAckQ;
@@ -506,6 +542,7 @@ class ProcessQueuesState : public SubComponent
 
     Statistic<uint64_t>* m_statRcvdMsg;
     Statistic<uint64_t>* m_statPstdRcv;
+    Statistic<uint64_t>* m_statMatchCmp;
     int m_numSent;
     int m_numRecv;
     int m_nicsPerNode;
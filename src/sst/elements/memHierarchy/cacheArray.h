@@ -17,8 +17,14 @@
 #define CACHEARRAY_H
 
 #include <vector>
+#include <stdlib.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 #include <sst/core/output.h>
+#include <sst/core/statapi/statbase.h>
 
 #include "sst/elements/memHierarchy/memTypes.h"
 #include "sst/elements/memHierarchy/hash.h"
@@ -51,7 +57,18 @@ class CacheArray {
         unsigned int    banks_;
         vector<T*>      lines_; // The actual cache
         State* setStates;
-        std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+        vector<ReplacementInfo*> rInfo_;   // ReplacementInfo for each line, set-major so that a set's entries are contiguous
+
+        /* Packed tag store (optional): each set's line addresses are kept contiguously
+         * in tags_ so that lookup compares all ways at once instead of dereferencing lines_.
+         * Sets are padded to a multiple of 4 entries and aligned for vector loads.
+         * lines_ remains the parallel array holding state and replacement info. */
+        Addr*           tags_;
+        unsigned int    tagStride_;
+        Statistic<uint64_t>* statPackedLookups_;    // Lookups served by tags_, if the owner registered it
+
+        int findWay(Addr* setTags, Addr addr);
+        void syncTag(unsigned int index) { if (tags_) tags_[(index / associativity_) * tagStride_ + (index % associativity_)] = lines_[index]->getAddr(); }
     public:
 
         CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
@@ -88,6 +105,7 @@ class CacheArray {
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
         void setBanked(unsigned int numBanks);
+        void setPackedTags(bool packed, Statistic<uint64_t>* lookups = nullptr);
         void printCacheArray(Output &out);
 };
 
@@ -125,18 +143,19 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
         lines_[i] = new T(lineSize_, i);
     }
 
-    // Construct rInfo
-    for (unsigned int i = 0; i < numSets_; i++) {
-        std::vector<ReplacementInfo*> setInfo;
-        for (unsigned int j = 0; j < associativity; j++)
-            setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
-        rInfo.insert(std::make_pair(i, setInfo));
-    }
-    ReplacementInfo * info = rInfo.find(0)->second.front();
+    // Construct rInfo_
+    rInfo_.resize(numLines_);
+    for (unsigned int i = 0; i < numLines_; i++)
+        rInfo_[i] = lines_[i]->getReplacementInfo();
+    ReplacementInfo * info = rInfo_[0];
     if (!replacementMgr_->checkCompatibility(info))
         dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The replacement policy expects cache line state that is not provided by the cache line type of this cache. Check the type of the ReplacementInfo returned by the coherence protocol's line type and the ReplacementInfo type expected by the replacement policy.\n");
 
     setStates = new State[associativity_];
+
+    tags_ = nullptr;
+    tagStride_ = 0;
+    statPackedLookups_ = nullptr;
 }
 
 template <class T>
@@ -146,6 +165,7 @@ CacheArray<T>::~CacheArray() {
     delete replacementMgr_;
     delete hash_;
     delete [] setStates;
+    free(tags_);
 }
 
 template <class T>
@@ -163,6 +183,17 @@ T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
     int setBegin = set * associativity_;
     int setEnd = setBegin + associativity_;
 
+    if (tags_) {
+        if (statPackedLookups_)
+            statPackedLookups_->addData(1);
+        int way = findWay(&tags_[set * tagStride_], addr);
+        if (way < 0)
+            return nullptr;
+        if (updateReplacement)
+            replacementMgr_->update(setBegin + way, lines_[setBegin + way]->getReplacementInfo());
+        return lines_[setBegin + way];
+    }
+
     for (int i = setBegin; i < setEnd; i++) {
         if (lines_[i]->getAddr() == addr) {
             if (updateReplacement)
@@ -178,7 +209,8 @@ T * CacheArray<T>::findReplacementCandidate(Addr addr) {
     Addr laddr = toLineAddr(addr);
     int set = hash_->hash(0, laddr) % numSets_;
 
-    unsigned int id = replacementMgr_->findBestCandidate(rInfo[set]);
+    unsigned int setBegin = set * associativity_;
+    unsigned int id = replacementMgr_->findBestCandidate(setBegin, &rInfo_[setBegin], associativity_);
 
     return lines_[id];
 }
@@ -189,6 +221,7 @@ void CacheArray<T>::replace(Addr addr, T* candidate) {
     replacementMgr_->replaced(index);
     candidate->reset();
     candidate->setAddr(addr);
+    syncTag(index);
     replacementMgr_->update(index, lines_[index]->getReplacementInfo());
 }
 
@@ -197,6 +230,41 @@ void CacheArray<T>::deallocate(T* candidate) {
     unsigned int index = candidate->getIndex();
     replacementMgr_->replaced(index);
     candidate->reset();
+    syncTag(index);
+}
+
+/* Return the lowest way in the set whose tag matches addr, or -1 */
+template <class T>
+int CacheArray<T>::findWay(Addr* setTags, Addr addr) {
+#if defined(__AVX2__)
+    __m256i key = _mm256_set1_epi64x((long long)addr);
+    for (unsigned int w = 0; w < tagStride_; w += 4) {
+        __m256i cmp = _mm256_cmpeq_epi64(_mm256_load_si256((__m256i*)&setTags[w]), key);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(cmp));
+        if (mask) {
+            unsigned int way = w + __builtin_ctz(mask);
+            return way < associativity_ ? (int)way : -1; // Padding matched, no real way did
+        }
+    }
+#elif defined(__SSE2__)
+    // No 64-bit compare in SSE2: compare 32-bit halves and require both to match
+    __m128i key = _mm_set1_epi64x((long long)addr);
+    for (unsigned int w = 0; w < tagStride_; w += 2) {
+        __m128i cmp = _mm_cmpeq_epi32(_mm_load_si128((__m128i*)&setTags[w]), key);
+        cmp = _mm_and_si128(cmp, _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2,3,0,1)));
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(cmp));
+        if (mask) {
+            unsigned int way = w + __builtin_ctz(mask);
+            return way < associativity_ ? (int)way : -1;
+        }
+    }
+#else
+    for (unsigned int w = 0; w < associativity_; w++) {
+        if (setTags[w] == addr)
+            return w;
+    }
+#endif
+    return -1;
 }
 
 template <class T>
@@ -212,6 +280,25 @@ void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
 }
 
+template <class T>
+void CacheArray<T>::setPackedTags(bool packed, Statistic<uint64_t>* lookups) {
+    free(tags_);
+    tags_ = nullptr;
+    statPackedLookups_ = lookups;
+    if (!packed)
+        return;
+
+    tagStride_ = (associativity_ + 3) & ~3u;
+    if (posix_memalign((void**)&tags_, 32, sizeof(Addr) * tagStride_ * numSets_) != 0)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: unable to allocate packed tag store for %u sets x %u ways.\n", numSets_, associativity_);
+
+    // Padding sits after the real ways so a padding match can only be reported if no real way matched
+    for (unsigned int set = 0; set < numSets_; set++) {
+        for (unsigned int way = 0; way < tagStride_; way++)
+            tags_[set * tagStride_ + way] = (way < associativity_) ? lines_[set * associativity_ + way]->getAddr() : 0;
+    }
+}
+
 template <class T>
 void CacheArray<T>::printCacheArray(Output &out) {
     for (unsigned int i = 0; i < numLines_; i++) {
@@ -294,10 +294,16 @@ bool Cache::processEvent(MemEventBase* ev, bool inMSHR) {
             accepted = coherenceMgr_->handleFetchInvX(event, inMSHR);
             break;
         case Command::ForceInv:
-            accepted = coherenceMgr_->handleForceInv(event, inMSHR);
+            if (event->queryFlag(MemEvent::F_IMPRECISE))
+                accepted = coherenceMgr_->handleImpreciseInv(event, inMSHR);
+            else
+                accepted = coherenceMgr_->handleForceInv(event, inMSHR);
             break;
         case Command::Inv:
-            accepted = coherenceMgr_->handleInv(event, inMSHR);
+            if (event->queryFlag(MemEvent::F_IMPRECISE))
+                accepted = coherenceMgr_->handleImpreciseInv(event, inMSHR);
+            else
+                accepted = coherenceMgr_->handleInv(event, inMSHR);
             break;
         case Command::Fetch:
             accepted = coherenceMgr_->handleFetch(event, inMSHR);
@@ -508,6 +514,13 @@ void Cache::finish() {
     }
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->printStats(*out_);
+    if (reportEventPool_) {
+        MemEventPool::Stats poolStats = MemEventPool::getStats();
+        statEventPoolAllocs->addData(poolStats.allocs);
+        statEventPoolHits->addData(poolStats.hits);
+        statEventPoolHeapBytes->addData(poolStats.heapBytes);
+    }
+    coherenceMgr_->finish();
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
 }
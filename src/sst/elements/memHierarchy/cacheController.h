@@ -68,7 +68,13 @@ public:
             {"response_link_width",     "(string) Limits number of response bytes sent per cycle. Use 'B' units. '0B' is unlimited.", "0B"},
             {"noninclusive_directory_entries", "(uint) Number of entries in the directory. Must be at least 1 if the non-inclusive directory exists.", "0"},
             {"noninclusive_directory_associativity", "(uint) For a set-associative directory, number of ways.", "1"},
+            {"sharer_encoding",         "(string) Sharer state format modelled by shared caches (inclusive, and non-inclusive with directory). Invalidations of sharers are sent to every cache the encoding cannot rule out; caches that do not hold the block just acknowledge them. Options: full[bit per upper cache], limited[sharer_pointers pointers, broadcast on overflow], coarse[bit per sharer_group_size upper caches]", "full"},
+            {"sharer_pointers",         "(uint) Number of sharer pointers per line for sharer_encoding=limited", "4"},
+            {"sharer_group_size",       "(uint) Number of upper level caches per bit for sharer_encoding=coarse", "4"},
+            {"sharer_endpoints",        "(uint) Number of upper level caches to size the sharer encoding for. Required for sharer_encoding=limited and coarse. For full, 0 uses the caches seen during simulation.", "0"},
+            {"tag_store",               "(string) How tags are stored for lookups. Options: object[compare the address in each line object], packed[per-set contiguous tag array compared with SIMD]. Both give identical hit/miss results.", "object"},
             {"mshr_num_entries",        "(int) Number of MSHR entries. Not valid for L1s because L1 MSHRs assumed to be sized for the CPU's load/store queue. Setting this to -1 will create a very large MSHR.", "-1"},
+            {"mshr_type",               "(string) MSHR storage. Options: map[ordered map of registers], flat[open-addressed table with registers pooled in slabs sized from mshr_num_entries]", "map"},
             {"tag_access_latency_cycles",
                 "(uint) Latency (in cycles) to access tag portion only of cache. Paid by misses and coherence requests that don't need data. If not specified, defaults to access_latency_cycles","access_latency_cycles"},
             {"mshr_latency_cycles",
@@ -76,10 +82,11 @@ public:
             {"prefetch_delay_cycles",   "(uint) Delay prefetches from prefetcher by this number of cycles.", "1"},
             {"max_outstanding_prefetch","(uint) Maximum number of prefetch misses that can be outstanding, additional prefetches will be dropped/NACKed. Default is 1/2 of MSHR entries.", "0.5*mshr_num_entries"},
             {"drop_prefetch_mshr_level","(uint) Drop/NACK prefetches if the number of in-use mshrs is greater than or equal to this number. Default is mshr_num_entries - 2.", "mshr_num_entries-2"},
-            {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
+            {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices. Slices can be connected over a network or directly to the components above and below with memHierarchy.MemLinkMulti", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
             {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
             {"maxRequestDelay",         "(uint) Set an error timeout if memory requests take longer than this in ns (0: disable)", "0"},
+            {"report_event_pool",       "(bool) At finish(), record the MemEvent pool counters of this rank in the EventPool_* statistics. The counters cover every component on the rank, so enable this on one cache. Options: 0[off], 1[on]", "false"},
             {"snoop_l1_invalidations",  "(bool) Forward invalidations from L1s to processors. Options: 0[off], 1[on]", "false"},
             {"debug",                   "(uint) Where to send output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",             "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
@@ -116,8 +123,13 @@ public:
             {"TotalEventsReceived",     "Total number of events received by this cache", "events", 1},
             {"TotalEventsReplayed",     "Total number of events that were initially blocked and then were replayed", "events", 1},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle", "events", 1},
+            {"MSHR_flat_registers",     "mshr_type=flat only: number of live MSHR registers, sampled each time a register is allocated (Max is the peak)", "registers", 1},
+            {"MSHR_flat_slab_overflow", "mshr_type=flat only: number of register slabs allocated beyond the first because live registers exceeded the slab size", "count", 1},
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
+            {"EventPool_allocations",   "report_event_pool only: MemEvents allocated on this rank, recorded once at finish()", "events", 1},
+            {"EventPool_hits",          "report_event_pool only: MemEvent allocations on this rank served from the pool instead of the heap, recorded once at finish()", "events", 1},
+            {"EventPool_heap_bytes",    "report_event_pool only: bytes the MemEvent pool requested from the heap on this rank, recorded once at finish()", "bytes", 1},
             {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
             /*Event receives */
             {"GetS_recv",               "Event received: GetS", "count", 2},
@@ -268,6 +280,7 @@ private:
     SimTime_t           timeout_;
     uint64_t            maxOutstandingPrefetch_;
     bool                banked_;
+    bool                reportEventPool_;
 
     /** Clocks *****************************************************************/
     Clock::Handler<Cache>*  clockHandler_;
@@ -301,6 +314,11 @@ private:
     Statistic<uint64_t>* statPrefetchRequest;
     Statistic<uint64_t>* statPrefetchDrop;
 
+    // MemEvent pool counters (report_event_pool only)
+    Statistic<uint64_t>* statEventPoolAllocs;
+    Statistic<uint64_t>* statEventPoolHits;
+    Statistic<uint64_t>* statEventPoolHeapBytes;
+
     // Event counts
     Statistic<uint64_t>* statRecvEvents;
     Statistic<uint64_t>* statRetryEvents;
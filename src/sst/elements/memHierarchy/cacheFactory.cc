@@ -65,6 +65,7 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
 
     allNoncacheableRequests_    = params.find<bool>("force_noncacheable_reqs", false);
+    reportEventPool_            = params.find<bool>("report_event_pool", false);
     maxRequestsPerCycle_        = params.find<int>("max_requests_per_cycle",-1);
     string packetSize           = params.find<std::string>("min_packet_size", "8B");
 
@@ -152,6 +153,7 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("associativity", params.find<std::string>("associativity", "-1"));
     coherenceParams.insert("lines", params.find<std::string>("lines", "0"));
     coherenceParams.insert("replacement_policy", params.find<std::string>("replacement_policy", "lru"));
+    coherenceParams.insert("tag_store", params.find<std::string>("tag_store", "object"));
     coherenceParams.insert("dlines", params.find<std::string>("noninclusive_directory_entries", "0"));
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
@@ -647,7 +649,13 @@ uint64_t Cache::createMSHR(Params &params, uint64_t accessLatency, bool L1) {
     if (mshrSize == 1 || mshrSize == 0)
         out_->fatal(CALL_INFO, -1, "Invalid param: mshr_num_entries - MSHR requires at least 2 entries to avoid deadlock. You specified %d\n", mshrSize);
 
-    mshr_ = new MSHR(dbg_, mshrSize, getName(), DEBUG_ADDR);
+    std::string mshrType = params.find<std::string>("mshr_type", "map");
+    if (mshrType != "map" && mshrType != "flat")
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: mshr_type - must be 'map' or 'flat'. You specified: %s\n", getName().c_str(), mshrType.c_str());
+
+    mshr_ = new MSHR(dbg_, mshrSize, getName(), DEBUG_ADDR, mshrType == "flat");
+    if (mshrType == "flat")
+        mshr_->setFlatStatistics(registerStatistic<uint64_t>("MSHR_flat_registers"), registerStatistic<uint64_t>("MSHR_flat_slab_overflow"));
 
     if (mshrLatency > 0 && found)
         return mshrLatency;
@@ -699,6 +707,10 @@ void Cache::createCacheArray(Params &params) {
     uint64_t dEntries = params.find<uint64_t>("noninclusive_directory_entries", 0);
     uint64_t dAssoc = params.find<uint64_t>("noninclusive_directory_associativity", 1);
 
+    std::string tagStore = params.find<std::string>("tag_store", "object");
+    if (tagStore != "object" && tagStore != "packed")
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: tag_store - must be 'object' or 'packed'. You specified '%s'.\n", getName().c_str(), tagStore.c_str());
+
 
     /* Error check parameters and compute derived parameters */
     /* Fix up parameters */
@@ -801,4 +813,10 @@ void Cache::registerStatistics() {
 
     statMSHROccupancy               = registerStatistic<uint64_t>("MSHR_occupancy");
     statBankConflicts               = registerStatistic<uint64_t>("Bank_conflicts");
+
+    if (reportEventPool_) {
+        statEventPoolAllocs         = registerStatistic<uint64_t>("EventPool_allocations");
+        statEventPoolHits           = registerStatistic<uint64_t>("EventPool_hits");
+        statEventPoolHeapBytes      = registerStatistic<uint64_t>("EventPool_heap_bytes");
+    }
 }
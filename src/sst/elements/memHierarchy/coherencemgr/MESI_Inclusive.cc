@@ -1546,7 +1546,7 @@ bool MESIInclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
     if (line->isSharer(event->getSrc()))
         line->removeSharer(event->getSrc());
-    else
+    else if (!event->queryFlag(MemEvent::F_IMPRECISE)) // Imprecise acks come from caches that never had the block
         line->removeOwner();
 
     responses.find(addr)->second.erase(event->getSrc());
@@ -2149,7 +2149,10 @@ bool MESIInclusive::invalidateExceptRequestor(MemEvent * event, SharedCacheLine
     uint64_t deliveryTime = 0;
     std::string rqstr = event->getSrc();
 
-    for (set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
+    std::set<std::string> targets;
+    recordSharerInvalidation(line, rqstr, targets);
+
+    for (set<std::string>::iterator it = targets.begin(); it != targets.end(); it++) {
         if (*it == rqstr) continue;
 
         deliveryTime =  invalidateSharer(*it, event, line, inMSHR);
@@ -2168,7 +2171,9 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
     } else {
         if (cmd == Command::NULLCMD)
             cmd = Command::Inv;
-        for (std::set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
+        std::set<std::string> targets;
+        recordSharerInvalidation(line, "", targets);
+        for (std::set<std::string>::iterator it = targets.begin(); it != targets.end(); it++) {
             deliveryTime = invalidateSharer(*it, event, line, inMSHR, cmd);
         }
         if (deliveryTime != 0) {
@@ -2179,8 +2184,34 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
     return false;
 }
 
+/* Find the caches the sharer encoding sends an invalidation of the sharers to */
+void MESIInclusive::recordSharerInvalidation(SharedCacheLine * line, std::string rqstr, std::set<std::string>& targets) {
+    sharerEncoding_->getTargets(*(line->getSharers()), targets);
+    size_t sharers = line->numSharers();
+    size_t sent = targets.size();
+
+    // The requestor is known, so no encoding needs to invalidate it
+    if (!rqstr.empty()) {
+        if (line->isSharer(rqstr))
+            sharers--;
+        if (targets.find(rqstr) != targets.end())
+            sent--;
+    }
+
+    if (sharers == 0)
+        return;
+
+    stat_sharerInv->addData(sharers);
+    if (sent > sharers) {
+        stat_sharerExtraInv->addData(sent - sharers);
+        stat_sharerImpreciseInv->addData(1);
+    }
+}
+
+
 uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd) {
-    if (line->isSharer(shr)) {
+    bool imprecise = !line->isSharer(shr); // Target of the sharer encoding only
+    if (!imprecise || cmd == Command::Inv || cmd == Command::ForceInv) {
         Addr addr = line->getAddr();
         MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
         if (event) {
@@ -2189,6 +2220,8 @@ uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, Shar
         } else {
             inv->setRqstr(cachename_);
         }
+        if (imprecise)
+            inv->setFlag(MemEvent::F_IMPRECISE);
         inv->setDst(shr);
         inv->setSize(lineSize_);
         if (responses.find(addr) != responses.end()) {
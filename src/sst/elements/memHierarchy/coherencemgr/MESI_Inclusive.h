@@ -234,6 +234,12 @@ public:
         {"prefetch_inv",            "Prefetched block was invalidated before being accessed", "count", 2},
         {"prefetch_coherence_miss", "Prefetched block incurred a coherence miss (upgrade) on its first access", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        /* Sharer encoding */
+        {"sharer_invalidations",    "Invalidations sent to sharers", "count", 2},
+        {"sharer_extra_invalidations", "Invalidations the configured sharer_encoding also sent to caches that do not hold the block", "count", 2},
+        {"sharer_imprecise_invalidations", "Times an invalidation of sharers reached caches that do not hold the block because of the sharer_encoding", "count", 2},
+        {"sharer_storage_bits",     "Bits of sharer state for the whole array under the configured sharer_encoding, recorded at the end of simulation", "bits", 2},
+        {"TagStore_packed_lookups", "tag_store=packed only: number of tag lookups done through the packed tag store", "count", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -260,6 +266,11 @@ public:
         HashFunction * ht = createHashFunction(params);
         cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        if (params.find<std::string>("tag_store", "object") == "packed")
+            cacheArray_->setPackedTags(true, registerStatistic<uint64_t>("TagStore_packed_lookups"));
+
+        sharerEncoding_ = createSharerEncoding(params);
+        sharerLines_ = lines;
 
         /* Statistics */
         stat_evict[I] =         registerStatistic<uint64_t>("evict_I");
@@ -416,6 +427,10 @@ public:
         stat_miss[2][1] = registerStatistic<uint64_t>("GetSXMiss_Blocked");
         stat_hits = registerStatistic<uint64_t>("CacheHits");
         stat_misses = registerStatistic<uint64_t>("CacheMisses");
+        stat_sharerInv = registerStatistic<uint64_t>("sharer_invalidations");
+        stat_sharerExtraInv = registerStatistic<uint64_t>("sharer_extra_invalidations");
+        stat_sharerImpreciseInv = registerStatistic<uint64_t>("sharer_imprecise_invalidations");
+        stat_sharerStorageBits = registerStatistic<uint64_t>("sharer_storage_bits");
 
         /* Prefetch statistics */
         if (prefetch) {
@@ -495,6 +510,10 @@ public:
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
     virtual bool handleNULLCMD(MemEvent * event, bool inMSHR);
 
+    /** Initialization/finish **/
+    virtual void hasUpperLevelCacheName(std::string cachename) { sharerEncoding_->getIndex(cachename); }
+    virtual void finish() { stat_sharerStorageBits->addData(sharerLines_ * sharerEncoding_->getBitsPerLine()); }
+
     /** Cache interface **/
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
@@ -582,6 +601,9 @@ private:
     void printData(vector<uint8_t> * data, bool set);
     void printLine(Addr addr);
 
+    /* Record the invalidations the sharer encoding would send when the sharers of line (except rqstr) are invalidated */
+    void recordSharerInvalidation(SharedCacheLine * line, std::string rqstr, std::set<std::string>& targets);
+
 /* Variables */
     CacheArray<SharedCacheLine> * cacheArray_;
     State protocolState_;       // State to transition to on exclusive response to read/shared request
@@ -599,6 +621,13 @@ private:
     Statistic<uint64_t>* stat_miss[3][2];
     Statistic<uint64_t>* stat_hits;
     Statistic<uint64_t>* stat_misses;
+    Statistic<uint64_t>* stat_sharerInv;
+    Statistic<uint64_t>* stat_sharerExtraInv;
+    Statistic<uint64_t>* stat_sharerImpreciseInv;
+    Statistic<uint64_t>* stat_sharerStorageBits;
+
+    SharerEncoding * sharerEncoding_;
+    uint64_t sharerLines_;
 };
 
 
@@ -540,11 +540,13 @@ bool MESIL1::handleInv(MemEvent* event, bool inMSHR) {
         case S_B: // Inv raced with our FlushLine; ordering Inv before FlushLine
             line->atomicEnd();
             sendResponseDown(event, line, false);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(I);
             break;
         case SM: // Inv raced with our upgrade; ordering Inv before upgrade
             line->atomicEnd();
             sendResponseDown(event, line, false);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(IM);
             break;
         case I_B:
@@ -602,6 +604,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
             }
             line->atomicEnd();
             sendResponseDown(event, line, false);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(I);
             break;
         case I_B:
@@ -615,6 +618,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
         case SM:
             line->atomicEnd();
             sendResponseDown(event, line, false);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(IM);
             break;
         default:
@@ -675,6 +679,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
         case S_B:
             line->atomicEnd();
             sendResponseDown(event, line, true);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(I);
             break;
         case I_B:
@@ -685,6 +690,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
         case SM:
             line->atomicEnd();
             sendResponseDown(event, line, true);
+            notifyListenerOfEvict(addr, lineSize_, event->getInstructionPointer());
             line->setState(IM);
             break;
         default:
@@ -170,6 +170,7 @@ public:
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
         /* Miscellaneous */
         {"EventStalledForLockedCacheline",  "Number of times an event (FetchInv, FetchInvX, eviction, Fetch, etc.) was stalled because a cache line was locked", "instances", 1},
+        {"TagStore_packed_lookups", "tag_store=packed only: number of tag lookups done through the packed tag store", "count", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registrations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -200,6 +201,8 @@ public:
 
         cacheArray_ = new CacheArray<L1CacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        if (params.find<std::string>("tag_store", "object") == "packed")
+            cacheArray_->setPackedTags(true, registerStatistic<uint64_t>("TagStore_packed_lookups"));
 
         // Register statistics
         stat_eventState[(int)Command::GetS][I] =      registerStatistic<uint64_t>("stateEvent_GetS_I");
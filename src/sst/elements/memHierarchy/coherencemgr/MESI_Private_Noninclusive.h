@@ -202,6 +202,7 @@ public:
         {"latency_GetSX_upgrade",   "Latency for read-exclusive misses, block present but in Shared state (includes invs in S)", "cycles", 1},
         {"latency_FlushLine",       "Latency for flush requests", "cycles", 1},
         {"latency_FlushLineInv",    "Latency for flush+invalidate requests", "cycles", 1},
+        {"TagStore_packed_lookups", "tag_store=packed only: number of tag lookups done through the packed tag store", "count", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -229,6 +230,8 @@ public:
         HashFunction * ht = createHashFunction(params);
         cacheArray_ = new CacheArray<PrivateCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        if (params.find<std::string>("tag_store", "object") == "packed")
+            cacheArray_->setPackedTags(true, registerStatistic<uint64_t>("TagStore_packed_lookups"));
 
         stat_evict[I] =      registerStatistic<uint64_t>("evict_I");
         stat_evict[S] =      registerStatistic<uint64_t>("evict_S");
@@ -2153,7 +2153,7 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
     if (tag->isSharer(event->getSrc()))
         tag->removeSharer(event->getSrc());
-    else
+    else if (!event->queryFlag(MemEvent::F_IMPRECISE)) // Imprecise acks come from caches that never had the block
         tag->removeOwner();
 
     responses.find(addr)->second.erase(event->getSrc());
@@ -2953,14 +2953,17 @@ bool MESISharNoninclusive::invalidateExceptRequestor(MemEvent * event, Directory
     uint64_t deliveryTime = 0;
     std::string rqstr = event->getSrc();
 
+    std::set<std::string> targets;
+    recordSharerInvalidation(tag, rqstr, targets);
+
     bool getData = needData;
     if (getData && tag->isSharer(event->getSrc()))
         getData = false;
 
-    for (set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+    for (set<std::string>::iterator it = targets.begin(); it != targets.end(); it++) {
         if (*it == rqstr) continue;
 
-        if (getData) { // FetchInv
+        if (getData && tag->isSharer(*it)) { // FetchInv
             getData = false;
             deliveryTime =  invalidateSharer(*it, event, tag, inMSHR, Command::FetchInv);
         } else { // Inv
@@ -2981,7 +2984,9 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
     } else {
         if (cmd == Command::NULLCMD)
             cmd = Command::Inv;
-        for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+        std::set<std::string> targets;
+        recordSharerInvalidation(tag, "", targets);
+        for (std::set<std::string>::iterator it = targets.begin(); it != targets.end(); it++) {
             deliveryTime = invalidateSharer(*it, event, tag, inMSHR, cmd);
         }
         if (deliveryTime != 0) {
@@ -2994,8 +2999,10 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
 
 void MESISharNoninclusive::invalidateSharers(MemEvent * event, DirectoryLine * tag, bool inMSHR, bool needData, Command cmd) {
     uint64_t deliveryTime = 0;
-    for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
-        if (needData) {
+    std::set<std::string> targets;
+    recordSharerInvalidation(tag, "", targets);
+    for (std::set<std::string>::iterator it = targets.begin(); it != targets.end(); it++) {
+        if (needData && tag->isSharer(*it)) {
             deliveryTime = invalidateSharer(*it, event, tag, inMSHR, Command::FetchInv);
             needData = false;
         } else {
@@ -3006,8 +3013,34 @@ void MESISharNoninclusive::invalidateSharers(MemEvent * event, DirectoryLine * t
 
 }
 
+/* Find the caches the sharer encoding sends an invalidation of the sharers to */
+void MESISharNoninclusive::recordSharerInvalidation(DirectoryLine * line, std::string rqstr, std::set<std::string>& targets) {
+    sharerEncoding_->getTargets(*(line->getSharers()), targets);
+    size_t sharers = line->numSharers();
+    size_t sent = targets.size();
+
+    // The requestor is known, so no encoding needs to invalidate it
+    if (!rqstr.empty()) {
+        if (line->isSharer(rqstr))
+            sharers--;
+        if (targets.find(rqstr) != targets.end())
+            sent--;
+    }
+
+    if (sharers == 0)
+        return;
+
+    stat_sharerInv->addData(sharers);
+    if (sent > sharers) {
+        stat_sharerExtraInv->addData(sent - sharers);
+        stat_sharerImpreciseInv->addData(1);
+    }
+}
+
+
 uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * event, DirectoryLine * tag, bool inMSHR, Command cmd) {
-    if (tag->isSharer(shr)) {
+    bool imprecise = !tag->isSharer(shr); // Target of the sharer encoding only
+    if (!imprecise || cmd == Command::Inv || cmd == Command::ForceInv) {
         Addr addr = tag->getAddr();
         MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
         if (event) {
@@ -3016,6 +3049,8 @@ uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * even
         } else {
             inv->setRqstr(cachename_);
         }
+        if (imprecise)
+            inv->setFlag(MemEvent::F_IMPRECISE);
         inv->setDst(shr);
         inv->setSize(lineSize_);
         if (responses.find(addr) != responses.end()) {
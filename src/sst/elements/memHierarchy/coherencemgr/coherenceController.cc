@@ -147,8 +147,14 @@ ReplacementPolicy* CoherenceController::createReplacementPolicy(uint64_t lines,
     }
     if (policy == "random") return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.random", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
     if (policy == "nmru")   return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.nmru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-
-    debug->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', and 'nmru'. You specified '%s'.\n", getName().c_str(), policy.c_str());
+    if (policy == "tree-plru" || policy == "plru")
+                            return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.tree-plru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "bit-plru")
+                            return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.bit-plru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "srrip")  return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.srrip", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "drrip")  return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.drrip", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+
+    debug->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', 'nmru', 'tree-plru', 'bit-plru', 'srrip', and 'drrip'. You specified '%s'.\n", getName().c_str(), policy.c_str());
     return nullptr;
 }
 
@@ -165,6 +171,27 @@ HashFunction* CoherenceController::createHashFunction(Params& params) {
     return ht;
 }
 
+SharerEncoding* CoherenceController::createSharerEncoding(Params& params) {
+    std::string encoding = params.find<std::string>("sharer_encoding", "full");
+    unsigned int pointers = params.find<unsigned int>("sharer_pointers", 4);
+    unsigned int groupSize = params.find<unsigned int>("sharer_group_size", 4);
+    unsigned int endpoints = params.find<unsigned int>("sharer_endpoints", 0);
+
+    if (pointers == 0)
+        debug->fatal(CALL_INFO, -1, "%s, Invalid param: sharer_pointers - must be at least 1.\n", getName().c_str());
+    if (groupSize == 0)
+        debug->fatal(CALL_INFO, -1, "%s, Invalid param: sharer_group_size - must be at least 1.\n", getName().c_str());
+    if (encoding != "full" && endpoints == 0)
+        debug->fatal(CALL_INFO, -1, "%s, Invalid param: sharer_endpoints - must be set to the number of upper level caches for sharer_encoding '%s'.\n", getName().c_str(), encoding.c_str());
+
+    if (encoding == "full")     return new SharerEncoding(SharerEncoding::Type::Full, pointers, groupSize, endpoints, getName(), debug);
+    if (encoding == "limited")  return new SharerEncoding(SharerEncoding::Type::Limited, pointers, groupSize, endpoints, getName(), debug);
+    if (encoding == "coarse")   return new SharerEncoding(SharerEncoding::Type::Coarse, pointers, groupSize, endpoints, getName(), debug);
+
+    debug->fatal(CALL_INFO, -1, "%s, Invalid param: sharer_encoding - supported encodings are 'full', 'limited', and 'coarse'. You specified '%s'.\n", getName().c_str(), encoding.c_str());
+    return nullptr;
+}
+
 /*******************************************************************************
  * Event handlers - one per event type
  * Handlers return whether event was accepted (true) or rejected (false)
@@ -277,6 +304,24 @@ bool CoherenceController::handleInv(MemEvent* event, bool inMSHR) {
     return false;
 }
 
+/* Inv or ForceInv sent only because the sender's sharer encoding could not rule this cache out.
+ * The sender knows exactly which caches share the block and this is not one of them. */
+bool CoherenceController::handleImpreciseInv(MemEvent* event, bool inMSHR) {
+    if (is_debug_event(event)) {
+        eventDI.prefill(event->getID(), event->getCmd(), false, event->getBaseAddr(), I);
+        eventDI.action = "Respond";
+        eventDI.reason = "not a sharer";
+    }
+
+    MemEvent * ack = event->makeResponse();
+    ack->setSize(lineSize_);
+    Response resp = {ack, timestamp_ + tagLatency_, packetHeaderBytes};
+    addToOutgoingQueue(resp);
+
+    delete event;
+    return true;
+}
+
 bool CoherenceController::handleFetchResp(MemEvent* event, bool inMSHR) {
     debug->fatal(CALL_INFO, -1, "%s, Error: FetchResp events are not handled by this coherence manager. Event: %s. Time: %" PRIu64 "ns.\n",
             getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
@@ -32,6 +32,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/sharerEncoding.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -78,6 +79,9 @@ public:
     virtual bool handleFetchXResp(MemEvent * event, bool inMSHR);
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
 
+    /* Inv/ForceInv flagged F_IMPRECISE by the sender's sharer encoding; same for every protocol */
+    bool handleImpreciseInv(MemEvent * event, bool inMSHR);
+
 
     /*********************************************************************************
      * Send outgoing events
@@ -238,6 +242,7 @@ protected:
     /* Initialization */
     ReplacementPolicy * createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum = 0);
     HashFunction * createHashFunction(Params& params);
+    SharerEncoding * createSharerEncoding(Params& params);
 
     /*********************************************************************************
      * Data members
@@ -256,6 +256,9 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     stat_getRequestLatency          = registerStatistic<uint64_t>("get_request_latency");
     stat_cacheHits                  = registerStatistic<uint64_t>("directory_cache_hits");
     stat_mshrHits                   = registerStatistic<uint64_t>("mshr_hits");
+    stat_sharerPtrEvictions         = registerStatistic<uint64_t>("sharer_pointer_evictions");
+    stat_entryEvictions             = registerStatistic<uint64_t>("directory_entry_evictions");
+    stat_entryEvictionInvs          = registerStatistic<uint64_t>("directory_entry_eviction_invs");
     stat_eventRecv[(int)Command::GetX] = registerStatistic<uint64_t>("GetX_recv");
     stat_eventRecv[(int)Command::GetS] = registerStatistic<uint64_t>("GetS_recv");
     stat_eventRecv[(int)Command::GetSX] = registerStatistic<uint64_t>("GetSX_recv");
@@ -310,11 +313,33 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     if (!memLink)
         memLink = cpuLink;
 
-    // TODO implement the cache properly using the cacheArray
     entryCacheMaxSize = params.find<uint64_t>("entry_cache_size", 32768);
-    entryCacheSize = 0;
+    uint64_t entryCacheAssoc = params.find<uint64_t>("entry_cache_assoc", 0);
+    if (entryCacheAssoc != 0 && entryCacheMaxSize % entryCacheAssoc != 0)
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): entry_cache_size - must be a multiple of entry_cache_assoc. You specified: %" PRIu64 " entries, associativity %" PRIu64 "\n",
+                getName().c_str(), entryCacheMaxSize, entryCacheAssoc);
+    entryCache.configure(entryCacheMaxSize, entryCacheAssoc, lineSize);
     entrySize = 4; // Bytes, TODO parameterize
 
+    uint64_t dirEntries = params.find<uint64_t>("directory_entries", 0);
+    uint64_t dirAssoc = params.find<uint64_t>("directory_assoc", 8);
+    if (dirAssoc != 0 && dirEntries % dirAssoc != 0)
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): directory_entries - must be a multiple of directory_assoc. You specified: %" PRIu64 " entries, associativity %" PRIu64 "\n",
+                getName().c_str(), dirEntries, dirAssoc);
+    dirArray.configure(dirEntries, dirAssoc, lineSize);
+
+    std::string sharerTracking = params.find<std::string>("sharer_tracking", "bitvector");
+    uint32_t maxSharerPointers = params.find<uint32_t>("max_sharer_pointers", 4);
+    if (sharerTracking == "bitvector") {
+        entryPool.setFormat(DirEntryPool::Format::Bitvector, 0, &out);
+    } else if (sharerTracking == "pointer") {
+        if (maxSharerPointers < 2)
+            dbg.fatal(CALL_INFO, -1, "Invalid param(%s): max_sharer_pointers - must be at least 2. You specified: %" PRIu32 "\n", getName().c_str(), maxSharerPointers);
+        entryPool.setFormat(DirEntryPool::Format::Pointer, maxSharerPointers, &out);
+    } else {
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): sharer_tracking - must be 'bitvector' or 'pointer'. You specified: %s\n", getName().c_str(), sharerTracking.c_str());
+    }
+
     string protstr  = params.find<std::string>("coherence_protocol", "MESI");
     if (protstr == "mesi" || protstr == "MESI") protocol = CoherenceProtocol::MESI;
     else if (protstr == "msi" || protstr == "MSI") protocol = CoherenceProtocol::MSI;
@@ -322,7 +347,10 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
     int mshrSize    = params.find<int>("mshr_num_entries",-1);
     if (mshrSize == 0) dbg.fatal(CALL_INFO, -1, "Invalid param(%s): mshr_num_entries - must be at least 1 or else negative to indicate an unlimited size MSHR\n", getName().c_str());
-    mshr                = new MSHR(&dbg, mshrSize, getName(), DEBUG_ADDR);
+    std::string mshrType = params.find<std::string>("mshr_type", "map");
+    if (mshrType != "map" && mshrType != "flat")
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): mshr_type - must be 'map' or 'flat'. You specified: %s\n", getName().c_str(), mshrType.c_str());
+    mshr                = new MSHR(&dbg, mshrSize, getName(), DEBUG_ADDR, mshrType == "flat");
 
     /* Get latencies */
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
@@ -333,7 +361,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
 DirectoryController::~DirectoryController(){
     for(std::unordered_map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
-        delete i->second;
+        entryPool.releaseEntry(i->second);
     }
     directory.clear();
 }
@@ -525,6 +553,9 @@ bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
         case Command::NACK:
             retval = handleNACK(ev, replay);
             break;
+        case Command::Inv: // Only issued by this directory, to evict an entry
+            retval = handleEntryEviction(ev, replay);
+            break;
         default:
             dbg.fatal(CALL_INFO, -1 , "%s, Error: Received unrecognized request: %s. Time = %" PRIu64 "ns\n",
                     getName().c_str(), ev->getVerboseString().c_str(), getCurrentSimTimeNano());
@@ -578,7 +609,7 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
 
 void DirectoryController::printStatus(Output &statusOut) {
     statusOut.output("MemHierarchy::DirectoryController %s\n", getName().c_str());
-    statusOut.output("  Cached entries: %" PRIu64 "\n", entryCacheSize);
+    statusOut.output("  Cached entries: %" PRIu64 "\n", entryCache.size());
     statusOut.output("  Requests waiting to be handled:  %zu\n", eventBuffer.size());
 //    for(std::list<std::pair<MemEvent*,bool> >::iterator i = workQueue.begin() ; i != workQueue.end() ; ++i){
 //        statusOut.output("    %s, %s\n", i->first->getVerboseString().c_str(), i->second ? "replay" : "new");
@@ -733,6 +764,16 @@ void DirectoryController::finish(void){
 
 void DirectoryController::setup(void){
     cpuLink->setup();
+
+    // Index the endpoints above us in name order so sharer records can be sized
+    std::vector<std::string> endpoints;
+    std::set<MemLinkBase::EndpointInfo>* sources = cpuLink->getSources();
+    for (std::set<MemLinkBase::EndpointInfo>::iterator it = sources->begin(); it != sources->end(); it++)
+        endpoints.push_back(it->name);
+    std::sort(endpoints.begin(), endpoints.end());
+    for (std::vector<std::string>::iterator it = endpoints.begin(); it != endpoints.end(); it++)
+        entryPool.getEndpoints()->lookup(*it);
+    entryPool.setEndpointCount(entryPool.getEndpoints()->size());
     //MemLinkBase * mem = memLink ? memLink : network;
     // dircc->configure(getName(), memoryName, sendWBAck, recvWBAck, network, mem);
 }
@@ -761,6 +802,8 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
 
     switch (state) {
         case I:
+            if (!reserveDirSlot(event, inMSHR))
+                return !inMSHR;
             if (mshr->hasData(addr)) {
                 if (!inMSHR)
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
@@ -793,6 +836,18 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
             }
             break;
         case S:
+            if (entry->isSharerFull() && !entry->isSharer(event->getSrc())) {
+                // Limited pointers: invalidate the oldest sharer, then replay
+                status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
+                if (status == MemEventStatus::OK) {
+                    stat_sharerPtrEvictions->addData(1);
+                    issueInvalidation(entryPool.getEndpoints()->getName(entry->getOldestSharer()), event, entry, Command::Inv);
+                    entry->setState(S_Inv);
+                    if (is_debug_event(event))
+                        eventDI.reason = "sharer pointers full";
+                }
+                break;
+            }
             if (mshr->hasData(addr)) { // saved from earlier request
                 entry->addSharer(event->getSrc());
                 sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
@@ -863,6 +918,8 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
 
     switch (state) {
         case I:
+            if (!reserveDirSlot(event, inMSHR))
+                return !inMSHR;
             if (mshr->hasData(addr)) {
                 if (!inMSHR)
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
@@ -1939,6 +1996,39 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
     return true;
 }
 
+bool DirectoryController::handleEntryEviction(MemEvent* event, bool inMSHR) {
+    Addr addr = event->getBaseAddr();
+    DirEntry* entry = getDirEntry(addr);
+    State state = entry->getState();
+
+    if (is_debug_addr(addr))
+        eventDI.prefill(event->getID(), Command::Inv, false, addr, state);
+
+    if (state != I)
+        out.fatal(CALL_INFO, -1, "%s, Error: Evicting directory entry in unhandled state '%s'. Event: %s. Time: %" PRIu64 "ns\n",
+                getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
+
+    if (mshr->hasData(addr)) { // Fetched from the owner, any dirty data was written back when it arrived
+        if (mshr->getDataDirty(addr))
+            writebackDataFromMSHR(addr);
+        mshr->clearData(addr);
+    }
+
+    dirArray.release(addr);
+
+    if (is_debug_addr(addr)) {
+        eventDI.action = "Done";
+        eventDI.reason = "evict";
+        eventDI.newst = entry->getState();
+        eventDI.verboseline = entry->getString();
+    }
+
+    cleanUpAfterRequest(event, inMSHR);
+    updateCache(entry);
+
+    return true;
+}
+
 /****************************
  * Manage data structures
  ****************************/
@@ -1946,9 +2036,7 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
     std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(addr);
 
     if (directory.end() == i) {
-        directory[addr] = new DirEntry(addr);
-        i = directory.find(addr);
-        i->second->cacheIter = entryCache.end();
+        i = directory.insert(std::make_pair(addr, entryPool.allocateEntry(addr))).first;
         i->second->setCached(true);
 
     }
@@ -1993,6 +2081,86 @@ bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, boo
     return true;
 }
 
+/*
+ * Sparse directory: a request for a line in I must get the line a slot before it can proceed.
+ * If the set is full, the LRU entry that is stable and not busy is evicted by invalidating
+ * its sharers or owner. The request waits in the MSHR and retries each cycle until a slot frees.
+ * Returns true if the request can proceed.
+ */
+bool DirectoryController::reserveDirSlot(MemEvent* event, bool inMSHR) {
+    Addr addr = event->getBaseAddr();
+    if (!dirArray.isBounded() || dirArray.touch(addr))
+        return true;
+
+    Addr victim = 0;
+    bool haveVictim = false;
+    bool evicting = false;
+    const std::vector<Addr> &slots = dirArray.getSetSlots(addr);
+    for (std::vector<Addr>::const_iterator it = slots.begin(); it != slots.end(); it++) {
+        std::unordered_map<Addr,DirEntry*>::iterator entryIt = directory.find(*it);
+        if (!mshr->exists(*it)) {
+            if (entryIt == directory.end() || entryIt->second->getState() == I) { // Entry already returned to I
+                dirArray.release(*it);
+                break;
+            }
+            State state = entryIt->second->getState();
+            if (!haveVictim && entryIt->second->isCached() && (state == S || state == M)) {
+                victim = *it;
+                haveVictim = true;
+            }
+        } else if (mshr->getFrontType(*it) == MSHREntryType::Event && static_cast<MemEvent*>(mshr->getFrontEvent(*it))->getCmd() == Command::Inv) {
+            evicting = true;
+        }
+    }
+
+    if (dirArray.allocate(addr)) {
+        if (inMSHR)
+            mshr->setInProgress(addr, false);
+        return true;
+    }
+
+    if (!inMSHR) {
+        MemEventStatus status = allocateMSHR(event, false);
+        if (status == MemEventStatus::Reject) {
+            sendNACK(event);
+            return false;
+        } else if (status == MemEventStatus::Stall) {
+            return false;
+        }
+        retryBuffer.push_back(event);
+    }
+    mshr->setInProgress(addr); // Keep other events from retrying this one too
+
+    if (is_debug_event(event)) {
+        eventDI.action = "Stall";
+        eventDI.reason = "directory set full";
+    }
+
+    if (haveVictim && !evicting) // One eviction at a time per set
+        evictDirEntry(victim);
+    return false;
+}
+
+void DirectoryController::evictDirEntry(Addr addr) {
+    DirEntry* entry = getDirEntry(addr);
+    MemEvent* ev = new MemEvent(getName(), addr, addr, Command::Inv, lineSize);
+    if (mshr->insertEvent(addr, ev, -1, true, false) == -1) {
+        delete ev;
+        return;
+    }
+
+    stat_entryEvictions->addData(1);
+    if (entry->getState() == S) {
+        stat_entryEvictionInvs->addData(entry->getSharerCount());
+        issueInvalidations(ev, entry, Command::Inv);
+        entry->setState(S_Inv);
+    } else {
+        stat_entryEvictionInvs->addData(1);
+        issueFetch(ev, entry, Command::FetchInv);
+        entry->setState(M_Inv);
+    }
+}
+
 MemEventStatus DirectoryController::allocateMSHR(MemEvent* event, bool fwdReq, int pos) {
     int end_pos = mshr->insertEvent(event->getBaseAddr(), event, pos, fwdReq, false);
     if (end_pos == -1) {
@@ -2050,33 +2218,28 @@ void DirectoryController::cleanUpAfterResponse(MemEvent * event, bool inMSHR) {
     }
 }
 
-void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a proper cache!
+void DirectoryController::updateCache(DirEntry * entry) {
+    if (entry->getState() == I)
+        dirArray.release(entry->getBaseAddr());
+
     if (0 == entryCacheMaxSize) {
         sendEntryToMemory(entry);
     } else {
-        if (entry->cacheIter != entryCache.end()) {
-            entryCache.erase(entry->cacheIter);
-            --entryCacheSize;
-            entry->cacheIter = entryCache.end();
-        }
+        entryCache.remove(entry);
 
         if (entry->getState() == I) {
             directory.erase(entry->getBaseAddr());
-            delete entry;
+            entryPool.releaseEntry(entry);
             return;
         } else  {
-            entryCache.push_front(entry);
-            entry->cacheIter = entryCache.begin();
-            ++entryCacheSize;
+            uint64_t set = entryCache.touch(entry);
 
-            while (entryCacheSize > entryCacheMaxSize) {
-                DirEntry * oldEntry = entryCache.back();
+            while (entryCache.isOverfull(set)) {
+                DirEntry * oldEntry = entryCache.getLRU(set);
                 if (mshr->exists(oldEntry->getBaseAddr()))
                     break;
 
-                entryCache.pop_back();
-                --entryCacheSize;
-                oldEntry->cacheIter = entryCache.end();
+                entryCache.remove(oldEntry);
                 oldEntry->setCached(false);
                 sendEntryToMemory(oldEntry);
             }
@@ -2160,11 +2323,14 @@ void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command c
 }
 
 void DirectoryController::issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd) {
-    std::string rqstr = (event->getSrc());
+    int rqstr = entryPool.getEndpoints()->find(event->getSrc());
 
-    for (set<std::string>::iterator it = entry->getSharers()->begin(); it != entry->getSharers()->end(); it++) {
+    std::vector<int> sharers;
+    entry->getSharers(sharers);
+    entryPool.getEndpoints()->sortByName(sharers);
+    for (std::vector<int>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         if (*it == rqstr) continue;
-        issueInvalidation(*it, event, entry, cmd);
+        issueInvalidation(entryPool.getEndpoints()->getName(*it), event, entry, cmd);
     }
 }
 
@@ -37,6 +37,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/directoryEntry.h"
 
 using namespace std;
 
@@ -51,6 +52,11 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
             {"clock",                   "Clock rate of controller.", "1GHz"},
             {"entry_cache_size",        "Size (in # of entries) the controller will cache.", "0"},
+            {"entry_cache_assoc",       "Associativity of the entry cache. 0 makes it fully associative.", "0"},
+            {"sharer_tracking",         "How each entry records sharers. Options: bitvector[one bit per endpoint], pointer[limited pointers, adding a sharer to a full entry invalidates the oldest sharer first]. This bounds the size of an entry, directory_entries bounds their number", "bitvector"},
+            {"max_sharer_pointers",     "Number of sharer pointers per entry if sharer_tracking is 'pointer'. Must be at least 2.", "4"},
+            {"directory_entries",       "Number of entries in the directory (sparse directory). A line must hold an entry before a cache can get it; if its set is full, the least recently used entry that is not busy is evicted by invalidating its sharers or owner. 0 tracks every line.", "0"},
+            {"directory_assoc",         "Associativity of the directory if directory_entries is not 0. 0 makes it fully associative.", "8"},
             {"debug",                   "Where to send debug output. 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
             {"debug_level",             "Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
             {"debug_addr",              "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""},
@@ -58,6 +64,7 @@ public:
             {"cache_line_size",         "Size of a cache line [aka cache block] in bytes.", "64"},
             {"coherence_protocol",      "Coherence protocol.  Supported --MESI, MSI--", "MESI"},
             {"mshr_num_entries",        "Number of MSHRs. Set to -1 for almost unlimited number.", "-1"},
+            {"mshr_type",               "MSHR storage. Options: map[ordered map of registers], flat[open-addressed table with registers pooled in slabs sized from mshr_num_entries]", "map"},
             {"net_memory_name",         "For directories connected to a memory over the network: name of the memory this directory owns", ""},
             {"access_latency_cycles",   "Latency of directory access in cycles", "0"},
             {"mshr_latency_cycles",     "Latency of mshr access in cycles", "0"},
@@ -87,6 +94,9 @@ public:
             {"get_request_latency",         "Total latency in ns of all get* requests handled",                 "nanoseconds",  1},
             {"directory_cache_hits",        "Number of requests that hit in the directory cache",               "requests",     1},
             {"mshr_hits",                   "Number of requests that hit in the MSHRs",                         "requests",     1},
+            {"sharer_pointer_evictions",    "Number of sharers invalidated to free a pointer in a full limited-pointer entry", "count", 1},
+            {"directory_entry_evictions",   "Number of entries evicted to make room in a full directory set", "count", 1},
+            {"directory_entry_eviction_invs", "Number of invalidations (Inv or FetchInv) sent to caches to evict directory entries", "count", 1},
             /* Event received */
             {"GetS_recv",           "Event received: GetS (read-shared)", "count", 1},
             {"GetX_recv",           "Event received: GetX (write-exclusive)", "count", 1},
@@ -170,6 +180,9 @@ private:
     Statistic<uint64_t> * stat_getRequestLatency;           // totalGetReqProcessTime;
     Statistic<uint64_t> * stat_cacheHits;                   // numCacheHits;
     Statistic<uint64_t> * stat_mshrHits;                    // mshrHits;
+    Statistic<uint64_t> * stat_sharerPtrEvictions;
+    Statistic<uint64_t> * stat_entryEvictions;
+    Statistic<uint64_t> * stat_entryEvictionInvs;
     // Received events
     Statistic<uint64_t> * stat_eventRecv[(int)Command::LAST_CMD];
     Statistic<uint64_t> * stat_noncacheRecv[(int)Command::LAST_CMD];
@@ -250,6 +263,7 @@ public:
     bool handleFetchResp(MemEvent* event, bool inMSHR);
     bool handleFetchXResp(MemEvent* event, bool inMSHR);
     bool handleNACK(MemEvent* event, bool inMSHR);
+    bool handleEntryEviction(MemEvent* event, bool inMSHR);
 
     void sendOutgoingEvents();
 
@@ -286,82 +300,15 @@ private:
         }
     } eventDI, evictDI;
 
-    struct DirEntry {
-	bool                cached;         // whether block is cached or not
-        Addr                addr;           // block address
-        State               state;          // state
-        std::list<DirEntry*>::iterator cacheIter;
-	std::set<std::string> sharers;      // set of sharers for block
-        std::string         owner;          // Owner of block
-
-        DirEntry(Addr a) {
-            clearEntry();
-            addr = a;
-            state = I;
-            cached = false;
-        }
-
-        void clearEntry(){
-            cached = true;
-            addr = 0;
-            sharers.clear();
-            owner = "";
-        }
-
-        std::string getString() {
-            std::ostringstream str;
-            str << "State: " << StateString[state];
-            str << " Sharers: [";
-            bool comma = false;
-            for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
-                if (comma)
-                    str << ",";
-                str << *it;
-                comma = true;
-            }
-            str << "] Owner: " << owner;
-            str << " Cached: " << (cached ? "y" : "n");
-            return str.str();
-        }
-
-        bool isCached() { return cached; }
-
-        void setCached(bool cache) { cached = cache; }
-
-        Addr getBaseAddr() { return addr; }
-
-        size_t getSharerCount() { return sharers.size(); }
-
-        void clearSharers() { sharers.clear(); }
-
-        void addSharer(std::string shr) { sharers.insert(shr); }
-
-        bool isSharer(std::string shr) { return sharers.find(shr) != sharers.end(); }
-
-        bool hasSharers() { return !(sharers.empty()); }
-
-        std::set<std::string>* getSharers() { return &sharers; }
-
-        void removeSharer(std::string shr) { sharers.erase(shr); }
-
-        std::string getOwner() { return owner; }
-
-        bool hasOwner() { return owner != ""; }
-
-        void removeOwner() { owner = ""; }
-
-        void setOwner(std::string own) { owner = own; }
-
-        void setState(State nState) { state = nState; }
-
-        State getState() { return state; }
-    };
+    typedef MemHierarchy::DirEntry DirEntry;
 
     int dlevel;
     void printDebugInfo();
 
     DirEntry* getDirEntry(Addr addr); // find entry in the master list
     bool retrieveDirEntry(DirEntry* entry, MemEvent* event, bool inMSHR); // Simulate fetching entry from memory
+    bool reserveDirSlot(MemEvent* event, bool inMSHR); // Sparse directory: get the line an entry, evicting one if needed
+    void evictDirEntry(Addr addr);
 
     MemEventStatus allocateMSHR(MemEvent* event, bool fwdReq, int pos = -1);
 
@@ -387,6 +334,7 @@ private:
 
     MSHR * mshr;
     std::unordered_map<Addr, DirEntry*> directory; // Master list of all directory entries, including noncached ones
+    DirEntryPool entryPool;     // Storage for directory entries and the endpoint index used for sharers
 
 
     struct MemMsg {
@@ -403,9 +351,9 @@ private:
     std::multimap<uint64_t,MemMsg>   memMsgQueue;
 
     uint64_t    entryCacheMaxSize;
-    uint64_t    entryCacheSize;
     uint32_t    entrySize;
-    std::list<DirEntry*> entryCache;
+    DirEntryCache entryCache;
+    DirEntryArray dirArray;     // Which lines hold an entry if the directory is sparse
 
     uint64_t lineSize;
 
@@ -0,0 +1,515 @@
+// Copyright 2013-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_DIRECTORYENTRY_H_
+#define _MEMHIERARCHY_DIRECTORYENTRY_H_
+
+#include <algorithm>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <sst/core/output.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/util.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Maps endpoint names to small indices so that directory entries can record
+ * sharers and owners as bits or short pointers rather than strings.
+ * The directory seeds the table from its link's endpoint list at setup();
+ * endpoints that only show up later (e.g., behind a bus) are appended.
+ */
+class EndpointIndex {
+public:
+    static const int None = -1;
+
+    EndpointIndex() : nameOrdered(true) { }
+
+    /* Return the index for name, adding it if needed */
+    int lookup(const std::string &name) {
+        std::unordered_map<std::string,int>::const_iterator it = indices.find(name);
+        if (it != indices.end())
+            return it->second;
+        if (!names.empty() && name < names.back())
+            nameOrdered = false;
+        int idx = names.size();
+        names.push_back(name);
+        indices.insert(std::make_pair(name, idx));
+        return idx;
+    }
+
+    /* Return the index for name or None if it has not been seen */
+    int find(const std::string &name) const {
+        std::unordered_map<std::string,int>::const_iterator it = indices.find(name);
+        return it == indices.end() ? None : it->second;
+    }
+
+    const std::string& getName(int idx) const {
+        static const std::string none("");
+        return idx == None ? none : names[idx];
+    }
+
+    size_t size() const { return names.size(); }
+
+    /* Sort indices so that endpoints are visited in name order */
+    void sortByName(std::vector<int> &idx) const {
+        if (nameOrdered)
+            std::sort(idx.begin(), idx.end());
+        else
+            std::sort(idx.begin(), idx.end(), [this](int a, int b) { return names[a] < names[b]; });
+    }
+
+private:
+    std::unordered_map<std::string,int> indices;
+    std::vector<std::string> names;
+    bool nameOrdered;   // Indices were assigned in name order
+};
+
+class DirEntry;
+
+/*
+ * Slab allocator for directory entries and their sharer records.
+ *
+ * The sharer record format is chosen per directory:
+ *  Bitvector: one bit per endpoint index. The record width is set from the
+ *      endpoint count at setup(); an entry widens its own record if a later
+ *      endpoint does not fit.
+ *  Pointer: up to maxPointers 16-bit endpoint indices (limited-pointer
+ *      directory). The directory must make room, by invalidating a sharer,
+ *      before adding a sharer to a full entry; adding to a full entry is a
+ *      fatal error.
+ *
+ * Entries and records are carved from slabs and recycled through free lists
+ * (one per record width), so entry churn does not go to the heap.
+ */
+class DirEntryPool {
+public:
+    enum class Format { Bitvector, Pointer };
+
+    static const uint32_t slabEntries = 1024;
+
+    DirEntryPool() : format(Format::Bitvector), maxPointers(0), bitvectorWords(1), out(nullptr) { }
+
+    ~DirEntryPool() {
+        for (std::vector<uint64_t*>::iterator it = recordSlabs.begin(); it != recordSlabs.end(); it++)
+            delete [] *it;
+        for (std::vector<char*>::iterator it = entrySlabs.begin(); it != entrySlabs.end(); it++)
+            delete [] *it;
+    }
+
+    void setFormat(Format f, uint32_t pointers, Output* output) {
+        format = f;
+        maxPointers = pointers;
+        out = output;
+    }
+
+    void setEndpointCount(size_t count) {
+        bitvectorWords = count <= 64 ? 1 : (count + 63) / 64;
+    }
+
+    EndpointIndex* getEndpoints() { return &endpoints; }
+    Format getFormat() const { return format; }
+    uint32_t getMaxPointers() const { return maxPointers; }
+
+    /* Width in 64-bit words of a new sharer record */
+    uint16_t getRecordWords() const {
+        return format == Format::Pointer ? (maxPointers + 3) / 4 : bitvectorWords;
+    }
+
+    inline DirEntry* allocateEntry(Addr addr);
+    inline void releaseEntry(DirEntry* entry);
+    inline void sharerOverflow(DirEntry* entry, int shr);
+
+    uint64_t* allocateRecord(uint16_t words) {
+        if (words >= recordFree.size())
+            recordFree.resize(words + 1);
+        std::vector<uint64_t*> &freeList = recordFree[words];
+        if (freeList.empty()) {
+            uint64_t* slab = new uint64_t[words * slabEntries];
+            recordSlabs.push_back(slab);
+            for (uint32_t i = 0; i < slabEntries; i++)
+                freeList.push_back(slab + (slabEntries - 1 - i) * words);
+        }
+        uint64_t* record = freeList.back();
+        freeList.pop_back();
+        memset(record, 0, words * sizeof(uint64_t));
+        return record;
+    }
+
+    void releaseRecord(uint64_t* record, uint16_t words) {
+        recordFree[words].push_back(record);
+    }
+
+private:
+    Format format;
+    uint32_t maxPointers;
+    uint16_t bitvectorWords;
+    Output* out;
+
+    EndpointIndex endpoints;
+
+    std::vector<char*> entrySlabs;
+    std::vector<DirEntry*> entryFree;
+    std::vector<uint64_t*> recordSlabs;
+    std::vector<std::vector<uint64_t*> > recordFree;
+};
+
+/*
+ * A directory entry. Owner and sharers are endpoint indices from the pool's
+ * EndpointIndex; the string methods translate names for the coherence code.
+ */
+class DirEntry {
+    friend class DirEntryPool;
+    friend class DirEntryCache;
+
+public:
+    DirEntry(Addr a, DirEntryPool* p) : addr(a), state(I), owner(EndpointIndex::None), cached(false),
+            sharerCount(0), lruPrev(nullptr), lruNext(nullptr), lruSet(-1), pool(p) {
+        sharerWords = pool->getRecordWords();
+        sharers = pool->allocateRecord(sharerWords);
+    }
+
+    ~DirEntry() {
+        pool->releaseRecord(sharers, sharerWords);
+    }
+
+    std::string getString() {
+        std::ostringstream str;
+        str << "State: " << StateString[state];
+        str << " Sharers: [";
+        std::vector<int> idx;
+        getSharers(idx);
+        pool->getEndpoints()->sortByName(idx);
+        for (size_t i = 0; i < idx.size(); i++) {
+            if (i != 0)
+                str << ",";
+            str << pool->getEndpoints()->getName(idx[i]);
+        }
+        str << "] Owner: " << getOwner();
+        str << " Cached: " << (cached ? "y" : "n");
+        return str.str();
+    }
+
+    bool isCached() { return cached; }
+
+    void setCached(bool cache) { cached = cache; }
+
+    Addr getBaseAddr() { return addr; }
+
+    size_t getSharerCount() { return sharerCount; }
+
+    bool hasSharers() { return sharerCount != 0; }
+
+    void clearSharers() {
+        memset(sharers, 0, sharerWords * sizeof(uint64_t));
+        sharerCount = 0;
+    }
+
+    /* Sharers by endpoint index */
+    void addSharer(int shr) {
+        if (pool->getFormat() == DirEntryPool::Format::Pointer) {
+            if (isSharer(shr))
+                return;
+            if (sharerCount == pool->getMaxPointers())
+                pool->sharerOverflow(this, shr);
+            pointers()[sharerCount++] = shr;
+            return;
+        }
+        uint32_t word = shr / 64;
+        if (word >= sharerWords)
+            widen(word + 1);
+        uint64_t bit = (uint64_t)1 << (shr % 64);
+        if (!(sharers[word] & bit)) {
+            sharers[word] |= bit;
+            sharerCount++;
+        }
+    }
+
+    bool isSharer(int shr) {
+        if (shr == EndpointIndex::None)
+            return false;
+        if (pool->getFormat() == DirEntryPool::Format::Pointer) {
+            uint16_t * ptr = pointers();
+            for (uint32_t i = 0; i < sharerCount; i++) {
+                if (ptr[i] == shr)
+                    return true;
+            }
+            return false;
+        }
+        uint32_t word = shr / 64;
+        return word < sharerWords && (sharers[word] & ((uint64_t)1 << (shr % 64)));
+    }
+
+    void removeSharer(int shr) {
+        if (!isSharer(shr))
+            return;
+        if (pool->getFormat() == DirEntryPool::Format::Pointer) {
+            uint16_t * ptr = pointers();
+            uint32_t i = 0;
+            while (ptr[i] != shr) i++;
+            for (; i + 1 < sharerCount; i++)  // Keep pointers in the order sharers were added
+                ptr[i] = ptr[i+1];
+        } else {
+            sharers[shr / 64] &= ~((uint64_t)1 << (shr % 64));
+        }
+        sharerCount--;
+    }
+
+    /* Append sharer indices to idx, in no particular order */
+    void getSharers(std::vector<int> &idx) {
+        if (pool->getFormat() == DirEntryPool::Format::Pointer) {
+            uint16_t * ptr = pointers();
+            idx.insert(idx.end(), ptr, ptr + sharerCount);
+            return;
+        }
+        for (uint32_t w = 0; w < sharerWords; w++) {
+            for (uint64_t bits = sharers[w]; bits != 0; bits &= bits - 1)
+                idx.push_back(w * 64 + __builtin_ctzll(bits));
+        }
+    }
+
+    /* Limited-pointer format only: all pointers are in use */
+    bool isSharerFull() {
+        return pool->getFormat() == DirEntryPool::Format::Pointer && sharerCount == pool->getMaxPointers();
+    }
+
+    /* Limited-pointer format only: the sharer that has held a pointer longest */
+    int getOldestSharer() { return sharerCount == 0 ? EndpointIndex::None : pointers()[0]; }
+
+    /* Sharers by endpoint name */
+    void addSharer(const std::string &shr) { addSharer(pool->getEndpoints()->lookup(shr)); }
+
+    bool isSharer(const std::string &shr) { return isSharer(pool->getEndpoints()->find(shr)); }
+
+    void removeSharer(const std::string &shr) { removeSharer(pool->getEndpoints()->find(shr)); }
+
+    const std::string& getOwner() { return pool->getEndpoints()->getName(owner); }
+
+    bool hasOwner() { return owner != EndpointIndex::None; }
+
+    void removeOwner() { owner = EndpointIndex::None; }
+
+    void setOwner(const std::string &own) { owner = own == "" ? EndpointIndex::None : pool->getEndpoints()->lookup(own); }
+
+    void setState(State nState) { state = nState; }
+
+    State getState() { return state; }
+
+private:
+    uint16_t* pointers() { return reinterpret_cast<uint16_t*>(sharers); }
+
+    void widen(uint32_t words) {
+        uint64_t* record = pool->allocateRecord(words);
+        memcpy(record, sharers, sharerWords * sizeof(uint64_t));
+        pool->releaseRecord(sharers, sharerWords);
+        sharers = record;
+        sharerWords = words;
+    }
+
+    Addr        addr;           // block address
+    State       state;          // state
+    int32_t     owner;          // Owner of block
+    bool        cached;         // whether block is cached or not
+    uint16_t    sharerWords;    // width of the sharer record
+    uint32_t    sharerCount;    // number of sharers
+    uint64_t*   sharers;        // sharer record, format set by the pool
+
+    /* Entry cache bookkeeping */
+    DirEntry*   lruPrev;
+    DirEntry*   lruNext;
+    int64_t     lruSet;         // -1 if not in the entry cache
+
+    DirEntryPool* pool;
+};
+
+DirEntry* DirEntryPool::allocateEntry(Addr addr) {
+    if (entryFree.empty()) {
+        char* slab = new char[sizeof(DirEntry) * slabEntries];
+        entrySlabs.push_back(slab);
+        for (uint32_t i = 0; i < slabEntries; i++)
+            entryFree.push_back(reinterpret_cast<DirEntry*>(slab + (slabEntries - 1 - i) * sizeof(DirEntry)));
+    }
+    DirEntry* entry = entryFree.back();
+    entryFree.pop_back();
+    return new (entry) DirEntry(addr, this);
+}
+
+void DirEntryPool::releaseEntry(DirEntry* entry) {
+    entry->~DirEntry();
+    entryFree.push_back(entry);
+}
+
+void DirEntryPool::sharerOverflow(DirEntry* entry, int shr) {
+    out->fatal(CALL_INFO, -1, "DirEntry, Error: cannot add sharer %s to 0x%" PRIx64 ", all %" PRIu32 " sharer pointers are in use. "
+            "A sharer must be invalidated first. Entry: %s\n",
+            endpoints.getName(shr).c_str(), entry->getBaseAddr(), maxPointers, entry->getString().c_str());
+}
+
+/*
+ * Set-associative cache of directory entries with LRU replacement in each set.
+ * Entries that are evicted are written to memory but stay in the directory's
+ * master map. A set may temporarily hold more than assoc entries if its LRU
+ * entries are busy in the MSHR. An associativity of 0 makes the cache fully
+ * associative.
+ */
+class DirEntryCache {
+public:
+    DirEntryCache() : numSets(1), assoc(0), lineSize(64), count(0) { }
+
+    void configure(uint64_t entries, uint64_t associativity, uint64_t line) {
+        lineSize = line;
+        if (associativity == 0 || associativity >= entries) {
+            numSets = 1;
+            assoc = entries;
+        } else {
+            numSets = entries / associativity;
+            assoc = associativity;
+        }
+        sets.assign(numSets, Set());
+    }
+
+    uint64_t size() const { return count; }
+
+    uint64_t getSet(Addr addr) const { return (addr / lineSize) % numSets; }
+
+    /* Insert or move entry to the MRU position of its set and return the set */
+    uint64_t touch(DirEntry* entry) {
+        remove(entry);
+        uint64_t set = getSet(entry->getBaseAddr());
+        Set &s = sets[set];
+        entry->lruSet = set;
+        entry->lruPrev = nullptr;
+        entry->lruNext = s.mru;
+        if (s.mru)
+            s.mru->lruPrev = entry;
+        else
+            s.lru = entry;
+        s.mru = entry;
+        s.count++;
+        count++;
+        return set;
+    }
+
+    void remove(DirEntry* entry) {
+        if (entry->lruSet < 0)
+            return;
+        Set &s = sets[entry->lruSet];
+        if (entry->lruPrev)
+            entry->lruPrev->lruNext = entry->lruNext;
+        else
+            s.mru = entry->lruNext;
+        if (entry->lruNext)
+            entry->lruNext->lruPrev = entry->lruPrev;
+        else
+            s.lru = entry->lruPrev;
+        entry->lruPrev = entry->lruNext = nullptr;
+        entry->lruSet = -1;
+        s.count--;
+        count--;
+    }
+
+    bool isOverfull(uint64_t set) const { return sets[set].count > assoc; }
+
+    DirEntry* getLRU(uint64_t set) const { return sets[set].lru; }
+
+private:
+    struct Set {
+        DirEntry* mru;
+        DirEntry* lru;
+        uint64_t count;
+        Set() : mru(nullptr), lru(nullptr), count(0) { }
+    };
+
+    uint64_t numSets;
+    uint64_t assoc;
+    uint64_t lineSize;
+    uint64_t count;
+    std::vector<Set> sets;
+};
+
+/*
+ * Slots of a sparse directory. A line must hold a slot before the directory
+ * creates its entry, and keeps it until the entry returns to I. Slots are
+ * kept by address because entries are released when they return to I.
+ * Each set is ordered from LRU to MRU. An associativity of 0 makes the
+ * array fully associative; 0 entries leaves it unbounded.
+ */
+class DirEntryArray {
+public:
+    DirEntryArray() : numSets(1), assoc(0), lineSize(64) { }
+
+    void configure(uint64_t entries, uint64_t associativity, uint64_t line) {
+        lineSize = line;
+        if (associativity == 0 || associativity >= entries) {
+            numSets = 1;
+            assoc = entries;
+        } else {
+            numSets = entries / associativity;
+            assoc = associativity;
+        }
+        sets.assign(numSets, std::vector<Addr>());
+    }
+
+    bool isBounded() const { return assoc != 0; }
+
+    /* Move addr to the MRU position of its set. Returns false if addr does not hold a slot. */
+    bool touch(Addr addr) {
+        std::vector<Addr> &set = sets[getSet(addr)];
+        std::vector<Addr>::iterator it = std::find(set.begin(), set.end(), addr);
+        if (it == set.end())
+            return false;
+        std::rotate(it, it + 1, set.end());
+        return true;
+    }
+
+    /* Give addr the MRU slot of its set. Returns false if the set is full. */
+    bool allocate(Addr addr) {
+        std::vector<Addr> &set = sets[getSet(addr)];
+        if (set.size() >= assoc)
+            return false;
+        set.push_back(addr);
+        return true;
+    }
+
+    void release(Addr addr) {
+        std::vector<Addr> &set = sets[getSet(addr)];
+        std::vector<Addr>::iterator it = std::find(set.begin(), set.end(), addr);
+        if (it != set.end())
+            set.erase(it);
+    }
+
+    /* Lines holding a slot in addr's set, LRU first */
+    const std::vector<Addr>& getSetSlots(Addr addr) const { return sets[getSet(addr)]; }
+
+private:
+    uint64_t getSet(Addr addr) const { return (addr / lineSize) % numSets; }
+
+    uint64_t numSets;
+    uint64_t assoc;
+    uint64_t lineSize;
+    std::vector<std::vector<Addr> > sets;
+};
+
+}}
+
+#endif /* _MEMHIERARCHY_DIRECTORYENTRY_H_ */
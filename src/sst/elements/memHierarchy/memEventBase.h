@@ -22,6 +22,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -42,21 +43,31 @@ public:
     static const uint32_t F_LLSC            = 0x00000100;
     static const uint32_t F_SUCCESS         = 0x00001000;
     static const uint32_t F_NORESPONSE      = 0x00010000;
+    static const uint32_t F_IMPRECISE       = 0x00100000;   // Inv to a non-sharer that the sender's sharer encoding could not rule out
 
 
     /** Creates a new MemEventBase */
     MemEventBase(std::string src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
-        src_ = src;
+        src_ = EndpointTable::intern(src);
+    }
+
+    /** Events are allocated from a recycling pool (see memEventPool.h) */
+    static void* operator new(std::size_t size) {
+        return MemEventPool::allocate(size);
+    }
+
+    static void operator delete(void* ptr, std::size_t size) {
+        MemEventPool::release(ptr, size);
     }
 
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = noneEndpoint();
+        src_            = noneEndpoint();
+        rqstr_          = noneEndpoint();
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
@@ -96,19 +107,19 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return *src_; }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointTable::intern(src); }
 
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return *dst_; }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointTable::intern(dst); }
 
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return *rqstr_; }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointTable::intern(rqstr); }
 
     /** @returns the state of all flags */
     uint32_t getFlags(void) const { return flags_; }
@@ -160,6 +171,11 @@ public:
             str += "F_NORESPONSE";
             addComma = true;
         }
+        if (flags_ & F_IMPRECISE) {
+            if (addComma) str += ", ";
+            str += "F_IMPRECISE";
+            addComma = true;
+        }
         str += "]";
         return str;
     }
@@ -174,7 +190,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString();
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rq: " + rqstr_ + str.str();
+        return idstring.str() + cmdStr + " Src: " + *src_ + " Dst: " + *dst_ + " Rq: " + *rqstr_ + str.str();
     }
 
     /** Get brief print of the event */
@@ -182,7 +198,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_;
+        return idstring.str() + cmdStr + " Src: " + *src_ + " Dst: " + *dst_;
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -204,23 +220,38 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    const string*   src_;               // Source ID (interned, see EndpointTable)
+    const string*   dst_;               // Destination ID (interned)
+    const string*   rqstr_;             // Cache that originated this request (interned)
     Command         cmd_;               // Command
     uint32_t        flags_;
     uint32_t        memFlags_;
 
-    MemEventBase() {} // For serialization only
+    MemEventBase() : src_(noneEndpoint()), dst_(noneEndpoint()), rqstr_(noneEndpoint()) {} // For serialization only
+
+    static const string* noneEndpoint() {
+        static const string* none = EndpointTable::intern(NONE);
+        return none;
+    }
+
+    /* Endpoints travel as strings and are re-interned on the receiving rank */
+    void serializeEndpoint(SST::Core::Serialization::serializer &ser, const string* &endpoint) {
+        string name;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK)
+            name = *endpoint;
+        ser & name;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+            endpoint = EndpointTable::intern(name);
+    }
 
 public:
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
         ser & eventID_;
         ser & responseToID_;
-        ser & src_;
-        ser & dst_;
-        ser & rqstr_;
+        serializeEndpoint(ser, src_);
+        serializeEndpoint(ser, dst_);
+        serializeEndpoint(ser, rqstr_);
         ser & cmd_;
         ser & flags_;
         ser & memFlags_;
@@ -0,0 +1,125 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTPOOL_H
+#define MEMHIERARCHY_MEMEVENTPOOL_H
+
+#include <sst/core/sst_types.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "sst/elements/common/sizeClassPool.h"
+
+namespace SST { namespace MemHierarchy {
+
+/**
+ * Recycling allocator for memHierarchy events.
+ *
+ * MemEventBase routes its class-level operator new/delete here so that every
+ * event (including responses built by makeResponse() and copies made by clone())
+ * draws from a per-thread free list instead of the global heap. Blocks are
+ * bucketed into size classes so that all event subclasses share the pool. A
+ * cache with report_event_pool set records the pool counters as statistics.
+ */
+class MemEventPool : public SST::Elements::SizeClassPool<MemEventPool, 16, 32, 8192> {};
+
+
+/**
+ * Recycling allocator for objects of a single class, e.g., a request object
+ * that is created and deleted for every access. Each class gets its own pools;
+ * derived classes of a different size class go to the heap.
+ */
+template <typename T, uint32_t maxFree = 4096>
+using ObjectPool = SST::Elements::SizeClassPool<T, 16, (sizeof(T) + 15) / 16, maxFree>;
+
+
+/**
+ * Interning table for endpoint names.
+ *
+ * Events carry their source, destination, and requestor as pointers into this
+ * table rather than as private string copies, so building a response or cloning
+ * an event copies three pointers instead of three strings. Interned strings live
+ * for the remainder of the simulation; the set of endpoint names is bounded by
+ * the number of components.
+ */
+class EndpointTable {
+public:
+    static const std::string* intern(const std::string &name) {
+        /* Most names are set from another event's endpoint or a component's own
+         * name, so first look up the caller's string by address. An interned
+         * string maps to itself and needs no comparison */
+        AddressSlot &slot = addressCache()[(reinterpret_cast<uintptr_t>(&name) >> 4) % addressCacheSize];
+        if (slot.name == &name && (slot.interned == &name || *slot.interned == name))
+            return slot.interned;
+
+        std::unordered_map<std::string, const std::string*> &cache = localCache();
+        std::unordered_map<std::string, const std::string*>::const_iterator it = cache.find(name);
+        const std::string * interned;
+        if (it != cache.end()) {
+            interned = it->second;
+        } else {
+            {
+                std::lock_guard<std::mutex> lock(tableMutex());
+                interned = &(*table().insert(name).first);
+            }
+            cache.insert(std::make_pair(name, interned));
+
+            AddressSlot &self = addressCache()[(reinterpret_cast<uintptr_t>(interned) >> 4) % addressCacheSize];
+            self.name = interned;
+            self.interned = interned;
+        }
+        slot.name = &name;
+        slot.interned = interned;
+        return interned;
+    }
+
+private:
+    static const size_t addressCacheSize = 256;
+
+    struct AddressSlot {
+        const std::string * name;       // Address of a caller's string
+        const std::string * interned;   // Interned copy of its value when last seen
+    };
+
+    /* Direct-mapped, so it stays small however many distinct strings are passed in */
+    static AddressSlot* addressCache() {
+        static thread_local AddressSlot slots[addressCacheSize];
+        return slots;
+    }
+
+    static std::mutex& tableMutex() {
+        static std::mutex mtx;
+        return mtx;
+    }
+
+    /* Node-based set: element addresses remain stable across rehashes */
+    static std::unordered_set<std::string>& table() {
+        static std::unordered_set<std::string>* names = new std::unordered_set<std::string>();
+        return *names;
+    }
+
+    /* Per-thread lookaside so the common case does not take the lock */
+    static std::unordered_map<std::string, const std::string*>& localCache() {
+        static thread_local std::unordered_map<std::string, const std::string*> cache;
+        return cache;
+    }
+};
+
+}}
+
+#endif /* MEMHIERARCHY_MEMEVENTPOOL_H */
@@ -0,0 +1,177 @@
+// Copyright 2013-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "memLinkMulti.h"
+
+#include <sst/core/simulation.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/* Constructor */
+
+MemLinkMulti::MemLinkMulti(ComponentId_t id, Params &params) : MemLinkBase(id, params) {
+    std::string latency = params.find<std::string>("latency", "50ps");
+    std::string port = params.find<std::string>("port", "port");
+
+    std::string linkname = port + "_0";
+    while (isPortConnected(linkname)) {
+        SST::Link * link = configureLink(linkname, latency, new Event::Handler<MemLinkMulti>(this, &MemLinkMulti::recvNotify));
+        if (!link)
+            dbg.fatal(CALL_INFO, -1, "%s, Error: unable to configure link on port '%s'\n", getName().c_str(), linkname.c_str());
+        links.push_back(link);
+        linkname = port + "_" + std::to_string(links.size());
+    }
+
+    if (links.empty())
+        dbg.fatal(CALL_INFO, -1, "%s, Error: no ports connected. Expected ports '%s_0', '%s_1', ...\n", getName().c_str(), port.c_str(), port.c_str());
+
+    dbg.debug(_L10_, "%s memLinkMulti info is: Name: %s, addr: %" PRIu64 ", id: %" PRIu32 ", ports: %zu\n",
+            getName().c_str(), info.name.c_str(), info.addr, info.id, links.size());
+}
+
+/* init function */
+void MemLinkMulti::init(unsigned int phase) {
+    if (!phase) {
+        for (std::vector<SST::Link*>::iterator it = links.begin(); it != links.end(); it++) {
+            MemEventInitRegion * ev = new MemEventInitRegion(info.name, info.region, false);
+            dbg.debug(_L10_, "%s sending region init message: %s\n", getName().c_str(), ev->getVerboseString().c_str());
+            (*it)->sendInitData(ev);
+        }
+    }
+
+    for (unsigned int i = 0; i < links.size(); i++) {
+        SST::Event * ev;
+        while ((ev = links[i]->recvInitData())) {
+            MemEventInit * mEv = static_cast<MemEventInit*>(ev);
+            if (mEv) {
+                if (mEv->getInitCmd() == MemEventInit::InitCommand::Region) {
+                    MemEventInitRegion * mEvRegion = static_cast<MemEventInitRegion*>(mEv);
+                    dbg.debug(_L10_, "%s received init message on port %u: %s\n", getName().c_str(), i, mEvRegion->getVerboseString().c_str());
+
+                    EndpointInfo epInfo;
+                    epInfo.name = mEvRegion->getSrc();
+                    epInfo.addr = 0;
+                    epInfo.id = 0;
+                    epInfo.region = mEvRegion->getRegion();
+                    addRemote(epInfo, i);
+
+                    if (mEvRegion->getSetRegion() && acceptRegion) {
+                        dbg.debug(_L10_, "\tUpdating local region\n");
+                        info.region = mEvRegion->getRegion();
+                    }
+                    delete ev;
+                } else { /* No need to filter by source since these are direct links */
+                    initReceiveQ.push(mEv);
+                }
+            } else
+                delete ev;
+        }
+    }
+}
+
+/**
+ * send init data
+ * Events with a known destination go to that destination only, others are
+ * sent to every port as they would be over a bus
+ */
+void MemLinkMulti::sendInitData(MemEventInit * event) {
+    dbg.debug(_L10_, "%s sending init message: %s\n", getName().c_str(), event->getVerboseString().c_str());
+    std::unordered_map<std::string, SST::Link*>::iterator it = routes.find(event->getDst());
+    if (it != routes.end()) {
+        it->second->sendInitData(event);
+        return;
+    }
+
+    for (unsigned int i = 1; i < links.size(); i++)
+        links[i]->sendInitData(event->clone());
+    links[0]->sendInitData(event);
+}
+
+/**
+ * receive init data
+ */
+MemEventInit * MemLinkMulti::recvInitData() {
+    MemEventInit * me = nullptr;
+    if (!initReceiveQ.empty()) {
+        me = initReceiveQ.front();
+        initReceiveQ.pop();
+    }
+    return me;
+}
+
+void MemLinkMulti::addRemote(EndpointInfo info, unsigned int port) {
+    remotes.insert(info);
+    std::unordered_map<std::string, SST::Link*>::iterator it = routes.find(info.name);
+    if (it != routes.end() && it->second != links[port])
+        dbg.fatal(CALL_INFO, -1, "%s, Error: '%s' is connected to more than one port\n", getName().c_str(), info.name.c_str());
+    routes[info.name] = links[port];
+}
+
+/*
+ * Every remote is both a source and a destination, but only names that
+ * announced a region on one of our ports are either
+ */
+bool MemLinkMulti::isDest(std::string str) {
+    return routes.find(str) != routes.end();
+}
+
+bool MemLinkMulti::isSource(std::string str) {
+    return routes.find(str) != routes.end();
+}
+
+std::set<MemLinkBase::EndpointInfo>* MemLinkMulti::getSources() {
+    return &remotes;
+}
+
+std::set<MemLinkBase::EndpointInfo>* MemLinkMulti::getDests() {
+    return &remotes;
+}
+
+SST::Link* MemLinkMulti::lookupLink(const std::string& name) {
+    std::unordered_map<std::string, SST::Link*>::iterator it = routes.find(name);
+    if (it == routes.end())
+        dbg.fatal(CALL_INFO, -1, "%s, Error: no port leads to destination '%s'\n", getName().c_str(), name.c_str());
+    return it->second;
+}
+
+/**
+ * send event on the link to its destination
+ */
+void MemLinkMulti::send(MemEventBase *ev) {
+    lookupLink(ev->getDst())->send(ev);
+}
+
+std::string MemLinkMulti::findTargetDestination(Addr addr) {
+    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
+        if (it->region.contains(addr)) return it->name;
+    }
+
+    stringstream error;
+    error << getName() + " (MemLinkMulti) cannot find a destination for address " << addr << endl;
+    error << "Known destinations: " << endl;
+    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
+        error << it->name << " " << it->region.toString() << endl;
+    }
+    dbg.fatal(CALL_INFO, -1, "%s", error.str().c_str());
+    return "";
+}
+
+void MemLinkMulti::printStatus(Output &out) {
+    out.output("  MemHierarchy::MemLinkMulti: %zu ports\n", links.size());
+    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++)
+        out.output("    Remote: %s, Region: %s\n", it->name.c_str(), it->region.toString().c_str());
+}
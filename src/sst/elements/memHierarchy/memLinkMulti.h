@@ -0,0 +1,102 @@
+// Copyright 2013-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_MEMLINKMULTI_H_
+#define _MEMHIERARCHY_MEMLINKMULTI_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <queue>
+
+#include <sst/core/event.h>
+#include <sst/core/output.h>
+#include <sst/core/link.h>
+
+#include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/memLinkBase.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ *  MemLinkMulti connects a component directly to several others, one link per port.
+ *  Events are routed by destination name to the port the destination was seen on
+ *  during init, so no bus or network component sits between the endpoints.
+ *
+ *  This is used to build a sliced cache: each slice is a separate Cache component
+ *  (num_cache_slices/slice_id) and the caches above and the memory below connect
+ *  to every slice with a MemLinkMulti. Since each slice has its own clock and
+ *  queues and the slices only share links, the partitioner can place them on
+ *  different ranks or threads.
+ */
+class MemLinkMulti : public MemLinkBase {
+
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(MemLinkMulti, "memHierarchy", "MemLinkMulti", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Memory-oriented link interface with a direct link to each of several components, e.g., the slices of a sliced cache", SST::MemHierarchy::MemLinkBase)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMLINKBASE_ELI_PARAMS,
+            { "latency",    "(string) Link latency. Prefix 'cpulink' for up-link towards CPU or 'memlink' for down-link towards memory", "50ps"},
+            { "port",       "(string) Prefix of the ports this memLink sits on. Ports <port>_0, <port>_1, ... are used until one is not connected.", "port"} )
+
+    SST_ELI_DOCUMENT_PORTS( { "port_%(ports)d", "Ports to other memory components, for example the slices of a sliced cache", {"memHierarchy.MemEventBase"} } )
+
+/* Begin class definition */
+
+    /* Constructor */
+    MemLinkMulti(ComponentId_t id, Params &params);
+
+    /* Destructor */
+    virtual ~MemLinkMulti() { }
+
+    /* Initialization functions for parent */
+    virtual void init(unsigned int phase);
+
+    /* Remote endpoint info management */
+    virtual std::set<EndpointInfo>* getSources();
+    virtual std::set<EndpointInfo>* getDests();
+    virtual bool isDest(std::string str);
+    virtual bool isSource(std::string str);
+    virtual std::string findTargetDestination(Addr addr);
+
+    /* Send and receive functions for MemLinkMulti */
+    virtual void sendInitData(MemEventInit * ev);
+    virtual MemEventInit* recvInitData();
+    virtual void send(MemEventBase * ev);
+
+    /* Debug */
+    virtual void printStatus(Output &out);
+
+protected:
+    void addRemote(EndpointInfo info, unsigned int port);
+    SST::Link* lookupLink(const std::string& name);
+
+    // Links, one per port
+    std::vector<SST::Link*> links;
+
+    // Data structures
+    std::set<EndpointInfo> remotes;
+    std::unordered_map<std::string, SST::Link*> routes;   // Remote name -> link it is reached on
+};
+
+} //namespace memHierarchy
+} //namespace SST
+
+#endif
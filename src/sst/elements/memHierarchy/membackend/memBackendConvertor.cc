@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 
 
 MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBackend* backend, uint32_t request_width) :
-    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend)
+    SubComponent(id), m_cycleCount(0), m_reqId(0), m_nextSeq(0), m_oldestSeq(0), m_backend(backend)
 {
     m_dbg.init("",
             params.find<uint32_t>("debug_level", 0),
@@ -49,6 +49,13 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
 
     m_clockBackend = m_backend->isClocked();
 
+    std::string flushOrdering = params.find<std::string>("flush_ordering", "address");
+    if ( flushOrdering != "address" && flushOrdering != "sequence" ) {
+        m_dbg.fatal(CALL_INFO, -1, "Invalid param(%s): flush_ordering - must be 'address' or 'sequence'. You specified '%s'.\n",
+                getName().c_str(), flushOrdering.c_str());
+    }
+    m_flushBySequence = ( flushOrdering == "sequence" );
+
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived   = registerStatistic<uint64_t>("requests_received_GetSX");
     stat_GetXReqReceived    = registerStatistic<uint64_t>("requests_received_GetX");
@@ -90,6 +97,9 @@ void MemBackendConvertor::handleCustomEvent( CustomCmdInfo * info) {
     CustomReq* req = new CustomReq( info, id );
     m_requestQueue.push_back( req );
     m_pendingRequests[id] = req;
+    if ( m_flushBySequence ) {
+        assignSeq( req );
+    }
 }
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
@@ -118,6 +128,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
+            dequeueMemReq( req );
             m_requestQueue.pop_front();
         }
     }
@@ -180,6 +191,9 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
     if ( req->isDone() ) {
         m_pendingRequests.erase(id);
+        if (m_flushBySequence) {
+            retireSeq( req );
+        }
 
         if (!req->isMemEv()) {
             CustomCmdInfo * info = static_cast<CustomReq*>(req)->getInfo();
@@ -187,6 +201,10 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             sendResponse(info->getID(), flags);
             delete info; // NOTE move this if needed, currently memController doesn't need it
 
+            if (m_flushBySequence) {
+                completeFlushes( nullptr );
+            }
+
         } else {
 
             MemEvent* event = static_cast<MemReq*>(req)->getMemEvent();
@@ -198,29 +216,42 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             doResponseStat( event->getCmd(), latency );
 
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
-                        m_waitingFlushes.erase(flush);
-                    }
-                }
-                m_dependentRequests.erase(evID);
-            }
+            completeFlushes( static_cast<MemReq*>(req) );
         }
         delete req;
     }
 }
 
+/*
+ * Respond to the flushes that were waiting on a request that has just completed.
+ * In sequence mode that is every flush older than the oldest request still pending.
+ */
+void MemBackendConvertor::completeFlushes( MemReq* req ) {
+    if (m_flushBySequence) {
+        while (!m_sequenceFlushes.empty()) {
+            if (!m_seqDone.empty() && m_oldestSeq <= m_sequenceFlushes.front().seq)
+                break;
+
+            MemEvent * flush = m_sequenceFlushes.front().event;
+            sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
+            m_sequenceFlushes.pop_front();
+        }
+        return;
+    }
+
+    std::vector<WaitingFlush*>& flushes = req->getWaitingFlushes();
+    for (std::vector<WaitingFlush*>::iterator it = flushes.begin(); it != flushes.end(); it++) {
+        if (0 == --(*it)->remaining) {
+            MemEvent * flush = (*it)->event;
+            sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
+            delete *it;
+        }
+    }
+}
+
 void MemBackendConvertor::sendResponse( SST::Event::id_type id, uint32_t flags ) {
 
     m_notifyResponse( id, flags );
@@ -21,6 +21,10 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
@@ -40,7 +44,8 @@ class MemBackendConvertor : public SubComponent {
 /* ELI definitions for subclasses */
 #define MEMBACKENDCONVERTOR_ELI_PARAMS {"debug_level",     "(uint) Debugging level: 0 (no output) to 10 (all output). Output also requires that SST Core be compiled with '--enable-debug'", "0"},\
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
-            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"}
+            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
+            {"flush_ordering",  "(string) When a flush reaching memory completes. 'address': once queued requests to the same line have completed. 'sequence': once every request received before it has completed", "address"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -59,12 +64,24 @@ class MemBackendConvertor : public SubComponent {
 
     typedef uint64_t ReqId;
 
+    /* A flush that is waiting on earlier requests. In address mode it counts
+     * the queued requests to its line that have yet to complete, in sequence
+     * mode it completes once every request with a sequence number up to seq
+     * has completed */
+    struct WaitingFlush {
+        WaitingFlush( MemEvent* ev, uint64_t seq, uint32_t count ) : event(ev), seq(seq), remaining(count) { }
+
+        MemEvent*   event;
+        uint64_t    seq;
+        uint32_t    remaining;
+    };
+
     class BaseReq {
     public:
 
         enum class ReqType { BASE, MEM, CUSTOM };
 
-        BaseReq( uint32_t reqId, ReqType(type) ) : m_reqId(reqId), m_type(type) { }
+        BaseReq( uint32_t reqId, ReqType(type) ) : m_reqId(reqId), m_type(type), m_seq(0) { }
         virtual ~BaseReq() { }
 
         static uint32_t getBaseId( ReqId id) { return id >> 32; }
@@ -81,9 +98,14 @@ class MemBackendConvertor : public SubComponent {
         bool isMemEv() { return m_type == ReqType::MEM; }
         bool isCustCmd() { return m_type == ReqType::CUSTOM; }
         virtual const std::string getRqstr() { return ""; }
+
+        /* Arrival order for sequence flush ordering; unlike the id this does not wrap */
+        void setSeq( uint64_t seq ) { m_seq = seq; }
+        uint64_t getSeq() { return m_seq; }
     protected:
         uint32_t m_reqId;
         ReqType m_type;
+        uint64_t m_seq;
     };
 
     class CustomReq : public BaseReq {
@@ -122,6 +144,10 @@ class MemBackendConvertor : public SubComponent {
             ++m_numReq;
         }
         void decrement( ) { --m_numReq; }
+
+        void addWaitingFlush( WaitingFlush* flush ) { m_flushes.push_back( flush ); }
+        std::vector<WaitingFlush*>& getWaitingFlushes() { return m_flushes; }
+
         bool issueDone() {
             return m_offset >= m_event->getSize();
         }
@@ -140,6 +166,7 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<WaitingFlush*> m_flushes;
     };
 
   public:
@@ -194,27 +221,20 @@ class MemBackendConvertor : public SubComponent {
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
+            if ( m_flushBySequence ) {
+                // Nothing older is outstanding
+                if ( m_seqDone.empty() ) return false;
+                m_sequenceFlushes.push_back( WaitingFlush( ev, m_nextSeq - 1, 0 ) );
+                return true;
             }
 
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+            std::unordered_map<Addr, std::deque<MemReq*> >::iterator queued = m_queuedByAddr.find(ev->getBaseAddr());
+            if (queued == m_queuedByAddr.end()) return false;
+
+            WaitingFlush * flush = new WaitingFlush( ev, 0, queued->second.size() );
+            for (std::deque<MemReq*>::iterator it = queued->second.begin(); it != queued->second.end(); it++) {
+                (*it)->addWaitingFlush(flush);
+            }
             return true;
         }
 
@@ -222,9 +242,44 @@ class MemBackendConvertor : public SubComponent {
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
         m_pendingRequests[id] = req;
+        if ( m_flushBySequence ) {
+            assignSeq( req );
+        } else {
+            m_queuedByAddr[ev->getBaseAddr()].push_back( req );
+        }
         return true;
     }
 
+    /* Sequence ordering: number requests in arrival order and track which have completed.
+     * m_seqDone[i] is for sequence number m_oldestSeq + i, so the front is the oldest
+     * request still pending once completed entries are popped */
+    void assignSeq( BaseReq* req ) {
+        req->setSeq( m_nextSeq++ );
+        m_seqDone.push_back( false );
+    }
+
+    void retireSeq( BaseReq* req ) {
+        m_seqDone[ req->getSeq() - m_oldestSeq ] = true;
+        while ( ! m_seqDone.empty() && m_seqDone.front() ) {
+            m_seqDone.pop_front();
+            m_oldestSeq++;
+        }
+    }
+
+    /* Remove a request that has been fully issued from the queued-by-address index */
+    void dequeueMemReq( BaseReq* req ) {
+        if ( m_flushBySequence || ! req->isMemEv() ) return;
+
+        MemReq * mr = static_cast<MemReq*>(req);
+        std::unordered_map<Addr, std::deque<MemReq*> >::iterator queued = m_queuedByAddr.find(mr->baseAddr());
+        queued->second.pop_front();
+        if (queued->second.empty()) {
+            m_queuedByAddr.erase(queued);
+        }
+    }
+
+    void completeFlushes( MemReq* req );
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
     }
@@ -287,8 +342,12 @@ class MemBackendConvertor : public SubComponent {
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    bool m_flushBySequence;
+    std::unordered_map<Addr, std::deque<MemReq*> > m_queuedByAddr;  // Requests still in m_requestQueue by line, oldest first
+    std::deque<WaitingFlush> m_sequenceFlushes;                     // Flushes waiting in sequence mode, in arrival order
+    uint64_t m_nextSeq;             // Sequence number of the next request
+    uint64_t m_oldestSeq;           // Sequence number of m_seqDone.front()
+    std::deque<bool> m_seqDone;     // Completion of every request from m_oldestSeq on
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
@@ -94,7 +94,8 @@ bool TimingDRAM::clock(Cycle_t cycle)
 //==================================================================================
 
 TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handler, Params& params, unsigned mc, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0)
+    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0),
+    m_scheduler(nullptr), m_banksPerRank(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Channel:@p():@l:mc=" << mc << ":chan=" << myNum << ": ";
@@ -107,11 +108,14 @@ TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handl
 
     m_mapper->setNumRanks( numRanks );
 
+    std::string schedName = params.find<std::string>("scheduler", "");
+
     if (m_printConfig)
         m_printConfig = params.find<bool>("printconfig", true);
     if ( m_printConfig ) {
         m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "max pending trans: %d\n",m_maxPendingTrans);
         m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "number of ranks:   %d\n",numRanks);
+        m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "scheduler:         %s\n",schedName.empty() ? "round-robin" : schedName.c_str());
         m_printConfig = false;
     }
 
@@ -119,6 +123,23 @@ TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handl
     for ( unsigned i=0; i<numRanks; i++ ) {
         m_ranks.push_back( loadComponentExtension<Rank>( tmpParams, mc, myNum, i, output, mapper ) );
     }
+
+    if ( ! schedName.empty() ) {
+        tmpParams = params.find_prefix_params("scheduler." );
+        m_scheduler = loadAnonymousSubComponent<ChannelScheduler>(schedName, "scheduler", 0, ComponentInfo::INSERT_STATS, tmpParams);
+        if ( ! m_scheduler ) {
+            m_output->fatal(CALL_INFO, -1, "Invalid param(%s): scheduler, '%s'.\n", getName().c_str(), schedName.c_str());
+        }
+
+        m_banksPerRank = m_ranks[0]->getNumBanks();
+        for ( unsigned rank = 0; rank < numRanks; rank++ ) {
+            for ( unsigned bank = 0; bank < m_banksPerRank; bank++ ) {
+                m_banks.push_back( m_ranks[rank]->getBank( bank ) );
+            }
+        }
+        m_banksWithWork.resize( (m_banks.size() + 63) / 64, 0 );
+        m_scheduler->setNumBanks( m_banks.size() );
+    }
 }
 
 void TimingDRAM::Channel::clock( SimTime_t cycle )
@@ -139,6 +160,11 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
 
             if (cmd->getTrans() != nullptr) {
                 m_retiredTrans.push(cmd->getTrans());
+
+                if ( m_scheduler ) {
+                    m_scheduler->transactionRetired( cmd->getTrans(),
+                            m_mapper->getRank( cmd->getTrans()->addr ) * m_banksPerRank + cmd->getTrans()->bank );
+                }
             }
 
             delete (*iter);
@@ -162,7 +188,7 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     }
 
     /* For each rank, check if there's a command to issue */
-    Cmd* cmd = popCmd( cycle, m_dataBusAvailCycle );
+    Cmd* cmd = m_scheduler ? scheduleCmd( cycle ) : popCmd( cycle, m_dataBusAvailCycle );
     if ( cmd ) {
         if (is_debug)
             m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " issue %s for rank=%d bank=%d row=%d\n",
@@ -202,6 +228,53 @@ TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBus
     return cmd;
 }
 
+/* Offer the head command of every bank with work to the scheduler if it can issue this cycle */
+TimingDRAM::Cmd* TimingDRAM::Channel::scheduleCmd( SimTime_t cycle )
+{
+    m_candidates.clear();
+    m_candidateCmds.clear();
+
+    for ( unsigned word = 0; word < m_banksWithWork.size(); word++ ) {
+        uint64_t bits = m_banksWithWork[word];
+        while ( bits ) {
+            unsigned bank = word * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            Cmd* cmd = m_banks[bank]->readyCmd( cycle, m_dataBusAvailCycle );
+
+            if ( cmd ) {
+                Transaction* trans = cmd->getTarget();
+
+                SchedCandidate cand;
+                cand.bank = bank;
+                cand.rowHit = ( cmd->getOp() == Cmd::COL );
+                cand.activate = ( cmd->getOp() == Cmd::ACT );
+                cand.activated = trans ? trans->activated : false;
+                cand.isWrite = trans ? trans->isWrite : false;
+                cand.marked = trans ? trans->marked : false;
+                cand.createTime = trans ? trans->createTime : cycle;
+
+                m_candidates.push_back( cand );
+                m_candidateCmds.push_back( cmd );
+            } else if ( m_banks[bank]->isIdle() ) {
+                m_banksWithWork[word] &= ~(uint64_t(1) << (bank % 64));
+            }
+        }
+    }
+
+    if ( m_candidates.empty() ) {
+        return nullptr;
+    }
+
+    unsigned pick = m_scheduler->select( m_candidates );
+    unsigned bank = m_candidates[pick].bank;
+    m_banks[bank]->popReadyCmd();
+    if ( m_banks[bank]->isIdle() ) {
+        m_banksWithWork[bank / 64] &= ~(uint64_t(1) << (bank % 64));
+    }
+    return m_candidateCmds[pick];
+}
+
 //==================================================================================
 // Rank
 //==================================================================================
@@ -316,6 +389,16 @@ TimingDRAM::Cmd* TimingDRAM::Bank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     return cmd;
 }
 
+TimingDRAM::Cmd* TimingDRAM::Bank::readyCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
+{
+    update( cycle );
+
+    if ( ! m_cmdQ.empty() && m_cmdQ.front()->canIssue( cycle, dataBusAvailCycle ) ) {
+        return m_cmdQ.front();
+    }
+    return nullptr;
+}
+
 void TimingDRAM::Bank::update( SimTime_t current )
 {
     if ( nullptr == m_lastCmd && m_row != -1 && m_pagePolicy->shouldClose( current ) ) {
@@ -340,10 +423,13 @@ void TimingDRAM::Bank::update( SimTime_t current )
     if ( trans->row != m_row ) {
         if ( m_row != -1 ) {
             cmd = new Cmd( this, Cmd::PRE, m_trp_lat );
+            cmd->setTarget( trans );
             m_cmdQ.push_back(cmd);
         }
 
         cmd = new Cmd( this, Cmd::ACT, m_rcd_lat, trans->row );
+        cmd->setTarget( trans );
+        trans->activated = true;
         m_cmdQ.push_back(cmd);
         m_row = trans->row;
     }
@@ -21,6 +21,7 @@
 #include "sst/elements/memHierarchy/membackend/timingAddrMapper.h"
 #include "sst/elements/memHierarchy/membackend/timingTransaction.h"
 #include "sst/elements/memHierarchy/membackend/timingPagePolicy.h"
+#include "sst/elements/memHierarchy/membackend/timingScheduler.h"
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
@@ -44,18 +45,20 @@ public:
             {"channels", "Number of channels", "1"},
             {"channel.numRanks", "Number of ranks per channel", "1"},
             {"channel.transaction_Q_size", "Size of transaction queue", "32"},
+            {"channel.scheduler", "Channel command scheduler (subcomponent), e.g. memHierarchy.frfcfsScheduler or memHierarchy.parbsScheduler. If not set, commands are issued round-robin across ranks and banks. The scheduler only chooses between banks: it sees the next command of each bank, and which queued transaction a bank turns into commands next is decided by the bank's transactionQ", ""},
             {"channel.rank.numBanks", "Number of banks per rank", "8"},
             {"channel.rank.bank.CL", "Column access latency in cycles", "11"},
             {"channel.rank.bank.CL_WR", "Column write latency", "11"},
             {"channel.rank.bank.RCD", "Row access latency in cycles", "11"},
             {"channel.rank.bank.TRP", "Precharge delay in cycles", "11"},
             {"channel.rank.bank.dataCycles", "", "4"},
-            {"channel.rank.bank.transactionQ", "Transaction queue model (subcomponent)", "memHierarchy.fifoTransactionQ"},
+            {"channel.rank.bank.transactionQ", "Transaction queue model (subcomponent). Picks the next transaction of a bank, also when a channel scheduler is used. memHierarchy.reorderTransactionQ prefers row hits within its window", "memHierarchy.fifoTransactionQ"},
             {"channel.rank.bank.pagePolicy", "Policy subcomponent for managing row buffer", "memHierarchy.simplePagePolicy"})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"transactionQ", "Transaction queue model", "SST::MemHierarchy::TimingDRAM_NS::TransactionQ"},
-            {"pagePolicy", "Policy subcomponent for managing row buffer", "SST::MemHierarchy::TimingDRAM_NS::PagePolicy"} )
+            {"pagePolicy", "Policy subcomponent for managing row buffer", "SST::MemHierarchy::TimingDRAM_NS::PagePolicy"},
+            {"scheduler", "Channel command scheduler", "SST::MemHierarchy::TimingDRAM_NS::ChannelScheduler"} )
 
 /* Begin class definition */
 private:
@@ -77,6 +80,14 @@ private:
 
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
 
+        /* Used with a channel scheduler, returns the head command if it can
+         * issue this cycle but leaves it queued until the scheduler picks it */
+        Cmd* readyCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
+
+        void popReadyCmd() {
+            m_cmdQ.pop_front();
+        }
+
         void setLastCmd( Cmd* cmd ) {
             m_lastCmd = cmd;
         }
@@ -132,7 +143,7 @@ private:
       public:
         enum Op { PRE, ACT, COL } m_op;
         Cmd( Bank* bank, Op op, unsigned cycles, unsigned row = -1, unsigned dataCycles = 0, Transaction* trans  = NULL  ) :
-            m_bank(bank), m_op(op), m_cycles(cycles), m_row(row), m_dataCycles(dataCycles), m_trans(trans)
+            m_bank(bank), m_op(op), m_cycles(cycles), m_row(row), m_dataCycles(dataCycles), m_trans(trans), m_target(trans)
         {
             switch( m_op ) {
               case PRE:
@@ -211,10 +222,15 @@ private:
 
         // these are used for debugging
         std::string& getName()  { return m_name; }
+        Op getOp()              { return m_op; }
         unsigned getRank()      { return m_bank->getRank(); }
         unsigned getBank()      { return m_bank->getBank(); }
         unsigned getRow()       { return m_row; }
         Transaction* getTrans() { return m_trans; }
+
+        /* The transaction a PRE/ACT/COL is issued for, NULL for a PRE from the page policy */
+        void setTarget( Transaction* trans ) { m_target = trans; }
+        Transaction* getTarget() { return m_target; }
       private:
 
         Bank*           m_bank;
@@ -223,6 +239,7 @@ private:
         unsigned        m_row;
         unsigned        m_dataCycles;
         Transaction*    m_trans;
+        Transaction*    m_target;
 
         SimTime_t       m_issueTime;
         SimTime_t       m_finiTime;
@@ -256,6 +273,9 @@ private:
             return !m_banksActive.empty();
         }
 
+        Bank* getBank( unsigned bank ) { return m_banks[bank]; }
+        unsigned getNumBanks() { return m_banks.size(); }
+
       private:
 
         const char* prefix() { return m_pre.c_str(); }
@@ -291,7 +311,15 @@ private:
             Transaction* trans = new Transaction( createTime, id, addr, isWrite, numBytes, m_mapper->getBank(addr),
                                                 m_mapper->getRow(addr) );
             m_pendingCount++;
-            m_ranks[ rank ]->pushTrans( trans );
+
+            if ( m_scheduler ) {
+                unsigned bank = rank * m_banksPerRank + trans->bank;
+                m_banks[bank]->pushTrans( trans );
+                m_banksWithWork[bank / 64] |= (uint64_t(1) << (bank % 64));
+                m_scheduler->transactionArrived( trans, bank );
+            } else {
+                m_ranks[ rank ]->pushTrans( trans );
+            }
             return true;
         }
 
@@ -299,6 +327,7 @@ private:
 
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
+        Cmd* scheduleCmd( SimTime_t cycle );
         const char* prefix() { return m_pre.c_str(); }
         Output*             m_output;
         AddrMapper*         m_mapper;
@@ -307,6 +336,17 @@ private:
         unsigned            m_nextRankUp;
         std::vector<Rank*>  m_ranks;
 
+        /* Channel scheduler state, banks are indexed rank * m_banksPerRank + bank.
+         * m_banksWithWork has a bit set for each bank that is not idle, i.e., has
+         * queued transactions or commands or an open row its page policy may close.
+         * Whether the bank's head command can issue is checked every cycle. */
+        ChannelScheduler*   m_scheduler;
+        unsigned            m_banksPerRank;
+        std::vector<Bank*>  m_banks;
+        std::vector<uint64_t> m_banksWithWork;
+        std::vector<SchedCandidate> m_candidates;
+        std::vector<Cmd*>   m_candidateCmds;
+
         unsigned            m_dataBusAvailCycle;
         unsigned            m_maxPendingTrans;
         unsigned            m_pendingCount;
@@ -0,0 +1,290 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_TIMING_SCHEDULER
+#define _H_SST_MEMH_TIMING_SCHEDULER
+
+#include <list>
+#include <vector>
+
+#include <sst/core/subcomponent.h>
+
+#include "sst/elements/memHierarchy/membackend/timingTransaction.h"
+
+namespace SST {
+namespace MemHierarchy {
+namespace TimingDRAM_NS {
+
+#define TIMING_SCHEDULER_ELI_PARAMS \
+    {"write_high_watermark", "Enter write drain mode when this many writes are queued in the channel, 0 to disable write draining", "0"},\
+    {"write_low_watermark", "Leave write drain mode when the number of queued writes falls to this value", "0"}
+
+#define TIMING_SCHEDULER_ELI_STATS \
+    {"row_hits",            "Transactions whose row was already open, counted when the column command issues", "transactions", 1},\
+    {"row_misses",          "Transactions that needed an activate (empty row or row conflict), counted when the activate issues", "transactions", 1},\
+    {"write_drains",        "Number of times the channel entered write drain mode", "count", 2},\
+    {"candidates_per_issue","Number of banks that could issue a command when a command was issued", "banks", 3}
+
+/*
+ * Channel-level command scheduler
+ *
+ * Each cycle the channel collects the banks whose next command can issue and
+ * the scheduler picks one of them. A candidate describes the command at the
+ * head of the bank's command queue and the transaction it is for.
+ *
+ * The scheduler does not choose among the transactions queued at a bank. A
+ * bank turns its transactions into commands in the order its transactionQ
+ * hands them out and issues those commands in order. With the default FIFO
+ * queue a row hit queued behind a row miss at the same bank waits for the
+ * miss whatever the policy, so the policies below only order commands
+ * across banks.
+ */
+struct SchedCandidate {
+    unsigned        bank;       // Flat index (rank * banks per rank + bank)
+    bool            rowHit;     // Head command is a column access to the open row
+    bool            activate;   // Head command is an activate
+    bool            activated;  // Transaction needed an activate of its own
+    bool            isWrite;
+    bool            marked;     // Transaction belongs to the current batch
+    SimTime_t       createTime;
+};
+
+class ChannelScheduler : public SST::SubComponent {
+  public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::TimingDRAM_NS::ChannelScheduler)
+
+/* Begin class definition */
+    ChannelScheduler( ComponentId_t id, Params& params ) : SubComponent( id ), m_writes(0), m_draining(false) {
+        m_writeHigh = params.find<unsigned>("write_high_watermark", 0);
+        m_writeLow = params.find<unsigned>("write_low_watermark", 0);
+        if ( m_writeHigh && m_writeLow >= m_writeHigh ) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "Invalid param(%s): write_low_watermark must be less than write_high_watermark. Got low=%u, high=%u\n",
+                    getName().c_str(), m_writeLow, m_writeHigh);
+        }
+
+        stat_rowHit = registerStatistic<uint64_t>("row_hits");
+        stat_rowMiss = registerStatistic<uint64_t>("row_misses");
+        stat_drains = registerStatistic<uint64_t>("write_drains");
+        stat_candidates = registerStatistic<uint64_t>("candidates_per_issue");
+    }
+
+    virtual ~ChannelScheduler() {}
+
+    virtual void setNumBanks( unsigned banks ) {}
+
+    /* A transaction was queued at / removed from a bank */
+    virtual void transactionArrived( Transaction* trans, unsigned bank ) {
+        if ( trans->isWrite ) {
+            m_writes++;
+            if ( m_writeHigh && !m_draining && m_writes >= m_writeHigh ) {
+                m_draining = true;
+                stat_drains->addData(1);
+            }
+        }
+    }
+
+    virtual void transactionRetired( Transaction* trans, unsigned bank ) {
+        if ( trans->isWrite ) {
+            m_writes--;
+            if ( m_draining && m_writes <= m_writeLow ) {
+                m_draining = false;
+            }
+        }
+    }
+
+    /* Returns the index in cands of the command to issue, cands is not empty */
+    unsigned select( std::vector<SchedCandidate>& cands ) {
+        stat_candidates->addData(cands.size());
+
+        unsigned best = 0;
+        for ( unsigned i = 1; i < cands.size(); i++ ) {
+            if ( before( cands[i], cands[best] ) ) {
+                best = i;
+            }
+        }
+
+        // Count each transaction once: at its activate if it needed one,
+        // otherwise at its column command. Precharges are not counted.
+        if ( cands[best].activate ) {
+            stat_rowMiss->addData(1);
+        } else if ( cands[best].rowHit && ! cands[best].activated ) {
+            stat_rowHit->addData(1);
+        }
+        return best;
+    }
+
+  protected:
+    /* Policy order, true if a should issue before b */
+    virtual bool before( const SchedCandidate& a, const SchedCandidate& b ) = 0;
+
+    /* With write draining enabled, writes go first while draining and reads go first otherwise */
+    int compareDrain( const SchedCandidate& a, const SchedCandidate& b ) {
+        if ( ! m_writeHigh || a.isWrite == b.isWrite ) {
+            return 0;
+        }
+        return ( a.isWrite == m_draining ) ? -1 : 1;
+    }
+
+    int compareRowHit( const SchedCandidate& a, const SchedCandidate& b ) {
+        if ( a.rowHit == b.rowHit ) {
+            return 0;
+        }
+        return a.rowHit ? -1 : 1;
+    }
+
+    bool olderThan( const SchedCandidate& a, const SchedCandidate& b ) {
+        if ( a.createTime != b.createTime ) {
+            return a.createTime < b.createTime;
+        }
+        return a.bank < b.bank;
+    }
+
+    unsigned    m_writeHigh;
+    unsigned    m_writeLow;
+    unsigned    m_writes;
+    bool        m_draining;
+
+    Statistic<uint64_t>* stat_rowHit;
+    Statistic<uint64_t>* stat_rowMiss;
+    Statistic<uint64_t>* stat_drains;
+    Statistic<uint64_t>* stat_candidates;
+};
+
+/*
+ * First-ready, first-come first-served: column accesses to an open row go
+ * before commands that need a precharge or activate, then oldest first
+ */
+class FRFCFSScheduler : public ChannelScheduler {
+  public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(FRFCFSScheduler, "memHierarchy", "frfcfsScheduler", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "FR-FCFS channel command scheduler", SST::MemHierarchy::TimingDRAM_NS::ChannelScheduler)
+
+    SST_ELI_DOCUMENT_PARAMS( TIMING_SCHEDULER_ELI_PARAMS )
+
+    SST_ELI_DOCUMENT_STATISTICS( TIMING_SCHEDULER_ELI_STATS )
+
+/* Begin class definition */
+    FRFCFSScheduler( ComponentId_t id, Params& params ) : ChannelScheduler( id, params ) {}
+
+  protected:
+    virtual bool before( const SchedCandidate& a, const SchedCandidate& b ) {
+        int cmp = compareDrain( a, b );
+        if ( 0 == cmp ) {
+            cmp = compareRowHit( a, b );
+        }
+        if ( 0 != cmp ) {
+            return cmp < 0;
+        }
+        return olderThan( a, b );
+    }
+};
+
+/*
+ * Parallelism-aware batch scheduling. When the current batch has been
+ * serviced the oldest batch_cap transactions queued at each bank are marked
+ * as the next batch. Marking only affects a bank's turn against other banks,
+ * not the order the bank's transactionQ hands out transactions. Marked transactions go before unmarked ones so that
+ * old requests can not be starved by a stream of row hits, and within the
+ * batch row hits then age decide. Requests reaching the memory backend do
+ * not carry the thread that made them, so the per-thread ranking of PAR-BS
+ * and ATLAS is not modelled and every transaction counts as one thread.
+ */
+class PARBSScheduler : public ChannelScheduler {
+  public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(PARBSScheduler, "memHierarchy", "parbsScheduler", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Batching (PAR-BS style) channel command scheduler", SST::MemHierarchy::TimingDRAM_NS::ChannelScheduler)
+
+    SST_ELI_DOCUMENT_PARAMS( TIMING_SCHEDULER_ELI_PARAMS,
+            {"batch_cap", "Maximum number of transactions per bank marked in a batch", "5"} )
+
+    SST_ELI_DOCUMENT_STATISTICS( TIMING_SCHEDULER_ELI_STATS,
+            {"batches", "Number of batches formed", "count", 2} )
+
+/* Begin class definition */
+    PARBSScheduler( ComponentId_t id, Params& params ) : ChannelScheduler( id, params ), m_marked(0) {
+        m_batchCap = params.find<unsigned>("batch_cap", 5);
+        if ( 0 == m_batchCap ) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "Invalid param(%s): batch_cap must be at least 1\n", getName().c_str());
+        }
+        stat_batches = registerStatistic<uint64_t>("batches");
+    }
+
+    virtual void setNumBanks( unsigned banks ) {
+        m_queued.resize( banks );
+    }
+
+    virtual void transactionArrived( Transaction* trans, unsigned bank ) {
+        ChannelScheduler::transactionArrived( trans, bank );
+        trans->marked = false;
+        trans->batchPos = m_queued[bank].insert( m_queued[bank].end(), trans );
+        if ( 0 == m_marked ) {
+            formBatch();
+        }
+    }
+
+    virtual void transactionRetired( Transaction* trans, unsigned bank ) {
+        ChannelScheduler::transactionRetired( trans, bank );
+
+        m_queued[bank].erase( trans->batchPos );
+
+        if ( trans->marked && 0 == --m_marked ) {
+            formBatch();
+        }
+    }
+
+  protected:
+    virtual bool before( const SchedCandidate& a, const SchedCandidate& b ) {
+        int cmp = compareDrain( a, b );
+        if ( 0 == cmp && a.marked != b.marked ) {
+            cmp = a.marked ? -1 : 1;
+        }
+        if ( 0 == cmp ) {
+            cmp = compareRowHit( a, b );
+        }
+        if ( 0 != cmp ) {
+            return cmp < 0;
+        }
+        return olderThan( a, b );
+    }
+
+  private:
+    void formBatch() {
+        for ( unsigned bank = 0; bank < m_queued.size(); bank++ ) {
+            unsigned count = 0;
+            for ( std::list<Transaction*>::iterator iter = m_queued[bank].begin();
+                    iter != m_queued[bank].end() && count < m_batchCap; ++iter, ++count ) {
+                (*iter)->marked = true;
+                m_marked++;
+            }
+        }
+        if ( m_marked ) {
+            stat_batches->addData(1);
+        }
+    }
+
+    unsigned    m_batchCap;
+    unsigned    m_marked;
+    std::vector<std::list<Transaction*> > m_queued;    // Queued transactions per bank in arrival order
+
+    Statistic<uint64_t>* stat_batches;
+};
+
+}
+}
+}
+
+#endif
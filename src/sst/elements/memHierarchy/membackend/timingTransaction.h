@@ -13,6 +13,8 @@
 #ifndef _H_SST_MEMH_TIMING_TRANSACTION
 #define _H_SST_MEMH_TIMING_TRANSACTION
 
+#include <list>
+
 #include <sst/core/subcomponent.h>
 
 namespace SST {
@@ -24,7 +26,7 @@ typedef uint64_t ReqId;
 struct Transaction {
     Transaction( SimTime_t _createTime, ReqId id, Addr addr, bool isWrite, unsigned numBytes, unsigned _bank, unsigned _row) :
         createTime(_createTime), id(id), addr(addr), isWrite(isWrite), numBytes(numBytes),
-	bank(_bank), row(_row), retired(false)
+	bank(_bank), row(_row), retired(false), activated(false), marked(false)
     {}
 
     void setRetired() { retired = true; }
@@ -38,6 +40,9 @@ struct Transaction {
     unsigned bank;
     unsigned row;
     bool retired;
+    bool activated; // The bank had to activate the row for this transaction
+    bool marked;    // Used by batching channel schedulers
+    std::list<Transaction*>::iterator batchPos; // Position in a batching scheduler's bank list
 };
 
 class TransactionQ : public SST::SubComponent {
@@ -21,17 +21,95 @@
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-MSHR::MSHR(Output* debug, int maxSize, string cacheName, std::set<Addr> debugAddr) {
+MSHR::MSHR(Output* debug, int maxSize, string cacheName, std::set<Addr> debugAddr, bool flat) {
     d_ = debug;
     maxSize_ = maxSize;
     size_ = 0;
     prefetchCount_ = 0;
     ownerName_ = cacheName;
+    flat_ = flat;
+    statFlatRegisters_ = nullptr;
+    statFlatSlabOverflow_ = nullptr;
 
     d2_ = new Output();
     d2_->init("", 10, 0, (Output::output_location_t)1);
 
     DEBUG_ADDR = debugAddr;
+
+    // Slab holds one register per event entry; an unbounded MSHR (-1) starts with a modest slab and grows
+    if (flat_)
+        flatMshr_.init(maxSize_ > 0 ? maxSize_ : 64);
+}
+
+MSHR::~MSHR() {
+    for (std::vector<std::list<Addr>*>::iterator it = evictPointerPool_.begin(); it != evictPointerPool_.end(); it++)
+        delete *it;
+    delete d2_;
+}
+
+/**************************************************************************
+ * Register storage
+ **************************************************************************/
+
+MSHRRegister* MSHR::findRegister(Addr addr) {
+    if (flat_)
+        return flatMshr_.find(addr);
+    MSHRBlock::iterator it = mshr_.find(addr);
+    return (it == mshr_.end()) ? nullptr : &(it->second);
+}
+
+MSHRRegister* MSHR::insertRegister(Addr addr) {
+    if (flat_) {
+        size_t slabs = flatMshr_.slabCount();
+        MSHRRegister* reg = flatMshr_.insert(addr);
+        if (statFlatRegisters_)
+            statFlatRegisters_->addData(flatMshr_.size());
+        if (statFlatSlabOverflow_ && flatMshr_.slabCount() != slabs)
+            statFlatSlabOverflow_->addData(1);
+        return reg;
+    }
+    return &(mshr_.insert(std::make_pair(addr, MSHRRegister())).first->second);
+}
+
+void MSHR::eraseRegister(Addr addr) {
+    if (flat_)
+        flatMshr_.erase(addr);
+    else
+        mshr_.erase(addr);
+}
+
+void MSHR::getRegisters(std::vector<std::pair<Addr, MSHRRegister*> >& regs) {
+    if (flat_) {
+        for (size_t i = 0; i < flatMshr_.capacity(); i++) {
+            if (flatMshr_.slotRegister(i))
+                regs.push_back(std::make_pair(flatMshr_.slotAddr(i), flatMshr_.slotRegister(i)));
+        }
+        std::sort(regs.begin(), regs.end()); // Match map ordering for status output
+    } else {
+        for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++)
+            regs.push_back(std::make_pair(it->first, &(it->second)));
+    }
+}
+
+void MSHR::setFlatStatistics(Statistic<uint64_t>* registers, Statistic<uint64_t>* slabOverflow) {
+    statFlatRegisters_ = registers;
+    statFlatSlabOverflow_ = slabOverflow;
+}
+
+std::list<Addr>* MSHR::allocateEvictPointers() {
+    if (evictPointerPool_.empty())
+        return new std::list<Addr>;
+    std::list<Addr>* ptrs = evictPointerPool_.back();
+    evictPointerPool_.pop_back();
+    return ptrs;
+}
+
+/* Called when an entry is permanently removed from the MSHR */
+void MSHR::releaseEntry(MSHREntry& entry) {
+    if (entry.getType() == MSHREntryType::Evict && entry.getPointers()) {
+        entry.getPointers()->clear();
+        evictPointerPool_.push_back(entry.getPointers());
+    }
 }
 
 int MSHR::getMaxSize() {
@@ -43,50 +121,50 @@ int MSHR::getSize() {
 }
 
 unsigned int MSHR::getSize(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
     else
-        return mshr_.find(addr)->second.entries.size();
+        return reg->entries.size();
 }
 
 bool MSHR::exists(Addr addr) {
-    return mshr_.find(addr) != mshr_.end();
+    return findRegister(addr) != nullptr;
 }
 
 MSHREntry MSHR::getEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, mshr_.find(addr)->second.entries.size());
+    if (reg->entries.size() <= index) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, reg->entries.size());
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    return *it;
+    return reg->entries[index];
 }
 
 MSHREntry MSHR::getFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
 
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front();
+    return reg->entries.front();
 }
 
 void MSHR::removeEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
-    std::advance(entry, index);
+    std::vector<MSHREntry>::iterator entry = reg->entries.begin() + index;
 
     if (entry->getType() == MSHREntryType::Event)
         size_--;
@@ -94,6 +172,7 @@ void MSHR::removeEntry(Addr addr, size_t index) {
     if (is_debug_addr(addr))
         printDebug(10, "Remove", addr, (*entry).getString().c_str());
 
+    releaseEntry(*entry);
     reg->entries.erase(entry);
     if (reg->entries.empty()) {
         if (is_debug_addr(addr))
@@ -101,15 +180,15 @@ void MSHR::removeEntry(Addr addr, size_t index) {
             //d_->debug(_L10_, "M: %-41" PRIu64 " %-20s Erase        0x%-16" PRIx64 " %-10d\n",
             //        Simulation::getSimulation()->getCurrentSimCycle(), ownerName_.c_str(), addr, size_);
             //d_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 void MSHR::removeFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
@@ -117,59 +196,59 @@ void MSHR::removeFront(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::removeFront(0x%" PRIx64 ", %s)\n", addr, reg->entries.front().getString().c_str());
 
-    if (getFrontType(addr) == MSHREntryType::Event)
+    if (reg->entries.front().getType() == MSHREntryType::Event)
         size_--;
 
     if (is_debug_addr(addr))
         printDebug(10, "RemFr", addr, (reg->entries.front()).getString().c_str());
 
-    reg->entries.pop_front();
+    releaseEntry(reg->entries.front());
+    reg->entries.erase(reg->entries.begin());
     if (reg->entries.empty()) {
         if (is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
             //d_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 MSHREntryType MSHR::getEntryType(Addr addr, size_t index) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getEntryType(0x%" PRIx64 ", %zu)\n", addr, index);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
+    if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Entry list is shoerter than index.\n", ownerName_.c_str(), addr, index);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    return it->getType();
+    return reg->entries[index].getType();
 }
 
 MSHREntryType MSHR::getFrontType(Addr addr) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getFrontType(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front().getType();
+    return reg->entries.front().getType();
 }
 
 MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getEntryEvent(0x%" PRIx64 ", %zu)\n", addr, index);
 
-    if (mshr_.find(addr) == mshr_.end() || mshr_.find(addr)->second.entries.size() <= index)
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.size() <= index)
         return nullptr;
 
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    if (it->getType() != MSHREntryType::Event)
+    if (reg->entries[index].getType() != MSHREntryType::Event)
         return nullptr;
-    return it->getEvent();
+    return reg->entries[index].getEvent();
 }
 
 
@@ -179,17 +258,18 @@ MemEventBase* MSHR::getFrontEvent(Addr addr) {
     if (getFrontType(addr) != MSHREntryType::Event) {
         return nullptr;
     }
-    return mshr_.find(addr)->second.entries.front().getEvent();
+    return findRegister(addr)->entries.front().getEvent();
 }
 
 MemEventBase* MSHR::getFirstEventEntry(Addr addr, Command cmd) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getFirstEventEntry(0x%" PRIx64 ", %s)\n", addr, CommandString[(int)cmd]);
 
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr)
         return nullptr;
 
-    for (std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin(); it != mshr_.find(addr)->second.entries.end(); it++) {
+    for (std::vector<MSHREntry>::iterator it = reg->entries.begin(); it != reg->entries.end(); it++) {
         if (it->getType() == MSHREntryType::Event && it->getEvent()->getCmd() == cmd)
             return it->getEvent();
     }
@@ -200,7 +280,7 @@ std::list<Addr>* MSHR::getEvictPointers(Addr addr) {
     if (getFrontType(addr) != MSHREntryType::Evict)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEvictPointers(0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr);
 
-    return mshr_.find(addr)->second.entries.front().getPointers();
+    return findRegister(addr)->entries.front().getPointers();
 }
 
 // Return whether we should retry a new event or not
@@ -214,21 +294,21 @@ bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
         printDebug(10, "RemPtr", addr, reason.str());
     }
 
+    MSHRRegister * reg = findRegister(addr);
+
     // Sometimes we insert a WB before the Evict & then remove the Evict pointer, othertimes the Evict is front
-    if (getFrontType(addr) == MSHREntryType::Evict) {
-        MSHREntry * entry = &(mshr_.find(addr)->second.entries.front());
+    if (reg->entries.front().getType() == MSHREntryType::Evict) {
+        MSHREntry * entry = &(reg->entries.front());
         entry->getPointers()->remove(addrPtr);
         if (entry->getPointers()->empty()) {
             removeFront(addr);
             return true;
         }
     } else {
-        std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-        it++;
-        if (it->getType() != MSHREntryType::Evict)
+        if (reg->entries.size() < 2 || reg->entries[1].getType() != MSHREntryType::Evict)
             d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr, addrPtr);
-        it->getPointers()->remove(addrPtr);
-        if (it->getPointers()->empty()) {
+        reg->entries[1].getPointers()->remove(addrPtr);
+        if (reg->entries[1].getPointers()->empty()) {
             removeEntry(addr, 1);
         }
     }
@@ -241,7 +321,7 @@ bool MSHR::pendingWriteback(Addr addr) {
 
 bool MSHR::pendingWritebackIsDowngrade(Addr addr) {
     if (pendingWriteback(addr))
-        return mshr_.find(addr)->second.entries.front().getDowngrade();
+        return findRegister(addr)->entries.front().getDowngrade();
     return false;
 }
 
@@ -258,11 +338,11 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
     // Success
     size_++;
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(event, stallEvict));
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
+        reg->entries.push_back(MSHREntry(event, stallEvict));
 
-        mshr_.insert(std::make_pair(addr, reg));
         if (is_debug_addr(addr)) {
             stringstream reason;
             reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=0";
@@ -272,18 +352,16 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
 
         return 0;
     } else {
-        if (pos == -1 || pos > mshr_.find(addr)->second.entries.size()) {
-            mshr_.find(addr)->second.entries.push_back(MSHREntry(event, stallEvict));
+        if (pos == -1 || pos > reg->entries.size()) {
+            reg->entries.push_back(MSHREntry(event, stallEvict));
             if (is_debug_addr(addr)) {
                 stringstream reason;
-                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries.size() - 1);
+                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->entries.size() - 1);
                 printDebug(10, "InsEv", addr, reason.str());
             }
-            return (mshr_.find(addr)->second.entries.size() - 1);
+            return (reg->entries.size() - 1);
         } else {
-            std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-            std::advance(it, pos);
-            mshr_.find(addr)->second.entries.insert(it, MSHREntry(event, stallEvict));
+            reg->entries.insert(reg->entries.begin() + pos, MSHREntry(event, stallEvict));
             if (is_debug_addr(addr)) {
                 stringstream reason;
                 reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << pos;
@@ -298,30 +376,26 @@ MemEventBase* MSHR::swapFrontEvent(Addr addr, MemEventBase* event) {
     if (is_debug_addr(addr))
         printDebug(10, "SwpEv", addr, "");
 
-    if (mshr_.find(addr)->second.entries.empty())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty())
         return nullptr;
 
-    return  mshr_.find(addr)->second.entries.front().swapEvent(event);
+    return reg->entries.front().swapEvent(event);
 }
 
 void MSHR::moveEntryToFront(Addr addr, unsigned int index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
-    std::advance(entry, index);
-
-    MSHREntry tmpEntry = *entry;
-
     if (is_debug_addr(addr))
-        printDebug(10, "MvEnt", addr, entry->getString());
-    reg->entries.erase(entry);
-    reg->entries.push_front(tmpEntry);
+        printDebug(10, "MvEnt", addr, reg->entries[index].getString());
+
+    std::rotate(reg->entries.begin(), reg->entries.begin() + index, reg->entries.begin() + index + 1);
 }
 
 bool MSHR::insertWriteback(Addr addr, bool downgrade) {
@@ -334,12 +408,12 @@ bool MSHR::insertWriteback(Addr addr, bool downgrade) {
         printDebug(10, "InsWB", addr, reason.str());
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(downgrade));
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
+        reg->entries.push_back(MSHREntry(downgrade));
     } else {
-        mshr_.find(addr)->second.entries.push_front(MSHREntry(downgrade));
+        reg->entries.insert(reg->entries.begin(), MSHREntry(downgrade));
     }
 
     return true;
@@ -356,16 +430,16 @@ bool MSHR::insertEviction(Addr oldAddr, Addr newAddr) {
         printDebug(10, "InsPtr", oldAddr, reason.str());
     }
 
-    if (mshr_.find(oldAddr) == mshr_.end()) {  // No MSHR entry for oldAddr
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(newAddr));
-        mshr_.insert(std::make_pair(oldAddr, reg));
+    MSHRRegister * reg = findRegister(oldAddr);
+    if (reg == nullptr) {  // No MSHR entry for oldAddr
+        reg = insertRegister(oldAddr);
+        reg->entries.push_back(MSHREntry(newAddr, allocateEvictPointers()));
     } else {
-        list<MSHREntry>* entries = &(mshr_.find(oldAddr)->second.entries);
+        vector<MSHREntry>* entries = &(reg->entries);
         if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
             entries->back().getPointers()->push_back(newAddr);
         } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
-            entries->push_back(MSHREntry(newAddr));
+            entries->push_back(MSHREntry(newAddr, allocateEvictPointers()));
         }
     }
     return true;
@@ -375,27 +449,30 @@ void MSHR::addPendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "IncRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::addPendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.addPendingRetry();
+    reg->addPendingRetry();
 }
 
 void MSHR::removePendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "DecRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removePendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.removePendingRetry();
+    reg->removePendingRetry();
 }
 
 uint32_t MSHR::getPendingRetries(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
 
-    return mshr_.find(addr)->second.getPendingRetries();
+    return reg->getPendingRetries();
 }
 
 
@@ -405,23 +482,22 @@ void MSHR::setInProgress(Addr addr, bool value) {
     if (is_debug_addr(addr))
         printDebug(20, "InProg", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setInProgress(value);
+    reg->entries.front().setInProgress(value);
 }
 
 bool MSHR::getInProgress(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
-        return false;
-    }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty()) {
         return false;
     }
-    return mshr_.find(addr)->second.entries.front().getInProgress();
+    return reg->entries.front().getInProgress();
 }
 
 void MSHR::setStalledForEvict(Addr addr, bool set) {
@@ -432,56 +508,58 @@ void MSHR::setStalledForEvict(Addr addr, bool set) {
             printDebug(20, "Unstall", addr, "");
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setStalledForEvict(set);
+    reg->entries.front().setStalledForEvict(set);
 }
 
 bool MSHR::getStalledForEvict(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty()) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
-        return false;
-    }
-    return mshr_.find(addr)->second.entries.front().getStalledForEvict();
+    return reg->entries.front().getStalledForEvict();
 }
 
 void MSHR::setProfiled(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setProfiled();
+    reg->entries.front().setProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getProfiled(0x%" PRIx64 "\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front().getProfiled();
+    return reg->entries.front().getProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr, SST::Event::id_type id) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
-    if (mshr_.find(addr)->second.entries.empty())
+    if (reg->entries.empty())
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (vector<MSHREntry>::iterator jt = reg->entries.begin(); jt != reg->entries.end(); jt++) {
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             return jt->getProfiled();
         }
@@ -493,13 +571,14 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (vector<MSHREntry>::iterator jt = reg->entries.begin(); jt != reg->entries.end(); jt++) {
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             jt->setProfiled();
             return;
@@ -512,8 +591,11 @@ MSHREntry* MSHR::getOldestEntry() {
     MSHREntry* entry = nullptr;
     uint64_t time;
 
-    for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++) {
-        for (list<MSHREntry>::iterator jt = it->second.entries.begin(); jt != it->second.entries.end(); jt++) {
+    std::vector<std::pair<Addr, MSHRRegister*> > regs;
+    getRegisters(regs);
+
+    for (std::vector<std::pair<Addr, MSHRRegister*> >::iterator it = regs.begin(); it != regs.end(); it++) {
+        for (vector<MSHREntry>::iterator jt = it->second->entries.begin(); jt != it->second->entries.end(); jt++) {
             if (jt->getType() == MSHREntryType::Event) {
                 if (!first) {
                     entry = &(*jt);
@@ -531,15 +613,15 @@ MSHREntry* MSHR::getOldestEntry() {
 void MSHR::incrementAcksNeeded(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::incrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
     }
-    mshr_.find(addr)->second.acksNeeded++;
+    reg->acksNeeded++;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "IncAck", addr, reason.str());
     }
 }
@@ -548,44 +630,47 @@ void MSHR::incrementAcksNeeded(Addr addr) {
 bool MSHR::decrementAcksNeeded(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::decrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.acksNeeded == 0) {
+    if (reg->acksNeeded == 0) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). AcksNeeded is already 0.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.acksNeeded--;
+    reg->acksNeeded--;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "DecAck", addr, reason.str());
     }
 
-    return (mshr_.find(addr)->second.acksNeeded == 0);
+    return (reg->acksNeeded == 0);
 }
 
 uint32_t MSHR::getAcksNeeded(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         return 0;
     }
-    return (mshr_.find(addr)->second.acksNeeded);
+    return reg->acksNeeded;
 }
 
 void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
 
     if (is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
-    mshr_.find(addr)->second.dataBuffer = data;
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataBuffer = data;
+    reg->dataDirty = dirty;
 }
 
 void MSHR::clearData(Addr addr) {
@@ -594,32 +679,36 @@ void MSHR::clearData(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(10, "ClrData", addr, "");
 
-    mshr_.find(addr)->second.dataBuffer.clear();
-    mshr_.find(addr)->second.dataDirty = false;
+    MSHRRegister * reg = findRegister(addr);
+    reg->dataBuffer.clear();
+    reg->dataDirty = false;
 }
 
 vector<uint8_t>& MSHR::getData(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataBuffer;
+    return reg->dataBuffer;
 }
 
 bool MSHR::hasData(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr)
         return false;
-    return !(mshr_.find(addr)->second.dataBuffer.empty());
+    return !(reg->dataBuffer.empty());
 }
 
 bool MSHR::getDataDirty(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getDataDirty(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataDirty;
+    return reg->dataDirty;
 }
 
 void MSHR::setDataDirty(Addr addr, bool dirty) {
@@ -629,10 +718,11 @@ void MSHR::setDataDirty(Addr addr, bool dirty) {
     if (is_debug_addr(addr))
         printDebug(20, "SetDirt", addr, (dirty ? "Dirty" : "Clean"));
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataDirty = dirty;
 
 }
 
@@ -658,9 +748,11 @@ void MSHR::printDebug(uint32_t lev, std::string action, Addr addr, std::string r
 // Print status. Called by cache controller on EmergencyShutdown and printStatus()
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\b", ownerName_.c_str(), size_, prefetchCount_);
-    for (std::map<Addr,MSHRRegister>::iterator it = mshr_.begin(); it != mshr_.end(); it++) {   // Iterate over addresses
+    std::vector<std::pair<Addr, MSHRRegister*> > regs;
+    getRegisters(regs);
+    for (std::vector<std::pair<Addr, MSHRRegister*> >::iterator it = regs.begin(); it != regs.end(); it++) {   // Iterate over addresses
         out.output("      Entry: Addr = 0x%" PRIx64 "\n", (it->first));
-        for (std::list<MSHREntry>::iterator it2 = it->second.entries.begin(); it2 != it->second.entries.end(); it2++) { // Iterate over entries for each address
+        for (std::vector<MSHREntry>::iterator it2 = it->second->entries.begin(); it2 != it->second->entries.end(); it2++) { // Iterate over entries for each address
             out.output("        %s\n", it2->getString().c_str());
         }
     }
@@ -17,6 +17,8 @@
 #define _MSHR_H_
 
 #include <map>
+#include <list>
+#include <vector>
 #include <string>
 #include <sstream>
 
@@ -84,6 +86,20 @@ class MSHREntry {
             downgrade = false;
         }
 
+        // Evict entry using a recycled pointer list owned by the MSHR
+        MSHREntry(Addr addr, std::list<Addr>* ptrs) {
+            type = MSHREntryType::Evict;
+            event = nullptr;
+            evictPtrs = ptrs;
+            evictPtrs->push_back(addr);
+            time = Simulation::getSimulation()->getCurrentSimCycle();
+            inProgress = false;
+            needEvict = false;
+            profiled = false;
+            event = nullptr;
+            downgrade = false;
+        }
+
         MSHREntry(const MSHREntry& entry) {
             type = entry.type;
             evictPtrs = entry.evictPtrs;
@@ -165,7 +181,7 @@ class MSHREntry {
 
 struct MSHRRegister {
     MSHRRegister() : acksNeeded(0), dataDirty(false), pendingRetries(0) { }
-    list<MSHREntry> entries;
+    vector<MSHREntry> entries;  // Usually 1-3 entries, vector keeps them contiguous and retains capacity when pooled
     uint32_t acksNeeded;
     vector<uint8_t> dataBuffer;
     bool dataDirty;
@@ -174,10 +190,144 @@ struct MSHRRegister {
     uint32_t getPendingRetries() { return pendingRetries; }
     void addPendingRetry() { pendingRetries++; }
     void removePendingRetry() { pendingRetries--; }
+
+    /* Return register to its initial state without releasing buffer capacity */
+    void reset() {
+        entries.clear();
+        acksNeeded = 0;
+        dataBuffer.clear();
+        dataDirty = false;
+        pendingRetries = 0;
+    }
 };
 
 typedef map<Addr, MSHRRegister> MSHRBlock;
 
+/*
+ * Open-addressed (linear probing) address -> register table
+ * Registers are allocated from fixed-capacity slabs and recycled through a free list
+ * so that steady-state operation does not allocate. The table is sized so that the
+ * load factor stays below 1/2; it only grows if the number of live registers exceeds
+ * the slab capacity (e.g., many writebacks/evictions in addition to full event entries).
+ */
+class MSHRFlatTable {
+public:
+    MSHRFlatTable() : slabSize_(0), mask_(0), count_(0) { }
+    ~MSHRFlatTable() {
+        for (std::vector<MSHRRegister*>::iterator it = slabs_.begin(); it != slabs_.end(); it++)
+            delete [] *it;
+    }
+
+    void init(size_t slabSize) {
+        slabSize_ = slabSize;
+        size_t cap = 16;
+        while (cap < 2 * slabSize_) cap <<= 1;
+        slots_.assign(cap, Slot());
+        mask_ = cap - 1;
+        addSlab();
+    }
+
+    MSHRRegister* find(Addr addr) {
+        size_t i = hash(addr);
+        while (slots_[i].reg) {
+            if (slots_[i].addr == addr)
+                return slots_[i].reg;
+            i = (i + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    /* Insert a new register for 'addr'. Caller must ensure addr is not present. */
+    MSHRRegister* insert(Addr addr) {
+        if (2 * (count_ + 1) > slots_.size())
+            rehash(slots_.size() << 1);
+        if (freeRegs_.empty())
+            addSlab();
+        MSHRRegister* reg = freeRegs_.back();
+        freeRegs_.pop_back();
+
+        size_t i = hash(addr);
+        while (slots_[i].reg)
+            i = (i + 1) & mask_;
+        slots_[i].addr = addr;
+        slots_[i].reg = reg;
+        count_++;
+        return reg;
+    }
+
+    void erase(Addr addr) {
+        size_t i = hash(addr);
+        while (slots_[i].reg && slots_[i].addr != addr)
+            i = (i + 1) & mask_;
+        if (!slots_[i].reg) return;
+
+        slots_[i].reg->reset();
+        freeRegs_.push_back(slots_[i].reg);
+        slots_[i].reg = nullptr;
+        count_--;
+
+        // Backward-shift deletion keeps probe sequences intact without tombstones
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask_;
+            if (!slots_[j].reg) break;
+            size_t home = hash(slots_[j].addr);
+            // Move slot j into hole i if its home position is not cyclically within (i, j]
+            if ((j > i && (home <= i || home > j)) || (j < i && (home <= i && home > j))) {
+                slots_[i] = slots_[j];
+                slots_[j].reg = nullptr;
+                i = j;
+            }
+        }
+    }
+
+    size_t size() { return count_; }
+    size_t capacity() { return slots_.size(); }
+    size_t slabCount() { return slabs_.size(); }
+    Addr slotAddr(size_t i) { return slots_[i].addr; }
+    MSHRRegister* slotRegister(size_t i) { return slots_[i].reg; }
+
+private:
+    struct Slot {
+        Slot() : addr(0), reg(nullptr) { }
+        Addr addr;
+        MSHRRegister* reg;
+    };
+
+    size_t hash(Addr addr) {
+        // Line addresses have low-order zeros; fold with a multiplicative hash
+        return (size_t)((addr * 0x9E3779B97F4A7C15ULL) >> 17) & mask_;
+    }
+
+    void addSlab() {
+        MSHRRegister* slab = new MSHRRegister[slabSize_];
+        slabs_.push_back(slab);
+        for (size_t i = slabSize_; i > 0; i--)
+            freeRegs_.push_back(&slab[i-1]);
+    }
+
+    void rehash(size_t cap) {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.assign(cap, Slot());
+        mask_ = cap - 1;
+        for (std::vector<Slot>::iterator it = old.begin(); it != old.end(); it++) {
+            if (!it->reg) continue;
+            size_t i = hash(it->addr);
+            while (slots_[i].reg)
+                i = (i + 1) & mask_;
+            slots_[i] = *it;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<MSHRRegister*> slabs_;
+    std::vector<MSHRRegister*> freeRegs_;
+    size_t slabSize_;
+    size_t mask_;
+    size_t count_;
+};
+
 /**
  *  Implements an MSHR with entries of type mshrEntry
  */
@@ -185,7 +335,9 @@ class MSHR {
 public:
 
     // used externally
-    MSHR(Output* dbg, int maxSize, string cacheName, std::set<Addr> debugAddr);
+    // If flat is true, registers are kept in a pooled open-addressed table (MSHRFlatTable) instead of a std::map
+    MSHR(Output* dbg, int maxSize, string cacheName, std::set<Addr> debugAddr, bool flat = false);
+    ~MSHR();
 
     int getMaxSize();
     int getSize();
@@ -253,11 +405,29 @@ public:
 
     void printStatus(Output &out);
 
+    /* Flat MSHR only: record live register count on each allocation and extra slab allocations */
+    void setFlatStatistics(Statistic<uint64_t>* registers, Statistic<uint64_t>* slabOverflow);
+
 private:
 
     void printDebug(uint32_t level, std::string action, Addr addr, std::string reason);
 
+    /* Register storage, dispatches to either mshr_ or flatMshr_ */
+    MSHRRegister* findRegister(Addr addr);
+    MSHRRegister* insertRegister(Addr addr);
+    void eraseRegister(Addr addr);
+    void getRegisters(std::vector<std::pair<Addr, MSHRRegister*> >& regs);
+
+    /* Evict pointer lists are recycled instead of allocated per eviction */
+    std::list<Addr>* allocateEvictPointers();
+    void releaseEntry(MSHREntry& entry);
+
     MSHRBlock mshr_;
+    MSHRFlatTable flatMshr_;
+    bool flat_;
+    Statistic<uint64_t>* statFlatRegisters_;
+    Statistic<uint64_t>* statFlatSlabOverflow_;
+    std::vector<std::list<Addr>*> evictPointerPool_;
     Output* d_;
     Output* d2_;
     int size_;
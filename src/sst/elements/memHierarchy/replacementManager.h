@@ -79,7 +79,11 @@ class ReplacementPolicy : public SubComponent{
 
         // Get replacement candidates
         virtual uint64_t getBestCandidate() = 0;
-        virtual uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) = 0;
+
+        /* Lines in a set are contiguous: way w of the set is line 'setBegin + w'.
+         * rInfo points at the set's 'assoc' ReplacementInfo pointers, which the cache array keeps
+         * in one flat array so that finding a candidate requires no lookup or allocation. */
+        virtual uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) = 0;
 };
 
 /* ------------------------------------------------------------------------------------------
@@ -113,21 +117,21 @@ public:
      * 3. If shared, try to keep
      * 4. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        uint64_t bestTS = array[rInfo[0]->getIndex()];
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        uint64_t bestTS = array[setBegin];
         if (rInfo[0]->getState() == I) {
             return bestCandidate;
         }
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            uint64_t candTS = array[rInfo[i]->getIndex()];
+            uint64_t candTS = array[setBegin + i];
             if (candTS < bestTS) {
                 bestTS = candTS;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -178,28 +182,28 @@ public:
      * 3. If shared, try to keep
      * 4. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        Rank bestRank = {array[setBegin],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
             rInfo[0]->getState() };
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            Rank candRank = {array[rInfo[i]->getIndex()],
+            Rank candRank = {array[setBegin + i],
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
                 rInfo[i]->getState() };
 
             if (candRank.lessThan(bestRank)) {
                 bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -265,22 +269,22 @@ public:
         timestamp += 1000;
     }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        LFUInfo bestLFU = array[rInfo[0]->getIndex()];
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        LFUInfo bestLFU = array[setBegin];
 
         if (rInfo[0]->getState() == I) { return bestCandidate; }
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I)  {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            LFUInfo candLFU = array[rInfo[i]->getIndex()];
+            LFUInfo candLFU = array[setBegin + i];
 
             if (candLFU.lessThan(bestLFU, timestamp)) {
                 bestLFU = candLFU;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -343,27 +347,27 @@ public:
         timestamp += 1000;
     }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        Rank bestRank = {array[setBegin],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
             rInfo[0]->getState() };
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            Rank candRank = {array[rInfo[i]->getIndex()],
+            Rank candRank = {array[setBegin + i],
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
                 rInfo[i]->getState() };
             if (candRank.lessThan(bestRank, timestamp)) {
                 bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -471,21 +475,21 @@ public:
     //void replaced(uint64_t id) { array[id] = 0; }
     void replaced(uint64_t id) { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()], rInfo[0]->getState() };
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        Rank bestRank = {array[setBegin], rInfo[0]->getState() };
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            Rank candRank = {array[rInfo[i]->getIndex()], rInfo[i]->getState() };
+            Rank candRank = {array[setBegin + i], rInfo[i]->getState() };
             if (candRank.biggerThan(bestRank)) {
                 bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -553,27 +557,27 @@ public:
     //void replaced(uint64_t id) { array[id] = 0; }
     void replaced(uint64_t id) { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        bestCandidate = setBegin;
+        Rank bestRank = {array[setBegin],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
             rInfo[0]->getState() };
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (int i = 1; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
-            Rank candRank = {array[rInfo[i]->getIndex()],
+            Rank candRank = {array[setBegin + i],
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
                 static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
                 rInfo[i]->getState() };
             if (candRank.biggerThan(bestRank)) {
                 bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
             }
         }
         return bestCandidate;
@@ -619,15 +623,15 @@ public:
     void replaced(uint64_t id){}
 
     // Return an empty slot if one exists, otherwise return a random candidate
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
         // Check for empty line
-        for (uint64_t i = 0; i < rInfo.size(); i++) {
+        for (uint64_t i = 0; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
         }
-        bestCandidate = rInfo[(gen->generateNextUInt64() % ways)]->getIndex();
+        bestCandidate = setBegin + (gen->generateNextUInt64() % assoc);
         return bestCandidate;
     }
 
@@ -684,14 +688,13 @@ public:
     void replaced(uint64_t id) { }
 
     // Return an empty slot if one exists, otherwise return any slot that is not the most-recently used in the set
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        for (uint64_t i = 0; i < ways; i++) {
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        for (uint64_t i = 0; i < assoc; i++) {
             if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
+                bestCandidate = setBegin + i;
                 return bestCandidate;
             }
         }
-        uint64_t setBegin = rInfo[0]->getIndex();
         uint64_t index = gen->generateNextUInt64() % (ways-1);
         if (index < array[setBegin/ways])
             bestCandidate = setBegin + index;
@@ -705,6 +708,287 @@ public:
 };
 
 
+
+/* ------------------------------------------------------------------------------------------
+ *  Tree pseudo-LRU (tree-plru)
+ *  - One (ways-1)-bit binary tree per set, packed in a uint64_t
+ *  - Each node bit points toward the half of the subtree to evict from next
+ *  - Requires a power-of-two associativity of at most 64
+ * ------------------------------------------------------------------------------------------*/
+class TreePLRU : public ReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(TreePLRU, "memHierarchy", "replacement.tree-plru", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "tree-based pseudo-least-recently-used replacement policy. Associativity must be a power of two no greater than 64.", SST::MemHierarchy::ReplacementPolicy);
+
+    TreePLRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+        ways = associativity;
+        if (ways == 0 || ways > 64 || (ways & (ways - 1)) != 0) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Error: replacement.tree-plru requires a power-of-two associativity of at most 64. Associativity is %" PRIu64 ".\n",
+                    getName().c_str(), ways);
+        }
+        levels = 0;
+        while ((1ULL << levels) < ways) levels++;
+        tree.resize(lines / ways, 0);
+    }
+
+    virtual ~TreePLRU() {}
+
+    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
+
+    /* Point every node on the path to 'id' away from it */
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t &bits = tree[id / ways];
+        uint64_t way = id % ways;
+        uint64_t node = 0;
+        for (unsigned int level = 0; level < levels; level++) {
+            uint64_t right = (way >> (levels - 1 - level)) & 1;
+            if (right)
+                bits &= ~(1ULL << node);
+            else
+                bits |= (1ULL << node);
+            node = 2 * node + 1 + right;
+        }
+    }
+
+    void replaced(uint64_t id) { }
+
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        for (unsigned int i = 0; i < assoc; i++) {
+            if (rInfo[i]->getState() == I) {
+                bestCandidate = setBegin + i;
+                return bestCandidate;
+            }
+        }
+        uint64_t bits = tree[setBegin / ways];
+        uint64_t node = 0;
+        uint64_t way = 0;
+        for (unsigned int level = 0; level < levels; level++) {
+            uint64_t right = (bits >> node) & 1;
+            way = (way << 1) | right;
+            node = 2 * node + 1 + right;
+        }
+        bestCandidate = setBegin + way;
+        return bestCandidate;
+    }
+
+    uint64_t getBestCandidate() { return bestCandidate; }
+
+private:
+    uint64_t bestCandidate;
+    uint64_t ways;
+    unsigned int levels;
+    std::vector<uint64_t> tree;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Bit pseudo-LRU (bit-plru), a.k.a. MRU-bit
+ *  - One bit per way, packed in a uint64_t per set, set on access
+ *  - When all bits in a set would be set, the others are cleared
+ *  - Evicts the lowest way whose bit is clear
+ *  - Requires an associativity of at most 64
+ * ------------------------------------------------------------------------------------------*/
+class BitPLRU : public ReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(BitPLRU, "memHierarchy", "replacement.bit-plru", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "bit-based pseudo-least-recently-used (MRU-bit) replacement policy. Associativity must be at most 64.", SST::MemHierarchy::ReplacementPolicy);
+
+    BitPLRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+        ways = associativity;
+        if (ways == 0 || ways > 64) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Error: replacement.bit-plru requires an associativity of at most 64. Associativity is %" PRIu64 ".\n",
+                    getName().c_str(), ways);
+        }
+        fullMask = (ways == 64) ? ~0ULL : ((1ULL << ways) - 1);
+        mru.resize(lines / ways, 0);
+    }
+
+    virtual ~BitPLRU() {}
+
+    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
+
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t &bits = mru[id / ways];
+        uint64_t bit = 1ULL << (id % ways);
+        bits |= bit;
+        if (bits == fullMask)
+            bits = bit;
+    }
+
+    void replaced(uint64_t id) { mru[id / ways] &= ~(1ULL << (id % ways)); }
+
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        for (unsigned int i = 0; i < assoc; i++) {
+            if (rInfo[i]->getState() == I) {
+                bestCandidate = setBegin + i;
+                return bestCandidate;
+            }
+        }
+        uint64_t clear = ~mru[setBegin / ways] & fullMask;
+        bestCandidate = setBegin + (clear ? __builtin_ctzll(clear) : 0);
+        return bestCandidate;
+    }
+
+    uint64_t getBestCandidate() { return bestCandidate; }
+
+private:
+    uint64_t bestCandidate;
+    uint64_t ways;
+    uint64_t fullMask;
+    std::vector<uint64_t> mru;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Re-reference interval prediction (SRRIP/BRRIP/DRRIP)
+ *  Jaleel et al., "High Performance Cache Replacement Using Re-Reference Interval Prediction", ISCA 2010
+ *  - Each line has an M-bit re-reference prediction value (RRPV)
+ *  - Hits predict near-immediate re-reference (RRPV = 0)
+ *  - SRRIP inserts with a long interval (max-1), BRRIP mostly inserts with a distant interval (max)
+ *  - Victim is the lowest way with RRPV = max, after aging the set so that one exists
+ *  - DRRIP duels SRRIP and BRRIP leader sets and uses the winner for the remaining sets
+ * ------------------------------------------------------------------------------------------*/
+class SRRIP : public ReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(SRRIP, "memHierarchy", "replacement.srrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "static re-reference interval prediction replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits",   "Number of bits in each line's re-reference prediction value (1-8)", "2"} )
+
+    SRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+        ways = associativity;
+        uint32_t bits = params.find<uint32_t>("rrpv_bits", 2);
+        if (bits == 0 || bits > 8) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: rrpv_bits - must be between 1 and 8. You specified %" PRIu32 ".\n", getName().c_str(), bits);
+        }
+        maxRRPV = (1 << bits) - 1;
+        rrpv.resize(lines, maxRRPV);
+        inserted.resize(lines, true);
+    }
+
+    virtual ~SRRIP() {}
+
+    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
+
+    /* update() follows replaced() when a line is filled after a miss; otherwise it is a hit */
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        if (inserted[id]) {
+            missed(id / ways);
+            rrpv[id] = insertionRRPV(id / ways);
+            inserted[id] = false;
+        } else {
+            rrpv[id] = 0;
+        }
+    }
+
+    void replaced(uint64_t id) {
+        rrpv[id] = maxRRPV;
+        inserted[id] = true;
+    }
+
+    uint64_t findBestCandidate(uint64_t setBegin, ReplacementInfo** rInfo, unsigned int assoc) {
+        uint8_t oldest = 0;
+        bestCandidate = setBegin;
+        for (unsigned int i = 0; i < assoc; i++) {
+            if (rInfo[i]->getState() == I) {
+                bestCandidate = setBegin + i;
+                return bestCandidate;
+            }
+            if (rrpv[setBegin + i] > oldest) {
+                oldest = rrpv[setBegin + i];
+                bestCandidate = setBegin + i;
+            }
+        }
+        // Age the set as if it had been incremented until some line reached maxRRPV
+        uint8_t age = maxRRPV - oldest;
+        if (age) {
+            for (unsigned int i = 0; i < assoc; i++)
+                rrpv[setBegin + i] += age;
+        }
+        return bestCandidate;
+    }
+
+    uint64_t getBestCandidate() { return bestCandidate; }
+
+protected:
+    virtual uint8_t insertionRRPV(uint64_t set) { return maxRRPV - 1; }
+    virtual void missed(uint64_t set) { }   // Called once per fill, not per candidate search
+
+    uint64_t bestCandidate;
+    uint64_t ways;
+    uint8_t maxRRPV;
+    std::vector<uint8_t> rrpv;
+    std::vector<bool> inserted;
+};
+
+class DRRIP : public SRRIP {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(DRRIP, "memHierarchy", "replacement.drrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "dynamic re-reference interval prediction replacement policy, set-duels SRRIP against BRRIP", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits",       "Number of bits in each line's re-reference prediction value (1-8)", "2"},
+            {"leader_sets",     "Number of leader sets dedicated to each of SRRIP and BRRIP", "32"},
+            {"psel_bits",       "Width of the policy selection counter", "10"},
+            {"brrip_long_freq", "BRRIP inserts with a long (rather than distant) interval once every this many fills", "32"} )
+
+    DRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SRRIP(id, params, lines, associativity), fills(0) {
+        uint64_t sets = lines / associativity;
+        uint64_t leaders = params.find<uint64_t>("leader_sets", 32);
+        uint32_t pselBits = params.find<uint32_t>("psel_bits", 10);
+        longFreq = params.find<uint64_t>("brrip_long_freq", 32);
+        if (longFreq == 0) longFreq = 1;
+        if (pselBits == 0 || pselBits > 31) pselBits = 10;
+
+        pselMax = (1 << pselBits) - 1;
+        psel = (pselMax + 1) / 2;
+
+        // Leader sets are spread evenly: the first set of each constituency leads for SRRIP, the second for BRRIP
+        constituency = (leaders == 0 || 2 * leaders > sets) ? 0 : sets / leaders;
+    }
+
+    virtual ~DRRIP() {}
+
+protected:
+    enum class Leader { None, SRRIP, BRRIP };
+
+    Leader leaderType(uint64_t set) {
+        if (constituency == 0) return Leader::None;
+        uint64_t offset = set % constituency;
+        if (offset == 0) return Leader::SRRIP;
+        if (offset == 1) return Leader::BRRIP;
+        return Leader::None;
+    }
+
+    bool useBRRIP(uint64_t set) {
+        Leader leader = leaderType(set);
+        if (leader == Leader::SRRIP) return false;
+        if (leader == Leader::BRRIP) return true;
+        return psel > pselMax / 2; // SRRIP leaders missing more than BRRIP leaders
+    }
+
+    uint8_t insertionRRPV(uint64_t set) {
+        if (!useBRRIP(set))
+            return maxRRPV - 1;
+        fills++;
+        return (fills % longFreq == 0) ? maxRRPV - 1 : maxRRPV;
+    }
+
+    void missed(uint64_t set) {
+        Leader leader = leaderType(set);
+        if (leader == Leader::SRRIP && psel < pselMax) psel++;
+        else if (leader == Leader::BRRIP && psel > 0) psel--;
+    }
+
+    uint64_t constituency;
+    uint64_t longFreq;
+    uint64_t fills;
+    uint32_t psel;
+    uint32_t pselMax;
+};
+
 }}
 
 
@@ -0,0 +1,125 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SHARERENCODING_H
+#define MEMHIERARCHY_SHARERENCODING_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include <sst/core/output.h>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Directory sharer encodings
+ *
+ * Shared caches keep the exact set of sharers for each line. A SharerEncoding
+ * models the sharer field a hardware directory of a given format would keep:
+ * it decides which caches an invalidation of the sharers is sent to and how
+ * many bits the field takes. The field is derived from the exact sharers when
+ * it is needed, so no per-line state is added. Caches that get an
+ * invalidation only because the field cannot rule them out are sent it with
+ * F_IMPRECISE and acknowledge it without changing state.
+ *
+ * - full:    one bit per upper level cache, always exact
+ * - limited: a fixed number of pointers; a line with more sharers than
+ *            pointers is broadcast to every upper level cache
+ * - coarse:  one bit per group of caches; every cache in a group with a
+ *            sharer is invalidated
+ *
+ * Deriving the field from the exact sharers assumes a directory that is told
+ * of every eviction and can clear a pointer overflow or a group bit as soon
+ * as the sharers that set it are gone, so the imprecision is a lower bound.
+ *
+ * Caches are numbered in the order they are first seen, from the init
+ * messages or as sharers. Limited and coarse fields are sized for a
+ * configured number of caches, which must not be exceeded.
+ */
+class SharerEncoding {
+    public:
+        enum class Type { Full, Limited, Coarse };
+
+        SharerEncoding(Type type, unsigned int pointers, unsigned int groupSize, unsigned int endpoints, std::string owner, Output* out) :
+            type_(type), pointers_(pointers), groupSize_(groupSize), endpoints_(endpoints), owner_(owner), out_(out) { }
+
+        Type getType() { return type_; }
+
+        /* Number an upper level cache */
+        unsigned int getIndex(const std::string& name) {
+            std::map<std::string, unsigned int>::iterator it = index_.find(name);
+            if (it != index_.end())
+                return it->second;
+            unsigned int index = index_.size();
+            if (type_ != Type::Full && index >= endpoints_)
+                out_->fatal(CALL_INFO, -1, "%s, Error: sharer_endpoints is %u but %s is upper level cache number %u. Increase sharer_endpoints.\n",
+                        owner_.c_str(), endpoints_, name.c_str(), index + 1);
+            index_.insert(std::make_pair(name, index));
+            names_.push_back(name);
+            return index;
+        }
+
+        /* Caches the field is sized for, configured or, for full, seen so far */
+        unsigned int getNumEndpoints() {
+            return endpoints_ > index_.size() ? endpoints_ : index_.size();
+        }
+
+        /* Caches an invalidation of every cache in 'sharers' is sent to: the sharers and any cache the field cannot rule out */
+        void getTargets(const std::set<std::string>& sharers, std::set<std::string>& targets) {
+            targets = sharers;
+            if (type_ == Type::Limited && sharers.size() > pointers_) {
+                targets.insert(names_.begin(), names_.end());
+            } else if (type_ == Type::Coarse) {
+                for (std::set<std::string>::const_iterator it = sharers.begin(); it != sharers.end(); it++) {
+                    unsigned int first = (getIndex(*it) / groupSize_) * groupSize_;
+                    for (unsigned int i = first; i < first + groupSize_ && i < names_.size(); i++) // Last group may be partly populated
+                        targets.insert(names_[i]);
+                }
+            }
+        }
+
+        /* Size of the sharer field of one line */
+        unsigned int getBitsPerLine() {
+            unsigned int endpoints = getNumEndpoints();
+            switch (type_) {
+                case Type::Limited: {
+                    unsigned int pointerBits = 1;
+                    while ((1u << pointerBits) < endpoints)
+                        pointerBits++;
+                    return pointers_ * pointerBits + 1; // Pointers plus the broadcast bit
+                }
+                case Type::Coarse:
+                    return (endpoints + groupSize_ - 1) / groupSize_;
+                default:
+                    return endpoints;
+            }
+        }
+
+    private:
+        Type type_;
+        unsigned int pointers_;
+        unsigned int groupSize_;
+        unsigned int endpoints_;
+        std::string owner_;
+        Output* out_;
+        std::map<std::string, unsigned int> index_;
+        std::vector<std::string> names_;
+};
+
+}} // End namespace
+#endif // MEMHIERARCHY_SHARERENCODING_H
@@ -0,0 +1,71 @@
+# Microbenchmark for flush handling at the memory controller ('flush_ordering' parameter)
+#
+# trivialCPUs issue writes and flushes over a small footprint through tiny L1s
+# so that most flushes reach memory while the backend convertor has a deep
+# queue of requests to the same lines. The queue depth grows with the number
+# of CPUs and the outstanding requests per CPU. Usage:
+#   sst benchFlushStorm.py -- flush_ordering=sequence outstanding=64 num_loadstore=50000
+# benchFlushStorm.sh runs the queue depth sweep for both orderings and reports
+# requests per wall-clock second.
+import sst
+import sys
+
+params = { "flush_ordering" : "address", "cpus" : "4", "outstanding" : "16", "num_loadstore" : "50000" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    params[key.lstrip("-")] = value
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+for i in range(int(params["cpus"])):
+    cpu = sst.Component("cpu%d"%i, "memHierarchy.trivialCPU")
+    cpu.addParams({
+        "do_write" : "1",
+        "do_flush" : "1",
+        "num_loadstore" : params["num_loadstore"],
+        "commFreq" : "1",
+        "maxOutstanding" : params["outstanding"],
+        "reqsPerIssue" : "4",
+        "memSize" : "0x4000", # 16KiB footprint
+        "rngseed" : str(7 + i),
+        "verbose" : "0",
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1 = sst.Component("l1cache%d"%i, "memHierarchy.Cache")
+    l1.addParams({
+        "access_latency_cycles" : "1",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "2",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "1KiB",
+    })
+
+    link_cpu = sst.Link("link_cpu%d"%i)
+    link_cpu.connect( (iface, "port", "500ps"), (l1, "high_network_0", "500ps") )
+    link_bus = sst.Link("link_bus%d"%i)
+    link_bus.connect( (l1, "low_network_0", "500ps"), (bus, "high_network_%d"%i, "500ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "backendConvertor.flush_ordering" : params["flush_ordering"],
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "100ns",
+    "mem_size" : "512MiB",
+    "max_requests_per_cycle" : 1,
+})
+
+link_mem = sst.Link("link_mem")
+link_mem.connect( (bus, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
@@ -0,0 +1,17 @@
+#!/bin/bash
+# Compare memory controller throughput under a flush storm for the address and
+# sequence flush orderings as the backend convertor queue gets deeper
+# Usage: ./benchFlushStorm.sh [num_loadstore]
+
+NUMLS=${1:-50000}
+CPUS=4
+
+for outstanding in 16 64 256 ; do
+    for ordering in address sequence ; do
+        start=$(date +%s.%N)
+        sst benchFlushStorm.py -- flush_ordering=${ordering} cpus=${CPUS} outstanding=${outstanding} num_loadstore=${NUMLS} > /dev/null 2>&1
+        end=$(date +%s.%N)
+        reqs=$(( NUMLS * CPUS ))
+        echo "outstanding=${outstanding} ${ordering}: ${reqs} requests in $(echo "${end} - ${start}" | bc) s, $(echo "${reqs} / (${end} - ${start})" | bc) requests/s"
+    done
+done
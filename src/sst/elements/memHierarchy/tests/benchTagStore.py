@@ -0,0 +1,62 @@
+# Microbenchmark for the L1 tag store ('tag_store' parameter)
+#
+# A trivialCPU issues random loads/stores over a footprint twice the size of
+# a large L1 so that the cache does a mix of hit and miss lookups. Usage:
+#   sst benchTagStore.py -- assoc=16 tag_store=packed num_loadstore=2000000
+# benchTagStore.sh runs the 8/16/32-way x object/packed sweep and reports
+# lookups per wall-clock second.
+import sst
+import sys
+
+params = { "assoc" : "8", "tag_store" : "object", "num_loadstore" : "1000000", "cache_size" : "1MiB" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    params[key.lstrip("-")] = value
+
+cpu = sst.Component("cpu", "memHierarchy.trivialCPU")
+cpu.addParams({
+      "do_write" : "1",
+      "num_loadstore" : params["num_loadstore"],
+      "commFreq" : "1",
+      "maxOutstanding" : "16",
+      "reqsPerIssue" : "4",
+      "memSize" : "0x200000", # 2MiB footprint
+      "verbose" : "0",
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : params["assoc"],
+    "cache_line_size" : "64",
+    "L1" : "1",
+    "cache_size" : params["cache_size"],
+    "tag_store" : params["tag_store"],
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "10ns",
+    "mem_size" : "512MiB"
+})
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputConsole")
+l1cache.enableStatistics(["TotalEventsReceived"])
+
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (l1cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Compare L1 lookup throughput for the object and packed tag stores
+# Usage: ./benchTagStore.sh [num_loadstore]
+
+NUMLS=${1:-2000000}
+
+for assoc in 8 16 32 ; do
+    for store in object packed ; do
+        start=$(date +%s.%N)
+        events=$(sst benchTagStore.py -- assoc=${assoc} tag_store=${store} num_loadstore=${NUMLS} 2>&1 | \
+            grep "l1cache.TotalEventsReceived" | sed -e 's/.*Sum.u64 = \([0-9]*\).*/\1/')
+        end=$(date +%s.%N)
+        echo "${assoc}-way ${store}: ${events} lookups in $(echo "${end} - ${start}" | bc) s, $(echo "${events} / (${end} - ${start})" | bc) lookups/s"
+    done
+done
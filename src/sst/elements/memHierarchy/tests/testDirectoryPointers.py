@@ -0,0 +1,140 @@
+# Automatically generated SST Python input
+import sst
+import sys
+
+# Define the simulation components
+# 8 cores with private L1/L2s that talk directly to 2 directories, so each
+# directory entry tracks up to 8 sharers. The cores share 4KiB of memory.
+#
+# Directory options are given as key=value arguments, e.g., a limited-pointer
+# directory with 2 pointers per entry:
+#   sst testDirectoryPointers.py -- sharer_tracking=pointer max_sharer_pointers=2
+
+dir_params = {}
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    dir_params[key.lstrip("-")] = value
+
+cores = 8
+memories = 2
+coreclock = "2.4GHz"
+uncoreclock = "1.4GHz"
+coherence = "MESI"
+network_bw = "60GB/s"
+
+# Create merlin network - this is just simple single router
+network = sst.Component("network", "merlin.hr_router")
+network.addParams({
+      "xbar_bw" : network_bw,
+      "link_bw" : network_bw,
+      "input_buf_size" : "2KiB",
+      "num_ports" : cores + memories,
+      "flit_size" : "36B",
+      "output_buf_size" : "2KiB",
+      "id" : "0",
+      "topology" : "merlin.singlerouter"
+})
+network.setSubComponent("topology","merlin.singlerouter")
+
+for x in range(cores):
+    cpu = sst.Component("cpu" + str(x), "memHierarchy.trivialCPU")
+    cpu.addParams({
+        "clock" : coreclock,
+        "commFreq" : 4, # issue request every 4th cycle on average
+        "rngseed" : 301+x,
+        "do_write" : 1,
+        "num_loadstore" : 1500,
+        "memSize" : 1024*4
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 3,
+        "tag_access_latency_cycles" : 1,
+        "mshr_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : coherence,
+        "cache_size" : "1KiB",
+        "associativity" : 2,
+        "L1" : 1,
+    })
+
+    l2cache = sst.Component("l2cache" + str(x), "memHierarchy.Cache")
+    l2cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 9,
+        "tag_access_latency_cycles" : 2,
+        "mshr_latency_cycles" : 4,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : coherence,
+        "cache_size" : "2KiB",
+        "associativity" : 4,
+        "mshr_num_entries" : 8,
+    })
+    l2tol1 = l2cache.setSubComponent("cpulink", "memHierarchy.MemLink")
+    l2nic = l2cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+    l2nic.addParams({
+        "group" : 1,
+        "network_bw" : network_bw,
+        "network_input_buffer_size" : "2KiB",
+        "network_output_buffer_size" : "2KiB",
+    })
+
+    cpu_l1_link = sst.Link("link_cpu_cache_" + str(x))
+    cpu_l1_link.connect ( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+
+    l1_l2_link = sst.Link("link_l1_l2_" + str(x))
+    l1_l2_link.connect( (l1cache, "low_network_0", "100ps"), (l2tol1, "port", "100ps") )
+
+    l2_network_link = sst.Link("link_l2_network_" + str(x))
+    l2_network_link.connect( (l2nic, "port", "100ps"), (network, "port" + str(x), "100ps") )
+
+for x in range(memories):
+    directory = sst.Component("directory" + str(x), "memHierarchy.DirectoryController")
+    directory.addParams({
+        "clock" : uncoreclock,
+        "coherence_protocol" : coherence,
+        "entry_cache_size" : 32768,
+        "mshr_num_entries" : 16,
+        "interleave_size" : "64B",    # Interleave at line granularity between memories
+        "interleave_step" : str(memories * 64) + "B",
+        "addr_range_start" : x*64,
+        "addr_range_end" :  1024*1024*1024 - ((memories - x) * 64) + 63,
+    })
+    directory.addParams(dir_params)
+    dirtoM = directory.setSubComponent("memlink", "memHierarchy.MemLink")
+    dirnic = directory.setSubComponent("cpulink", "memHierarchy.MemNIC")
+    dirnic.addParams({
+        "group" : 2,
+        "network_bw" : network_bw,
+        "network_input_buffer_size" : "2KiB",
+        "network_output_buffer_size" : "2KiB",
+    })
+
+    memctrl = sst.Component("memory" + str(x), "memHierarchy.MemController")
+    memctrl.addParams({
+        "clock" : "500MHz",
+        "backing" : "none",
+    })
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+    memory.addParams({
+        "access_time" : "50ns",
+        "mem_size" : "512MiB",
+    })
+
+    portid = x + cores
+    link_directory_network = sst.Link("link_directory_network_" + str(x))
+    link_directory_network.connect( (dirnic, "port", "100ps"), (network, "port" + str(portid), "100ps") )
+
+    link_directory_memory_network = sst.Link("link_directory_memory_" + str(x))
+    link_directory_memory_network.connect( (dirtoM, "port", "400ps"), (memctrl, "direct_link", "400ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.DirectoryController")
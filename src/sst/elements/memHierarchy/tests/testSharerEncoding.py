@@ -0,0 +1,95 @@
+# Automatically generated SST Python input
+import sst
+import sys
+
+# Define the simulation components
+# 8 cores with private L1s on a bus to a shared inclusive L2, so each L2
+# line tracks up to 8 sharers. The cores share 4KiB of memory.
+#
+# L2 options are given as key=value arguments, e.g., a limited-pointer
+# sharer encoding with 2 pointers per line:
+#   sst testSharerEncoding.py -- sharer_encoding=limited sharer_pointers=2
+
+l2_params = {}
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    l2_params[key.lstrip("-")] = value
+
+cores = 8
+coreclock = "2.4GHz"
+coherence = "MESI"
+
+comp_bus = sst.Component("bus", "memHierarchy.Bus")
+comp_bus.addParams({
+      "bus_frequency" : coreclock,
+})
+
+for x in range(cores):
+    cpu = sst.Component("cpu" + str(x), "memHierarchy.trivialCPU")
+    cpu.addParams({
+        "clock" : coreclock,
+        "commFreq" : 4, # issue request every 4th cycle on average
+        "rngseed" : 301+x,
+        "do_write" : 1,
+        "num_loadstore" : 1500,
+        "memSize" : 1024*4
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 3,
+        "tag_access_latency_cycles" : 1,
+        "mshr_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : coherence,
+        "cache_size" : "1KiB",
+        "associativity" : 2,
+        "L1" : 1,
+    })
+
+    cpu_l1_link = sst.Link("link_cpu_cache_" + str(x))
+    cpu_l1_link.connect ( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+
+    l1_bus_link = sst.Link("link_l1_bus_" + str(x))
+    l1_bus_link.connect( (l1cache, "low_network_0", "100ps"), (comp_bus, "high_network_" + str(x), "100ps") )
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "cache_frequency" : coreclock,
+    "access_latency_cycles" : 9,
+    "tag_access_latency_cycles" : 2,
+    "mshr_latency_cycles" : 4,
+    "replacement_policy" : "lru",
+    "coherence_protocol" : coherence,
+    "cache_size" : "16KiB",
+    "associativity" : 8,
+    "mshr_num_entries" : 16,
+})
+l2cache.addParams(l2_params)
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "512MiB",
+})
+
+link_bus_l2 = sst.Link("link_bus_l2")
+link_bus_l2.connect( (comp_bus, "low_network_0", "100ps"), (l2cache, "high_network_0", "100ps") )
+
+link_l2_memory = sst.Link("link_l2_memory")
+link_l2_memory.connect( (l2cache, "low_network_0", "400ps"), (memctrl, "direct_link", "400ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.Cache")
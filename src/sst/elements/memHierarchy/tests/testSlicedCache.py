@@ -0,0 +1,99 @@
+# Automatically generated SST Python input
+import sst
+
+# Define the simulation components
+# 4 cores with private L1s sharing an L2 that is split into 4 address-interleaved slices
+# Each L1 and the memory connect directly to every slice through a MemLinkMulti, so
+# there is no bus or network component between them and slices may be partitioned
+# onto different ranks/threads
+
+cores = 4
+slices = 4
+coreclock = "2.4GHz"
+uncoreclock = "1.4GHz"
+coherence = "MESI"
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+
+l1links = []
+for x in range(cores):
+    comp_cpu = sst.Component("cpu" + str(x), "memHierarchy.trivialCPU")
+    comp_cpu.addParams({
+        "clock" : coreclock,
+        "commFreq" : 4, # issue request every 4th cycle
+        "rngseed" : 20+x,
+        "do_write" : 1,
+        "num_loadstore" : 1500,
+        "memSize" : 1024*1024*1024
+    })
+    iface = comp_cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 3,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : coherence,
+        "cache_size" : "2KiB",  # super tiny for lots of traffic
+        "associativity" : 2,
+        "L1" : 1,
+        # Debug parameters
+        "debug" : DEBUG_L1,
+        "debug_level" : 10,
+    })
+    l1toC = l1cache.setSubComponent("cpulink", "memHierarchy.MemLink")
+    l1toL2 = l1cache.setSubComponent("memlink", "memHierarchy.MemLinkMulti")
+
+    cpu_l1_link = sst.Link("link_cpu_cache_" + str(x))
+    cpu_l1_link.connect ( (iface, "port", "500ps"), (l1toC, "port", "500ps") )
+    l1links.append(l1toL2)
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : uncoreclock,
+    "backing" : "none",
+    "addr_range_end" : 1024*1024*1024-1,
+    # Debug parameters
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+})
+memtoL2 = memctrl.setSubComponent("cpulink", "memHierarchy.MemLinkMulti")
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "80ns",
+    "mem_size" : "1GiB",
+})
+
+for x in range(slices):
+    l2cache = sst.Component("l2cache" + str(x), "memHierarchy.Cache")
+    l2cache.addParams({
+        "cache_frequency" : uncoreclock,
+        "access_latency_cycles" : 6,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : coherence,
+        "cache_size" : "16KiB",
+        "associativity" : 8,
+        # Distributed cache parameters
+        "num_cache_slices" : slices,
+        "slice_allocation_policy" : "rr", # Round-robin
+        "slice_id" : x,
+        # Debug parameters
+        "debug" : DEBUG_L2,
+        "debug_level" : 10,
+    })
+    l2toL1 = l2cache.setSubComponent("cpulink", "memHierarchy.MemLinkMulti")
+    l2toMem = l2cache.setSubComponent("memlink", "memHierarchy.MemLink")
+
+    for y in range(cores):
+        link = sst.Link("link_l1_" + str(y) + "_l2_" + str(x))
+        link.connect( (l1links[y], "port_" + str(x), "100ps"), (l2toL1, "port_" + str(y), "100ps") )
+
+    link = sst.Link("link_l2_" + str(x) + "_mem")
+    link.connect( (l2toMem, "port", "100ps"), (memtoL2, "port_" + str(x), "100ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForAllComponents()
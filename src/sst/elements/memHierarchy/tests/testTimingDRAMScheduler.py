@@ -0,0 +1,104 @@
+# Automatically generated SST Python input
+# Test the timingDRAM channel scheduler ('channel.scheduler' parameter)
+#
+# Several streamCPUs and trivialCPUs share one memory through small L1s so
+# that the channel sees a mix of row-hit streams and random traffic with a
+# deep transaction queue. Options are given as key=value arguments, e.g.:
+#   sst testTimingDRAMScheduler.py -- scheduler=memHierarchy.frfcfsScheduler queue=64
+# scheduler=none keeps the round-robin issue.
+import sst
+import sys
+from mhlib import componentlist
+
+params = { "scheduler" : "none", "queue" : "64", "num_loadstore" : "2000", "cpus" : "4", "ranks" : "2", "banks" : "16",
+           "write_high_watermark" : "0", "write_low_watermark" : "0", "batch_cap" : "5" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    params[key.lstrip("-")] = value
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+for i in range(int(params["cpus"])):
+    cpuType = "memHierarchy.streamCPU" if i % 2 == 0 else "memHierarchy.trivialCPU"
+    cpu = sst.Component("cpu%d"%i, cpuType)
+    cpu.addParams({
+        "clock" : "3GHz",
+        "commFreq" : "1",
+        "do_write" : "1",
+        "num_loadstore" : params["num_loadstore"],
+        "maxOutstanding" : "16",
+        "reqsPerIssue" : "4",
+        "memSize" : "0x1000000",
+        "rngseed" : str(7 + i),
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1 = sst.Component("l1cache%d"%i, "memHierarchy.Cache")
+    l1.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "3GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "4KiB",
+    })
+
+    link_cpu = sst.Link("link_cpu%d"%i)
+    link_cpu.connect( (iface, "port", "500ps"), (l1, "high_network_0", "500ps") )
+    link_bus = sst.Link("link_bus%d"%i)
+    link_bus.connect( (l1, "low_network_0", "500ps"), (bus, "high_network_%d"%i, "500ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "backing" : "none",
+    "clock" : "1.2GHz",
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+memory.addParams({
+    "id" : 0,
+    "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+    "addrMapper.interleave_size" : "64B",
+    "addrMapper.row_size" : "1KiB",
+    "clock" : "1.2GHz",
+    "mem_size" : "512MiB",
+    "channels" : 1,
+    "channel.numRanks" : params["ranks"],
+    "channel.rank.numBanks" : params["banks"],
+    "channel.transaction_Q_size" : params["queue"],
+    "channel.rank.bank.CL" : 14,
+    "channel.rank.bank.CL_WR" : 12,
+    "channel.rank.bank.RCD" : 14,
+    "channel.rank.bank.TRP" : 14,
+    "channel.rank.bank.dataCycles" : 2,
+    "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+    "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+    "channel.rank.bank.pagePolicy.close" : 0,
+    "printconfig" : 0,
+    "channel.printconfig" : 0,
+    "channel.rank.printconfig" : 0,
+    "channel.rank.bank.printconfig" : 0,
+})
+
+if params["scheduler"] != "none":
+    memory.addParams({
+        "channel.scheduler" : params["scheduler"],
+        "channel.scheduler.write_high_watermark" : params["write_high_watermark"],
+        "channel.scheduler.write_low_watermark" : params["write_low_watermark"],
+        "channel.scheduler.batch_cap" : params["batch_cap"],
+    })
+
+link_mem = sst.Link("link_mem")
+link_mem.connect( (bus, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
@@ -71,6 +71,30 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_BackendVaultSim(self):
         self.memHA_Template("BackendVaultSim", lcwc_match_allowed=True)
 
+    def test_memHA_DirectoryPointers(self):
+        # With 2 sharer pointers per entry and 8 sharing caches, the
+        # directory must invalidate sharers to make room and still finish
+        stats = self.memHA_Directory_Template("DirectoryPointers", "sharer_tracking=pointer max_sharer_pointers=2")
+        self.assertTrue(sum(s["sharer_pointer_evictions"]["Sum"] for s in stats.values()) > 0,
+                        "test_memHA_DirectoryPointers: no sharer pointer was ever reclaimed")
+        # A bitvector directory never needs to
+        stats = self.memHA_Directory_Template("DirectoryBitvector", "sharer_tracking=bitvector")
+        self.assertEqual(sum(s["sharer_pointer_evictions"]["Sum"] for s in stats.values()), 0,
+                         "test_memHA_DirectoryBitvector: sharers were invalidated for pointers")
+
+    def test_memHA_DirectorySparse(self):
+        # 8 entries per directory for the 32 lines each one homes, so
+        # entries must be evicted and their sharers invalidated
+        stats = self.memHA_Directory_Template("DirectorySparse", "directory_entries=8 directory_assoc=4", "directory_entry_")
+        self.assertTrue(sum(s["directory_entry_evictions"]["Sum"] for s in stats.values()) > 0,
+                        "test_memHA_DirectorySparse: no directory entry was evicted")
+        self.assertTrue(sum(s["directory_entry_eviction_invs"]["Sum"] for s in stats.values()) > 0,
+                        "test_memHA_DirectorySparse: evictions did not invalidate any cache")
+        # Without a bound nothing is evicted
+        stats = self.memHA_Directory_Template("DirectoryUnbounded", "directory_entries=0", "directory_entry_")
+        self.assertEqual(sum(s["directory_entry_evictions"]["Sum"] for s in stats.values()), 0,
+                         "test_memHA_DirectoryUnbounded: entries were evicted")
+
     def test_memHA_DistributedCaches(self):
         self.memHA_Template("DistributedCaches", lcwc_match_allowed=True)
 
@@ -86,6 +110,12 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_Incoherent(self):
         self.memHA_Template("Incoherent")
 
+    def test_memHA_MSHRFlat(self):
+        # Same system as Noninclusive_1 with every MSHR flat; apart from the
+        # flat-only statistics the output must match Noninclusive_1
+        self.memHA_Template("MSHRFlat", reftestcase="Noninclusive_1", ignore_out_lines=["MSHR_flat_"])
+        self._check_mshr_flat_stats("test_memHA_MSHRFlat", {"l1cache" : 64, "l2cache" : 4, "l3cache" : 8})
+
     def test_memHA_Noninclusive_1(self):
         self.memHA_Template("Noninclusive_1")
 
@@ -95,6 +125,98 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_PrefetchParams(self):
         self.memHA_Template("PrefetchParams")
 
+    # At 2-way, tree and bit pseudo-LRU pick the same victims as LRU, so the
+    # output must match Noninclusive_1, which uses LRU at the L1
+    def test_memHA_ReplacementTreePLRU(self):
+        self.memHA_Template("ReplacementTreePLRU", sdltestcase="Replacement", reftestcase="Noninclusive_1",
+                            other_args='--model-options="l1_policy=tree-plru"')
+
+    def test_memHA_ReplacementBitPLRU(self):
+        self.memHA_Template("ReplacementBitPLRU", sdltestcase="Replacement", reftestcase="Noninclusive_1",
+                            other_args='--model-options="l1_policy=bit-plru"')
+
+    def test_memHA_ReplacementSRRIP(self):
+        self.memHA_Replacement_Template("ReplacementSRRIP", "l1_policy=srrip")
+
+    def test_memHA_ReplacementDRRIP(self):
+        self.memHA_Replacement_Template("ReplacementDRRIP", "l1_policy=drrip leader_sets=4 psel_bits=4")
+        # Without leader sets DRRIP always follows BRRIP, and BRRIP that
+        # inserts every fill with a long interval is SRRIP
+        self.memHA_Replacement_Template("ReplacementDRRIP_NoLeaders", "l1_policy=drrip leader_sets=0 brrip_long_freq=1",
+                                        match_testcase="ReplacementSRRIP", match_args="l1_policy=srrip")
+
+    def test_memHA_TagStorePacked(self):
+        # Same system as Noninclusive_2 with packed tags in every cache; apart
+        # from the packed-only statistic the output must match Noninclusive_2
+        self.memHA_Template("TagStorePacked", reftestcase="Noninclusive_2", ignore_out_lines=["TagStore_packed_"])
+        self._check_tag_store_packed_stats("test_memHA_TagStorePacked", ["l1cache", "l2cache", "l3cache"])
+
+    def test_memHA_SharerEncoding(self):
+        # 256 L2 lines shared by 8 L1s. Limited and coarse encodings also send
+        # invalidations to caches they cannot rule out; those caches only
+        # acknowledge them, so every run must still finish
+        full = self.memHA_SharerEncoding_Template("SharerEncodingFull", "sharer_encoding=full")
+        self.assertTrue(full["sharer_invalidations"]["Sum"] > 0, "test_memHA_SharerEncodingFull: no sharers were invalidated")
+        self.assertEqual(full["sharer_extra_invalidations"]["Sum"], 0, "test_memHA_SharerEncodingFull: a full bit-vector invalidated non-sharers")
+        self.assertEqual(full["sharer_storage_bits"]["Sum"], 256 * 8, "test_memHA_SharerEncodingFull: wrong sharer storage")
+        self._check_sharer_invalidations_sent("SharerEncodingFull", full)
+
+        # One pointer of 3 bits plus the broadcast bit
+        limited = self.memHA_SharerEncoding_Template("SharerEncodingLimited", "sharer_encoding=limited sharer_pointers=1")
+        self.assertTrue(limited["sharer_extra_invalidations"]["Sum"] > 0, "test_memHA_SharerEncodingLimited: no line overflowed its pointer")
+        self.assertEqual(limited["sharer_storage_bits"]["Sum"], 256 * 4, "test_memHA_SharerEncodingLimited: wrong sharer storage")
+        self._check_sharer_invalidations_sent("SharerEncodingLimited", limited)
+
+        coarse = self.memHA_SharerEncoding_Template("SharerEncodingCoarse", "sharer_encoding=coarse sharer_group_size=4")
+        self.assertTrue(coarse["sharer_extra_invalidations"]["Sum"] > 0, "test_memHA_SharerEncodingCoarse: no group bit covered a non-sharer")
+        self.assertEqual(coarse["sharer_storage_bits"]["Sum"], 256 * 2, "test_memHA_SharerEncodingCoarse: wrong sharer storage")
+        self._check_sharer_invalidations_sent("SharerEncodingCoarse", coarse)
+
+    def _check_sharer_invalidations_sent(self, testcase, sharer_stats):
+        # Every invalidation the encoding asked for, including those to
+        # non-sharers, must have been sent by the L2
+        testDataFileName = "test_memHA_{0}".format(testcase)
+        outfile = "{0}/{1}.out".format(self.get_test_output_run_dir(), testDataFileName)
+        sent = self._read_accumulator_stats(testDataFileName, "eventSent_", outfile).get("l2cache", {})
+        invs = sent["eventSent_Inv"]["Sum"] + sent["eventSent_ForceInv"]["Sum"]
+        asked = sharer_stats["sharer_invalidations"]["Sum"] + sharer_stats["sharer_extra_invalidations"]["Sum"]
+        self.assertTrue(invs >= asked, "{0}: L2 sent {1} invalidations but its sharer encoding needed {2}".format(testDataFileName, invs, asked))
+
+    def test_memHA_EventPool(self):
+        # The L2 records the rank's MemEvent pool counters. Every access
+        # frees its request and response, so later events must reuse them
+        self.memHA_SharerEncoding_Template("EventPool", "report_event_pool=1")
+        outfile = "{0}/test_memHA_EventPool.out".format(self.get_test_output_run_dir())
+        pool = self._read_accumulator_stats("test_memHA_EventPool", "EventPool_", outfile).get("l2cache", {})
+        for stat in ["EventPool_allocations", "EventPool_hits", "EventPool_heap_bytes"]:
+            self.assertTrue(stat in pool, "test_memHA_EventPool: missing statistic {0}".format(stat))
+            self.assertEqual(pool[stat]["Count"], 1, "test_memHA_EventPool: {0} was recorded more than once".format(stat))
+        self.assertTrue(pool["EventPool_hits"]["Sum"] > 0, "test_memHA_EventPool: no event was served from the pool")
+        self.assertTrue(pool["EventPool_hits"]["Sum"] < pool["EventPool_allocations"]["Sum"], "test_memHA_EventPool: more pool hits than allocations")
+
+    def test_memHA_SlicedCache(self):
+        # 4 L1s and the memory connect directly to 4 L2 slices through
+        # MemLinkMultis; every CPU must finish and every slice must serve
+        # its share of the addresses
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/testSlicedCache.py".format(test_path)
+
+        testDataFileName = "test_memHA_SlicedCache"
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, timeout_sec=120, mpi_out_files=mpioutfiles)
+        testing_remove_component_warning_from_file(outfile)
+        self.assertFalse(os_test_file(errfile, "-s"), "memHA test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+        self._check_cpus_completed(testDataFileName, outfile, 4)
+
+        stats = self._read_accumulator_stats(testDataFileName, "CacheMisses", outfile)
+        for x in range(4):
+            name = "l2cache{0}".format(x)
+            self.assertTrue(name in stats, "{0}: missing statistics for {1}".format(testDataFileName, name))
+            self.assertTrue(stats[name]["CacheMisses"]["Sum"] > 0, "{0}: {1} served no misses".format(testDataFileName, name))
+
     def test_memHA_ThroughputThrottling(self):
         self.memHA_Template("ThroughputThrottling")
 
@@ -126,6 +248,18 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_BackendTimingDRAM_4(self):
         self.memHA_Template("BackendTimingDRAM_4")
 
+    def test_memHA_TimingDRAMScheduler(self):
+        for sched in ["frfcfsScheduler", "parbsScheduler"]:
+            # With one rank of one bank the scheduler only ever has one
+            # candidate, so apart from its own statistics the output must
+            # match the round-robin issue path
+            self.memHA_TimingDRAMScheduler_Template("TimingDRAMScheduler_1Bank_" + sched,
+                    "ranks=1 banks=1 scheduler=memHierarchy." + sched, match_args="ranks=1 banks=1 scheduler=none")
+            # With many banks, each with write draining, every transaction
+            # is counted once as a row hit or a row miss
+            self.memHA_TimingDRAMScheduler_Template("TimingDRAMScheduler_" + sched,
+                    "scheduler=memHierarchy." + sched + " write_high_watermark=24 write_low_watermark=8")
+
     @skip_on_sstsimulator_conf_empty_str("DRAMSIM", "LIBDIR", "DRAMSIM is not included as part of this build")
     @skip_on_sstsimulator_conf_empty_str("HBMDRAMSIM", "LIBDIR", "HBMDRAMSIM is not included as part of this build")
     def test_memHA_BackendHBMDramsim(self):
@@ -143,7 +277,7 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 
 #####
 
-    def memHA_Template(self, testcase, lcwc_match_allowed=False, ignore_err_file=False):
+    def memHA_Template(self, testcase, lcwc_match_allowed=False, ignore_err_file=False, reftestcase=None, ignore_out_lines=[], sdltestcase=None, other_args=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -153,16 +287,17 @@ class testcase_memHierarchy_memHA(SSTTestCase):
         self.timeout_sec = 120
 
         # Some tweeking of file names are due to inconsistencys with testcase name
-        testcasename_sdl = testcase.replace("_", "-")
+        testcasename_sdl = (sdltestcase if sdltestcase else testcase).replace("_", "-")
 
         # Set the various file paths
         testDataFileName=("test_memHA_{0}".format(testcase))
+        refDataFileName=("test_memHA_{0}".format(reftestcase if reftestcase else testcase))
         sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, refDataFileName)
         # Now do some checking to see if the _MC or _MR ref files exist
         if testing_check_get_num_threads() > 1:
-            mc_checkfile = "{0}/refFiles/{1}_MC.out".format(test_path, testDataFileName)
-            mr_checkfile = "{0}/refFiles/{1}_MR.out".format(test_path, testDataFileName)
+            mc_checkfile = "{0}/refFiles/{1}_MC.out".format(test_path, refDataFileName)
+            mr_checkfile = "{0}/refFiles/{1}_MR.out".format(test_path, refDataFileName)
             if os.path.exists(mc_checkfile):
                 reffile = mc_checkfile
             elif os.path.exists(mr_checkfile) and testing_check_get_num_ranks() > 1:
@@ -181,7 +316,7 @@ class testcase_memHierarchy_memHA(SSTTestCase):
         log_debug("ref file = {0}".format(reffile))
 
         # Run SST in the tests directory
-        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path,
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=other_args,
                      timeout_sec = self.timeout_sec, mpi_out_files=mpioutfiles)
 
         # Copy the orig reffile to the fixedreffile
@@ -208,6 +343,13 @@ class testcase_memHierarchy_memHA(SSTTestCase):
             self._grep_v_cleanup_file("memory.total_cycles", outfile)
             self._grep_v_cleanup_file("memory.total_cycles", fixedreffile)
 
+        # Lines the reference run does not produce are compared separately;
+        # keep the full output for those checks
+        if ignore_out_lines:
+            os.system("cp {0} {1}.full".format(outfile, outfile))
+        for grep_str in ignore_out_lines:
+            self._grep_v_cleanup_file(grep_str, outfile)
+
         testing_remove_component_warning_from_file(outfile)
 
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
@@ -248,6 +390,197 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 
 ###
 
+    def memHA_Replacement_Template(self, testcase, policy_args, match_testcase=None, match_args=None):
+        # Runs testReplacement.py with the given L1 policy and checks that the
+        # run completed with every load returned. If match_testcase is given,
+        # that configuration is run too and the two outputs must be identical.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+        sdlfile = "{0}/testReplacement.py".format(test_path)
+
+        runs = [(testcase, policy_args)]
+        if match_testcase:
+            runs.append((match_testcase + "_match", match_args))
+
+        outfiles = []
+        for name, args in runs:
+            testDataFileName = "test_memHA_{0}".format(name)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args='--model-options="{0}"'.format(args),
+                         timeout_sec=120, mpi_out_files=mpioutfiles)
+            testing_remove_component_warning_from_file(outfile)
+            self.assertFalse(os_test_file(errfile, "-s"), "memHA test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+            self._check_cpus_completed(testDataFileName, outfile, 8)
+            outfiles.append(outfile)
+
+        if match_testcase:
+            difffile = "{0}/test_memHA_{1}.raw_diff".format(tmpdir, testcase)
+            cmd = "diff -b {0} {1} > {2}".format(outfiles[1], outfiles[0], difffile)
+            self.assertTrue(os.system(cmd) == 0 or testing_compare_sorted_diff(testcase, outfiles[0], outfiles[1]),
+                            "{0} output does not match {1} output".format(testcase, match_testcase))
+
+    def memHA_Directory_Template(self, testcase, dir_args, stat_prefix="sharer_pointer_evictions"):
+        # Runs testDirectoryPointers.py with the given directory options and
+        # checks that every CPU finished with all of its loads returned.
+        # Returns the directories' accumulator statistics matching stat_prefix.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/testDirectoryPointers.py".format(test_path)
+
+        testDataFileName = "test_memHA_{0}".format(testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args='--model-options="{0}"'.format(dir_args),
+                     timeout_sec=120, mpi_out_files=mpioutfiles)
+        testing_remove_component_warning_from_file(outfile)
+        self.assertFalse(os_test_file(errfile, "-s"), "memHA test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+        self._check_cpus_completed(testDataFileName, outfile, 8)
+
+        stats = self._read_accumulator_stats(testDataFileName, stat_prefix, outfile)
+        self.assertEqual(sorted(stats.keys()), ["directory0", "directory1"], "{0}: missing directory statistics".format(testDataFileName))
+        return stats
+
+    def memHA_SharerEncoding_Template(self, testcase, l2_args, match_testcase=None):
+        # Runs testSharerEncoding.py with the given L2 options and checks that
+        # every CPU finished and that the sharer storage was recorded once.
+        # If match_testcase is given, the output must match that run's apart
+        # from the sharer statistics. Returns the L2's sharer statistics.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+        sdlfile = "{0}/testSharerEncoding.py".format(test_path)
+
+        testDataFileName = "test_memHA_{0}".format(testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        self.grep_tmp_file = "{0}/{1}.tmp".format(outdir, testDataFileName)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args='--model-options="sharer_endpoints=8 {0}"'.format(l2_args),
+                     timeout_sec=120, mpi_out_files=mpioutfiles)
+        testing_remove_component_warning_from_file(outfile)
+        self.assertFalse(os_test_file(errfile, "-s"), "memHA test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+        self._check_cpus_completed(testDataFileName, outfile, 8)
+
+        stats = self._read_accumulator_stats(testDataFileName, "sharer_", outfile).get("l2cache", {})
+        self.assertTrue("sharer_storage_bits" in stats, "{0}: missing sharer statistics".format(testDataFileName))
+        self.assertEqual(stats["sharer_storage_bits"]["Count"], 1, "{0}: sharer storage was recorded more than once".format(testDataFileName))
+
+        if match_testcase:
+            matchfile = "{0}/test_memHA_{1}.out".format(outdir, match_testcase)
+            difffile = "{0}/{1}.raw_diff".format(tmpdir, testDataFileName)
+            cmd = "diff -b <(grep -v .sharer_ {0}) <(grep -v .sharer_ {1}) > {2}".format(matchfile, outfile, difffile)
+            self.assertTrue(os.system("bash -c '{0}'".format(cmd)) == 0, "{0} output does not match {1} output".format(testcase, match_testcase))
+        return stats
+
+    def memHA_TimingDRAMScheduler_Template(self, testcase, sched_args, match_args=None):
+        # Runs testTimingDRAMScheduler.py with the given options and checks
+        # that every CPU finished and that the scheduler counted each memory
+        # transaction once. If match_args is given, that configuration is
+        # run too and the outputs must be identical apart from the
+        # scheduler's statistics.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+        sdlfile = "{0}/testTimingDRAMScheduler.py".format(test_path)
+        sched_stats = ["row_hits", "row_misses", "write_drains", "candidates_per_issue", "batches"]
+
+        runs = [(testcase, sched_args)]
+        if match_args:
+            runs.append((testcase + "_match", match_args))
+
+        outfiles = []
+        for name, args in runs:
+            testDataFileName = "test_memHA_{0}".format(name)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            self.grep_tmp_file = "{0}/{1}.tmp".format(outdir, testDataFileName)
+            self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args='--model-options="{0}"'.format(args),
+                         timeout_sec=120, mpi_out_files=mpioutfiles)
+            testing_remove_component_warning_from_file(outfile)
+            self.assertFalse(os_test_file(errfile, "-s"), "memHA test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+            # Half of the CPUs are streamCPUs, which do not print a completion line
+            self._check_cpus_completed(testDataFileName, outfile, 2)
+            outfiles.append(outfile)
+
+        testDataFileName = "test_memHA_{0}".format(testcase)
+        sched = self._read_accumulator_stats(testDataFileName, "row_", outfiles[0]).get("memory", {})
+        requests = self._read_accumulator_stats(testDataFileName, "requests_received_", outfiles[0]).get("memory", {})
+        self.assertTrue("row_hits" in sched and "row_misses" in sched, "{0}: missing scheduler statistics".format(testDataFileName))
+        transactions = sum(stat["Sum"] for stat in requests.values())
+        self.assertTrue(transactions > 0, "{0}: memory received no requests".format(testDataFileName))
+        self.assertEqual(sched["row_hits"]["Sum"] + sched["row_misses"]["Sum"], transactions,
+                "{0}: row hits + row misses does not match the {1} memory requests".format(testDataFileName, transactions))
+
+        if match_args:
+            for grep_str in sched_stats:
+                self._grep_v_cleanup_file("." + grep_str + " ", outfiles[0])
+            difffile = "{0}/test_memHA_{1}.raw_diff".format(tmpdir, testcase)
+            cmd = "diff -b {0} {1} > {2}".format(outfiles[1], outfiles[0], difffile)
+            self.assertTrue(os.system(cmd) == 0 or testing_compare_sorted_diff(testcase, outfiles[0], outfiles[1]),
+                            "{0} output does not match the output with {1}".format(testcase, match_args))
+
+    def _check_cpus_completed(self, testDataFileName, outfile, cpus):
+        # Every trivialCPU must report completion with as many loads returned as issued
+        completed = 0
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                if "Test Completed Successfuly" in line:
+                    completed += 1
+                elif "issued reads" in line:
+                    words = line.split()
+                    issued = words[words.index("after") + 1]
+                    returned = words[words.index("returned") - 1]
+                    self.assertEqual(issued, returned, "{0}: {1}".format(testDataFileName, line.strip()))
+        self.assertEqual(completed, cpus, "{0}: {1} of {2} CPUs completed".format(testDataFileName, completed, cpus))
+
+    def _read_accumulator_stats(self, testDataFileName, stat_prefix, outfile=None):
+        # Returns {component : {statistic : {field : value}}} for the
+        # accumulator statistics starting with stat_prefix in outfile,
+        # by default the full output kept by memHA_Template
+        if outfile is None:
+            outdir = self.get_test_output_run_dir()
+            outfile = "{0}/{1}.out.full".format(outdir, testDataFileName)
+        stats = {}
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                if "." + stat_prefix not in line:
+                    continue
+                name, stat = line.split(":")[0].strip().split(".")
+                fields = dict((f.split("=")[0].strip().split(".")[0], int(f.split("=")[1])) for f in line.split(":")[2].split(";") if "=" in f)
+                stats.setdefault(name, {})[stat] = fields
+        return stats
+
+    def _check_mshr_flat_stats(self, testDataFileName, slab_sizes):
+        # Every flat cache must report its register occupancy, and the peak
+        # number of live registers can only exceed the slab size if extra
+        # slabs were allocated for it
+        stats = self._read_accumulator_stats(testDataFileName, "MSHR_flat_")
+        for prefix, slab in slab_sizes.items():
+            caches = [name for name in stats if name.startswith(prefix)]
+            self.assertTrue(len(caches) > 0, "{0}: no MSHR_flat_ statistics found for {1}*".format(testDataFileName, prefix))
+            for name in caches:
+                self.assertTrue("MSHR_flat_registers" in stats[name] and "MSHR_flat_slab_overflow" in stats[name], "{0}: flat MSHR statistics missing".format(name))
+                registers = stats[name]["MSHR_flat_registers"]
+                overflow = stats[name]["MSHR_flat_slab_overflow"]["Sum"]
+                self.assertTrue(registers["Count"] > 0 and registers["Min"] >= 1, "{0}: flat MSHR never allocated a register ({1})".format(name, registers))
+                self.assertTrue(registers["Max"] <= slab * (1 + overflow),
+                        "{0}: {1} live registers exceeds slab size {2} with {3} overflow slabs".format(name, registers["Max"], slab, overflow))
+
+    def _check_tag_store_packed_stats(self, testDataFileName, prefixes):
+        # Every packed cache must have done its lookups through the packed tag store
+        stats = self._read_accumulator_stats(testDataFileName, "TagStore_packed_")
+        for prefix in prefixes:
+            caches = [name for name in stats if name.startswith(prefix)]
+            self.assertTrue(len(caches) > 0, "{0}: no TagStore_packed_lookups statistic found for {1}*".format(testDataFileName, prefix))
+            for name in caches:
+                lookups = stats[name]["TagStore_packed_lookups"]
+                self.assertTrue(lookups["Count"] > 0, "{0}: no lookups used the packed tag store".format(name))
+
     def _grep_v_cleanup_file(self, grep_str, grep_file, out_file = None, append = False):
         cmd = 'grep -v \"{0}\" {1} > {2}'.format(grep_str, grep_file, self.grep_tmp_file)
         os.system(cmd)
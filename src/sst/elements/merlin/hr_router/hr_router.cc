@@ -21,6 +21,7 @@
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/sharedRegion.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -289,6 +290,21 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     xbar_tc = registerClock( xbar_clock, my_clock_handler);
     num_routers++;
 
+    event_driven = params.find<bool>("event_driven", false);
+    blocked_sleep = false;
+    wakeup_link = NULL;
+#if !VERIFY_DECLOCKING
+    if ( event_driven && arb->isOkayToSkipBlockedCycles() ) {
+        wakeup_link = configureSelfLink("xbar_wakeup", xbar_tc,
+                                        new Event::Handler<hr_router>(this,&hr_router::handle_wakeup));
+    }
+    else {
+        event_driven = false;
+    }
+#else
+    event_driven = false;
+#endif
+
 #if VERIFY_DECLOCKING
     clocking = true;
 #endif
@@ -329,6 +345,20 @@ hr_router::notifyEvent()
 
 
 #if !VERIFY_DECLOCKING
+    if ( blocked_sleep ) {
+        // Ports with data stall in every skipped cycle in which
+        // their input is not busy
+        for ( size_t w = 0; w < blocked_ports.size(); w++ ) {
+            for ( uint64_t bits = blocked_ports[w]; bits != 0; bits &= bits - 1 ) {
+                int port = w * 64 + __builtin_ctzll(bits);
+                int64_t stalls = elapsed_cycles - in_port_busy[port];
+                if ( stalls > 0 ) xbar_stalls[port]->addDataNTimes(stalls,1);
+            }
+        }
+        setRequestNotifyOnCredit(false);
+        blocked_sleep = false;
+    }
+
     // Fix up the busy variables
     for ( int i = 0; i < num_ports; i++ ) {
     	// Should stop at zero, need to find a clean way to do this
@@ -443,9 +473,65 @@ hr_router::clock_handler(Cycle_t cycle)
         if ( out_port_busy[i] != 0 ) out_port_busy[i]--;
     }
 
+    if ( event_driven && get_vcs_with_data() != 0 ) {
+        return sleepUntilEligible(cycle);
+    }
     return false;
 }
 
+// Checks whether any VC can be granted in the next cycle.  If not, the
+// clock is stopped and, unless every VC is waiting on credits, a wakeup
+// is scheduled for the first cycle a VC becomes eligible.  Arrivals and
+// returned credits also wake the router through notifyEvent().  Only
+// used with arbitration units that leave their state unchanged in
+// cycles without grants, so skipping those cycles is exact.
+//
+// Only the VCs set in the data bitmaps are visited, and the walk stops
+// at the first eligible one, so arbitration is only run in cycles where
+// some port has an eligible VC.
+bool
+hr_router::sleepUntilEligible(Cycle_t cycle)
+{
+    int wait = -1;
+
+    for ( size_t w = 0; w < port_data_masks.size(); w++ ) {
+        for ( uint64_t port_bits = port_data_masks[w]; port_bits != 0; port_bits &= port_bits - 1 ) {
+            int i = w * 64 + __builtin_ctzll(port_bits);
+            internal_router_event** heads = &vc_heads[i*num_vcs];
+            for ( uint64_t vc_bits = vc_data_masks[i]; vc_bits != 0; vc_bits &= vc_bits - 1 ) {
+                internal_router_event* ev = heads[__builtin_ctzll(vc_bits)];
+
+                // Without credits the VC waits for handle_output to return them
+                int next_port = ev->getNextPort();
+                if ( !ports[next_port]->spaceToSend(ev->getVC(), ev->getFlitCount()) ) continue;
+
+                int ready = std::max(in_port_busy[i], out_port_busy[next_port]);
+                if ( ready == 0 ) return false;
+                if ( wait < 0 || ready < wait ) wait = ready;
+            }
+        }
+    }
+
+    // The busy values now hold for the next cycle.  Arrivals while
+    // asleep update port_data_masks before waking the router, so the
+    // ports that stall in the skipped cycles are copied now.
+    blocked_ports = port_data_masks;
+    unclocked_cycle = cycle + 1;
+    blocked_sleep = true;
+    setRequestNotifyOnEvent(true);
+    setRequestNotifyOnCredit(true);
+    if ( wait > 0 ) wakeup_link->send(wait, NULL);
+    return true;
+}
+
+void
+hr_router::handle_wakeup(Event* ev)
+{
+    // Wakeups from an earlier sleep may arrive after the router was
+    // already woken by a packet or credit
+    if ( blocked_sleep ) notifyEvent();
+}
+
 void hr_router::setup()
 {
     for ( int i = 0; i < num_ports; i++ ) {
@@ -582,5 +668,24 @@ hr_router::init_vcs()
     // arbitration logic
     arb->setPorts(num_ports,num_vcs);
 
+    // The event driven eligibility check walks the data bitmaps, which
+    // hold at most 64 VCs per port
+    if ( event_driven && num_vcs > 64 ) event_driven = false;
+
+    if ( arb->useVCDataMasks() || event_driven ) {
+        vc_data_masks.assign(num_ports, 0);
+        port_data_masks.assign((num_ports + 63) / 64, 0);
+    }
+    if ( arb->useVCDataMasks() ) {
+        arb->setVCDataMasks(vc_data_masks.data());
+
+        vc_credit_masks.assign(num_ports, 0);
+        for ( int i = 0; i < num_ports; i++ ) {
+            for ( int j = 0; j < num_vcs; j++ ) {
+                update_vc_credits(i, j, xbar_in_credits[i*num_vcs + j]);
+            }
+        }
+        arb->setVCCreditMasks(vc_credit_masks.data());
+    }
 
 }
@@ -67,6 +67,10 @@ public:
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
+        {"event_driven",       "Set to true to stop clocking the crossbar while every VC with data is waiting on a busy port or on credits.  "
+                               "The crossbar is woken when the earliest busy port frees up, or when a packet or credit arrives.  "
+                               "Only takes effect with arbitration units that leave their state unchanged in cycles without grants "
+                               "(merlin.xbar_arb_lru and merlin.xbar_arb_age).  Other units, including merlin.xbar_arb_rr, keep the crossbar clocked.", "false"},
         {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
     )
 
@@ -126,9 +130,23 @@ private:
     TimeConverter* xbar_tc;
     Clock::Handler<hr_router>* my_clock_handler;
 
+    // Event driven mode.  When no VC can be granted for a number of
+    // cycles, the clock is stopped and a wakeup is scheduled for the
+    // cycle the first VC becomes eligible.  Eligibility is found from
+    // the Router data bitmaps (port_data_masks, vc_data_masks).
+    // blocked_ports is a copy of port_data_masks taken when the clock
+    // stopped so the xbar_stalls for the skipped cycles can be added
+    // back in.
+    bool event_driven;
+    bool blocked_sleep;
+    std::vector<uint64_t> blocked_ports;
+    Link* wakeup_link;
+
     std::vector<std::string> inspector_names;
 
     bool clock_handler(Cycle_t cycle);
+    bool sleepUntilEligible(Cycle_t cycle);
+    void handle_wakeup(Event* ev);
     static void sigHandler(int signal);
 
     void init_vcs();
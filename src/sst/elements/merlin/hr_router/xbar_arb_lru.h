@@ -196,6 +196,9 @@ public:
     void reportSkippedCycles(Cycle_t cycles) {
     }
 
+    // Nothing changes in a cycle without grants
+    bool isOkayToSkipBlockedCycles() { return true; }
+
     void dumpState(std::ostream& stream) {
         /* stream << "Current round robin port: " << rr_port << std::endl; */
         /* stream << "  Current round robin VC by port:" << std::endl; */
@@ -0,0 +1,189 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_RR_BITMASK_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_RR_BITMASK_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <stdint.h>
+#include <vector>
+
+#include "sst/elements/merlin/merlin.h"
+#include "sst/elements/merlin/router.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Merlin {
+
+// Makes the same grants as xbar_arb_rr, but takes the VCs with a head
+// event from the router's per-port VC bitmaps instead of reading every
+// VC head, and visits them with a rotated find-first-set.  Ports with no
+// waiting events cost one word test.  A VC whose output buffer VC has no
+// credits at all is rejected with a bit test on the router's credit
+// bitmaps; only the remaining VCs ask the port for the exact credit count.
+class xbar_arb_rr_bitmask : public XbarArbitration {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        xbar_arb_rr_bitmask,
+        "merlin",
+        "xbar_arb_rr_bitmask",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Round robin arbitration unit for hr_router using per-port VC data and credit bitmaps.  Grants are identical to xbar_arb_rr",
+        SST::Merlin::XbarArbitration)
+
+
+private:
+    int num_ports;
+    int num_vcs;
+
+    std::vector<int> rr_vcs;
+    int rr_port;
+
+    // Per-port bitmaps of VCs with a head event, owned by the router
+    uint64_t const* vc_data_masks;
+    // Per-port bitmaps of output buffer VCs with credits, owned by the router
+    uint64_t const* vc_credit_masks;
+
+    // Returns the first set bit of mask at or after start, wrapping around
+    static inline int findSetRotated(uint64_t mask, int start) {
+        uint64_t high = mask & (~(uint64_t)0 << start);
+        return __builtin_ctzll(high != 0 ? high : mask);
+    }
+
+public:
+
+    xbar_arb_rr_bitmask(ComponentId_t cid, Params& params) :
+        XbarArbitration(cid),
+        vc_data_masks(NULL),
+        vc_credit_masks(NULL)
+    {
+    }
+
+    ~xbar_arb_rr_bitmask() {
+    }
+
+    void setPorts(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        if ( num_vcs > 64 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "xbar_arb_rr_bitmask supports at most 64 VCs per port, %d requested\n", num_vcs);
+        }
+
+        rr_vcs.resize(num_ports, 0);
+
+        rr_port = 0;
+    }
+
+    bool useVCDataMasks() { return true; }
+    void setVCDataMasks(uint64_t const* masks) { vc_data_masks = masks; }
+    void setVCCreditMasks(uint64_t const* masks) { vc_credit_masks = masks; }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   )
+    {
+        // Run through each of the ports, giving first pick in a round robin fashion
+        for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
+
+            // Overwrite old data
+            progress_vc[port] = -1;
+            // if the output of this port is busy, nothing to do.
+            if ( in_port_busy[port] > 0 ) {
+                continue;
+            }
+
+            // VCs with a head event
+            uint64_t requests = 0;
+            internal_router_event** vc_heads = NULL;
+            if ( vc_data_masks != NULL ) {
+                requests = vc_data_masks[port];
+                if ( requests != 0 ) vc_heads = ports[port]->getVCHeads();
+            }
+            else {
+                vc_heads = ports[port]->getVCHeads();
+                for ( int vc = 0; vc < num_vcs; vc++ ) {
+                    requests |= (uint64_t)(vc_heads[vc] != NULL) << vc;
+                }
+            }
+
+            // Take the first requesting VC, in round robin order, whose
+            // output port is free and has enough credits
+            while ( requests != 0 ) {
+                int vc = findSetRotated(requests, rr_vcs[port]);
+                requests &= ~((uint64_t)1 << vc);
+
+                internal_router_event* src_event = vc_heads[vc];
+                int next_port = src_event->getNextPort();
+                int next_vc = src_event->getVC();
+                if ( out_port_busy[next_port] > 0 ) continue;
+                if ( vc_credit_masks != NULL && (vc_credit_masks[next_port] & ((uint64_t)1 << next_vc)) == 0 ) continue;
+                if ( !ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) continue;
+
+                // Tell the router what to move
+                progress_vc[port] = vc;
+
+                // Need to set the busy values
+                in_port_busy[port] = src_event->getFlitCount();
+                out_port_busy[next_port] = src_event->getFlitCount();
+                break;  // Go to next port;
+            }
+
+            // Increment rr_vcs for next time
+            if ( ++rr_vcs[port] == num_vcs ) rr_vcs[port] = 0;
+        }
+        rr_port = (rr_port + 1) % num_ports;
+
+        return;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) {
+#if !VERIFY_DECLOCKING
+        // With VERIFY_DECLOCKING the router keeps calling arbitrate(),
+        // so rr_port has already advanced.  This unit does not keep a
+        // shadow copy to check it against.
+        rr_port = (rr_port + cycles) % num_ports;
+#endif
+    }
+
+    void dumpState(std::ostream& stream) {
+        stream << "Current round robin port: " << rr_port << std::endl;
+        stream << "  Current round robin VC by port:" << std::endl;
+        for ( int i = 0; i < num_ports; i++ ) {
+            stream << i << ": " << rr_vcs[i] << std::endl;
+        }
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_RR_BITMASK_H
@@ -58,6 +58,7 @@ PortControl::send(internal_router_event* ev, int vc)
 #endif
     
 	xbar_in_credits[vc] -= ev->getFlitCount();
+	parent->update_vc_credits(port_number, vc, xbar_in_credits[vc]);
     if ( oql_track_port ) {
         int flits = ev->getFlitCount();
         for ( int i = 0; i < num_vcs; ++i ) {
@@ -104,7 +105,7 @@ PortControl::recv(int vc)
 	// Need to update vc_heads
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
-	    parent->dec_vcs_with_data();
+	    parent->dec_vcs_with_data(port_number, vc);
 	}
 	else {
         auto event = input_buf[vc].front();
@@ -812,7 +813,7 @@ PortControl::handle_input_n2r(Event* ev)
 	    if ( vc_heads[curr_vc] == NULL ) {
             topo->route_packet(port_number, rtr_event->getVC(), rtr_event);
             vc_heads[curr_vc] = rtr_event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
 	    
 	    if ( event->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
@@ -896,7 +897,7 @@ PortControl::handle_input_r2r(Event* ev)
 	    if ( vc_heads[curr_vc] == NULL ) {
             topo->route_packet(port_number, event->getVC(), event);
             vc_heads[curr_vc] = event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
 	    
 	    if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
@@ -966,6 +967,8 @@ PortControl::handle_output(Event* ev) {
 	    // Need to return credits to the output buffer
 	    int size = send_event->getFlitCount();
 	    xbar_in_credits[vc_to_send] += size;
+	    parent->update_vc_credits(port_number, vc_to_send, xbar_in_credits[vc_to_send]);
+	    if ( parent->getRequestNotifyOnCredit() ) parent->notifyEvent();
         if ( !oql_track_remote ) {
             if ( oql_track_port ) {
                 for ( int i = 0; i < num_vcs; ++i ) {
@@ -23,6 +23,7 @@
   get compiled.
  */
 #include "hr_router/xbar_arb_rr.h"
+#include "hr_router/xbar_arb_rr_bitmask.h"
 #include "hr_router/xbar_arb_lru.h"
 #include "hr_router/xbar_arb_age.h"
 #include "hr_router/xbar_arb_rand.h"
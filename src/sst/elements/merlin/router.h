@@ -28,6 +28,7 @@
 #include <sst/core/interfaces/simpleNetwork.h>
 
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Merlin {
@@ -41,10 +42,12 @@ class TopologyEvent;
 class Router : public Component {
 private:
     bool requestNotifyOnEvent;
+    bool requestNotifyOnCredit;
 
     Router() :
     	Component(),
     	requestNotifyOnEvent(false),
+    	requestNotifyOnCredit(false),
     	vcs_with_data(0)
     {}
 
@@ -52,25 +55,66 @@ protected:
     inline void setRequestNotifyOnEvent(bool state)
     { requestNotifyOnEvent = state; }
 
+    // Also notify when xbar output buffer credits are returned.  Used
+    // by routers that stop clocking while VCs are waiting for credits.
+    inline void setRequestNotifyOnCredit(bool state)
+    { requestNotifyOnCredit = state; }
+
     int vcs_with_data;
+
+    // Optional per-port bitmap of the VCs that have a head event (bit
+    // vc of entry port).  Only kept up to date when sized by the
+    // router, which requires at most 64 VCs per port.
+    std::vector<uint64_t> vc_data_masks;
+    // Bitmap of the ports with any VC in vc_data_masks set (bit port%64
+    // of word port/64).  Kept up to date together with vc_data_masks.
+    std::vector<uint64_t> port_data_masks;
+    // Optional per-port bitmap of the output buffer VCs that hold any
+    // xbar credits (bit vc of entry port).  A clear bit means nothing
+    // can be sent to that VC, a set bit still needs spaceToSend() for
+    // the packet's flit count.  Only kept up to date when sized by the
+    // router.
+    std::vector<uint64_t> vc_credit_masks;
     
 public:
 
     Router(ComponentId_t id) :
         Component(id),
         requestNotifyOnEvent(false),
+        requestNotifyOnCredit(false),
         vcs_with_data(0)
     {}
 
     virtual ~Router() {}
     
     inline bool getRequestNotifyOnEvent() { return requestNotifyOnEvent; }
+    inline bool getRequestNotifyOnCredit() { return requestNotifyOnCredit; }
    
     virtual void notifyEvent() {}
 
     inline void inc_vcs_with_data() { vcs_with_data++; }
     inline void dec_vcs_with_data() { vcs_with_data--; }
+    inline void inc_vcs_with_data(int port, int vc) {
+        vcs_with_data++;
+        if ( !vc_data_masks.empty() ) {
+            vc_data_masks[port] |= (uint64_t)1 << vc;
+            port_data_masks[port / 64] |= (uint64_t)1 << (port % 64);
+        }
+    }
+    inline void dec_vcs_with_data(int port, int vc) {
+        vcs_with_data--;
+        if ( !vc_data_masks.empty() ) {
+            vc_data_masks[port] &= ~((uint64_t)1 << vc);
+            if ( vc_data_masks[port] == 0 ) port_data_masks[port / 64] &= ~((uint64_t)1 << (port % 64));
+        }
+    }
     inline int get_vcs_with_data() { return vcs_with_data; }
+    inline void update_vc_credits(int port, int vc, int credits) {
+        if ( !vc_credit_masks.empty() ) {
+            if ( credits > 0 ) vc_credit_masks[port] |= (uint64_t)1 << vc;
+            else vc_credit_masks[port] &= ~((uint64_t)1 << vc);
+        }
+    }
 
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendTopologyEvent(int port, TopologyEvent* ev) = 0;
@@ -514,7 +558,21 @@ public:
     virtual void arbitrate(PortInterface** ports, int* port_busy, int* out_port_busy, int* progress_vc) = 0;
 #endif
     virtual void setPorts(int num_ports, int num_vcs) = 0;
+    // Units that return true are given the router's per-port bitmaps
+    // of VCs with a head event (see Router::vc_data_masks) through
+    // setVCDataMasks() and of output VCs with credits (see
+    // Router::vc_credit_masks) through setVCCreditMasks() after
+    // setPorts().
+    virtual bool useVCDataMasks() { return false; }
+    virtual void setVCDataMasks(uint64_t const* masks) {}
+    virtual void setVCCreditMasks(uint64_t const* masks) {}
     virtual bool isOkayToPauseClock() { return true; }
+    // Returns true if a cycle in which no VC can be granted leaves the
+    // arbitration state unchanged.  The unit must only grant a VC when
+    // in_port_busy and out_port_busy are zero and spaceToSend() is
+    // true, and must mark ports with a blocked VC as stalled (-2).
+    // Routers may then skip such cycles instead of calling arbitrate().
+    virtual bool isOkayToSkipBlockedCycles() { return false; }
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
 	
@@ -0,0 +1,20 @@
+#!/bin/bash
+# Compare clocked and event driven hr_router throughput on dragon_128_test.py
+# and check that both modes produce the same statistics
+# Usage: ./benchEventDriven.sh [xbar_arb]
+
+ARB=${1:-merlin.xbar_arb_lru}
+
+for mode in false true ; do
+    start=$(date +%s.%N)
+    sst dragon_128_test.py -- xbar_arb=${ARB} event_driven=${mode} stats=stats_event_driven_${mode}.csv > /dev/null 2>&1
+    end=$(date +%s.%N)
+    echo "event_driven=${mode}: $(echo "${end} - ${start}" | bc) s"
+done
+
+if diff -q <(sort stats_event_driven_false.csv) <(sort stats_event_driven_true.csv) > /dev/null ; then
+    echo "Statistics match"
+else
+    echo "Statistics differ"
+    exit 1
+fi
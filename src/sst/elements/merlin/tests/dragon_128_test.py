@@ -11,6 +11,7 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import sys
 import sst
 from sst.merlin.base import *
 from sst.merlin.endpoint import *
@@ -19,6 +20,14 @@ from sst.merlin.topology import *
 
 if __name__ == "__main__":
 
+    # Optional key=value overrides, used by benchEventDriven.sh
+    options = {}
+    for arg in sys.argv[1:]:
+        if arg.find("=") == -1:
+            print("Malformed option (expected key=value): ", arg)
+            sys.exit(-1)
+        key, value = arg.split("=", 1)
+        options[key.lstrip("-")] = value
 
     ### Setup the topology
     topo = topoDragonFly()
@@ -38,7 +47,9 @@ if __name__ == "__main__":
     router.input_buf_size = "4kB"
     router.output_buf_size = "4kB"
     router.num_vns = 2
-    router.xbar_arb = "merlin.xbar_arb_lru"
+    router.xbar_arb = options.get("xbar_arb", "merlin.xbar_arb_lru")
+    if "event_driven" in options:
+        router.event_driven = options["event_driven"]
 
     topo.router = router
     topo.link_latency = "20ns"
@@ -82,7 +93,7 @@ if __name__ == "__main__":
 
     sst.setStatisticOutput("sst.statOutputCSV");
     sst.setStatisticOutputOptions({
-        "filepath" : "stats.csv",
+        "filepath" : options.get("stats", "stats.csv"),
         "separator" : ", "
     })
 
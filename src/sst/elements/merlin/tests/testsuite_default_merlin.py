@@ -67,6 +67,17 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_hyperx_128(self):
          self.merlin_test_template("hyperx_128_test")
 
+    # The bitmask arbiter makes the same grants as xbar_arb_rr, so output and statistics must match
+    def test_merlin_dragon_128_xbar_arb_rr_bitmask(self):
+        self.merlin_compare_template("dragon_128_test", "xbar_arb=merlin.xbar_arb_rr", "xbar_arb=merlin.xbar_arb_rr_bitmask")
+
+    # Event-driven routers skip only cycles in which nothing can be granted, so output and statistics must match
+    def test_merlin_dragon_128_event_driven_lru(self):
+        self.merlin_compare_template("dragon_128_test", "xbar_arb=merlin.xbar_arb_lru event_driven=false", "xbar_arb=merlin.xbar_arb_lru event_driven=true")
+
+    def test_merlin_dragon_128_event_driven_age(self):
+        self.merlin_compare_template("dragon_128_test", "xbar_arb=merlin.xbar_arb_age event_driven=false", "xbar_arb=merlin.xbar_arb_age event_driven=true")
+
 #####
 
     def merlin_test_template(self, testcase):
@@ -99,3 +110,29 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    def merlin_compare_template(self, testcase, refoptions, options):
+        # Runs testcase with both sets of key=value options and checks that the sorted
+        # output and statistics files are the same
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        runs = []
+        for opts in [refoptions, options]:
+            testDataFileName = "test_merlin_{0}_{1}".format(testcase, opts.replace("=", "_").replace(" ", "_"))
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            statfile = "{0}/{1}.csv".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            otherargs = '--model-options="{0} stats={1}"'.format(opts, statfile)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+            self.assertFalse(os_test_file(errfile, "-s"), "merlin test {0} has Non-empty Error File {1}".format(testDataFileName, errfile))
+            self.assertTrue(os_test_file(statfile, "-s"), "merlin test {0} has an empty statistics file {1}".format(testDataFileName, statfile))
+            runs.append((outfile, statfile))
+
+        for reffile, outfile in zip(runs[0], runs[1]):
+            cmd = "diff -b <(sort {0}) <(sort {1}) > /dev/null".format(reffile, outfile)
+            self.assertTrue(os.system("bash -c '{0}'".format(cmd)) == 0, "Sorted file {0} does not match sorted file {1}".format(outfile, reffile))
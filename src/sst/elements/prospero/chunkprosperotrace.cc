@@ -0,0 +1,164 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vector>
+
+#include <zlib.h>
+
+#include "proschunkformat.h"
+
+using namespace SST::Prospero;
+
+void printUsage() {
+	printf("sst-prospero-chunk-trace [options] <input trace> <output trace>\n");
+	printf("\n");
+	printf("Converts a binary or compressed Prospero trace into a chunked trace\n");
+	printf("which can be replayed (from any record) with the ProsperoMappedTraceReader.\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("  -r <records>  Records per chunk (default 65536)\n");
+	printf("  -l <level>    zlib compression level 0-9 (default 6)\n");
+	printf("\n");
+}
+
+static void writeOrDie(FILE* output, const void* data, const size_t length) {
+	if(length > 0 && 1 != fwrite(data, length, 1, output)) {
+		fprintf(stderr, "Error: failed to write to the output trace.\n");
+		exit(-1);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	uint64_t recordsPerChunk = 65536;
+	int level = Z_DEFAULT_COMPRESSION;
+	const char* inputPath = NULL;
+	const char* outputPath = NULL;
+
+	for(int i = 1; i < argc; i++) {
+		if(std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+			printUsage();
+			exit(0);
+		} else if(std::strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+			recordsPerChunk = strtoull(argv[++i], NULL, 0);
+		} else if(std::strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+			level = atoi(argv[++i]);
+		} else if(NULL == inputPath) {
+			inputPath = argv[i];
+		} else if(NULL == outputPath) {
+			outputPath = argv[i];
+		} else {
+			printUsage();
+			exit(-1);
+		}
+	}
+
+	if(NULL == inputPath || NULL == outputPath || 0 == recordsPerChunk) {
+		printUsage();
+		exit(-1);
+	}
+
+	// gzread passes uncompressed files through, so this reads both the
+	// binary and compressed binary trace formats
+	gzFile input = gzopen(inputPath, "rb");
+	if(Z_NULL == input) {
+		fprintf(stderr, "Error: unable to open input trace: %s\n", inputPath);
+		exit(-1);
+	}
+
+	FILE* output = fopen(outputPath, "wb");
+	if(NULL == output) {
+		fprintf(stderr, "Error: unable to open output trace: %s\n", outputPath);
+		exit(-1);
+	}
+
+	ProsperoChunkHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PROSPERO_CHUNK_MAGIC, sizeof(header.magic));
+	header.version = PROSPERO_CHUNK_VERSION;
+	header.recordLength = PROSPERO_BINARY_RECORD_LENGTH;
+	header.recordsPerChunk = recordsPerChunk;
+
+	// Written again with the final counts once all chunks are out
+	writeOrDie(output, &header, sizeof(header));
+
+	std::vector<ProsperoChunkIndexEntry> index;
+	std::vector<char> chunk(recordsPerChunk * PROSPERO_BINARY_RECORD_LENGTH);
+	std::vector<char> compressed(compressBound(chunk.size()));
+	uint64_t offset = sizeof(header);
+
+	while(true) {
+		const int bytesRead = gzread(input, &chunk[0], (unsigned int) chunk.size());
+		if(bytesRead < 0) {
+			fprintf(stderr, "Error: failed reading input trace: %s\n", inputPath);
+			exit(-1);
+		}
+
+		const uint64_t records = bytesRead / PROSPERO_BINARY_RECORD_LENGTH;
+		if(0 == records) {
+			break;
+		}
+
+		uLongf compressedLength = (uLongf) compressed.size();
+		if(Z_OK != compress2((Bytef*) &compressed[0], &compressedLength, (const Bytef*) &chunk[0],
+			(uLong) (records * PROSPERO_BINARY_RECORD_LENGTH), level)) {
+
+			fprintf(stderr, "Error: failed to compress chunk %zu\n", index.size());
+			exit(-1);
+		}
+
+		writeOrDie(output, &compressed[0], compressedLength);
+
+		ProsperoChunkIndexEntry entry;
+		entry.offset = offset;
+		entry.compressedLength = compressedLength;
+		index.push_back(entry);
+
+		offset += compressedLength;
+		header.totalRecords += records;
+
+		// Only the last chunk may be short
+		if(records < recordsPerChunk) {
+			break;
+		}
+	}
+
+	// Keep the index 8-byte aligned so the reader can use it in place
+	const char padding[sizeof(uint64_t)] = { 0 };
+	const size_t padLength = (sizeof(uint64_t) - (offset % sizeof(uint64_t))) % sizeof(uint64_t);
+	writeOrDie(output, padding, padLength);
+
+	header.chunkCount = index.size();
+	header.indexOffset = offset + padLength;
+
+	writeOrDie(output, index.empty() ? NULL : &index[0], index.size() * sizeof(ProsperoChunkIndexEntry));
+
+	fseek(output, 0, SEEK_SET);
+	writeOrDie(output, &header, sizeof(header));
+
+	fclose(output);
+	gzclose(input);
+
+	printf("Wrote %" PRIu64 " records in %" PRIu64 " chunks to %s\n",
+		header.totalRecords, header.chunkCount, outputPath);
+
+	return 0;
+}
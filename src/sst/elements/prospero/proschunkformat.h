@@ -0,0 +1,71 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_CHUNK_FORMAT
+#define _H_SST_PROSPERO_CHUNK_FORMAT
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Layout of a chunked Prospero trace. The trace is the same stream of
+ * binary records the binary reader consumes, split into chunks of a fixed
+ * number of records which are each compressed independently with zlib.
+ *
+ *   ProsperoChunkHeader
+ *   chunk 0 ... chunk N-1            (zlib streams)
+ *   ProsperoChunkIndexEntry[N]       (at header.indexOffset)
+ *
+ * Because every chunk holds the same number of records (except the last)
+ * the chunk for a given record is found directly from the index, so a
+ * replay can start part way through the trace without decompressing
+ * what comes before it. All fields are in the byte order of the host that
+ * wrote the trace, as for the binary trace format.
+ */
+
+namespace SST {
+namespace Prospero {
+
+#define PROSPERO_CHUNK_MAGIC "PROSCHNK"
+#define PROSPERO_CHUNK_VERSION 1
+
+/* cycles (8) + type (1) + address (8) + length (4) */
+#define PROSPERO_BINARY_RECORD_LENGTH 21
+
+typedef struct {
+	char     magic[8];
+	uint32_t version;
+	uint32_t recordLength;
+	uint64_t recordsPerChunk;
+	uint64_t totalRecords;
+	uint64_t chunkCount;
+	uint64_t indexOffset;
+} ProsperoChunkHeader;
+
+typedef struct {
+	uint64_t offset;
+	uint64_t compressedLength;
+} ProsperoChunkIndexEntry;
+
+static inline bool prosperoIsChunkedTrace(const char* data, const size_t length) {
+	return length >= sizeof(ProsperoChunkHeader) &&
+		0 == memcmp(data, PROSPERO_CHUNK_MAGIC, 8);
+}
+
+}
+}
+
+#endif
@@ -326,6 +326,6 @@ void ProsperoComponent::issueRequest(const ProsperoTraceEntry* entry) {
 		currentOutstanding++;
 	}
 
-	// Delete this entry, we are done converting it into a request
-	delete entry;
+	// Release this entry, we are done converting it into a request
+	reader->releaseEntry(entry);
 }
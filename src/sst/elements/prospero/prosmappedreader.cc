@@ -0,0 +1,238 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "prosmappedreader.h"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST::Prospero;
+
+
+ProsperoMappedTraceReader::ProsperoMappedTraceReader( ComponentId_t id, Params& params, Output* out ) :
+	ProsperoTraceReader(id, params, out),
+	ringPos(0), ringCount(0), mapping(NULL), mappingLength(0),
+	current(NULL), remaining(0), chunked(false), chunkIndex(NULL), nextChunkIndex(0) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	const uint64_t batchSize = params.find<uint64_t>("batch_size", 4096);
+	const uint64_t startRecord = params.find<uint64_t>("start_record", 0);
+
+	if(0 == batchSize) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: batch_size must be at least 1.\n", getName().c_str());
+	}
+
+	const int traceFD = open(traceFile.c_str(), O_RDONLY);
+
+	if(traceFD < 0) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: Error opening trace file: %s in mapped reader.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	struct stat traceStat;
+	if(0 != fstat(traceFD, &traceStat)) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: Unable to stat trace file: %s\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	mappingLength = (size_t) traceStat.st_size;
+
+	if(mappingLength > 0) {
+		void* map = mmap(NULL, mappingLength, PROT_READ, MAP_PRIVATE, traceFD, 0);
+
+		if(MAP_FAILED == map) {
+			output->fatal(CALL_INFO, -1, "%s, Fatal: Unable to map trace file: %s\n",
+				getName().c_str(), traceFile.c_str());
+		}
+
+		mapping = (char*) map;
+		madvise(mapping, mappingLength, MADV_SEQUENTIAL);
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	close(traceFD);
+
+	ring.resize(batchSize);
+
+	// A gzip trace would otherwise be replayed as garbage binary records
+	if(mappingLength >= 2 && (unsigned char) mapping[0] == 0x1f && (unsigned char) mapping[1] == 0x8b) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: trace file: %s is gzip compressed. Use the ProsperoCompressedBinaryTraceReader or convert it with sst-prospero-chunk-trace.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	if(NULL != mapping && prosperoIsChunkedTrace(mapping, mappingLength)) {
+#ifdef HAVE_LIBZ
+		chunked = true;
+		memcpy(&header, mapping, sizeof(header));
+
+		if(PROSPERO_CHUNK_VERSION != header.version ||
+			PROSPERO_BINARY_RECORD_LENGTH != header.recordLength ||
+			0 == header.recordsPerChunk ||
+			0 != (header.indexOffset % sizeof(uint64_t)) ||
+			header.indexOffset > mappingLength ||
+			header.chunkCount > (mappingLength - header.indexOffset) / sizeof(ProsperoChunkIndexEntry) ||
+			header.chunkCount != (header.totalRecords / header.recordsPerChunk) + ((header.totalRecords % header.recordsPerChunk) ? 1 : 0)) {
+
+			output->fatal(CALL_INFO, -1, "%s, Fatal: chunked trace file: %s has an unsupported or corrupt header.\n",
+				getName().c_str(), traceFile.c_str());
+		}
+
+		chunkIndex = (const ProsperoChunkIndexEntry*) (mapping + header.indexOffset);
+
+		output->verbose(CALL_INFO, 1, 0, "Chunked trace: %" PRIu64 " records in %" PRIu64 " chunks of %" PRIu64 " records.\n",
+			header.totalRecords, header.chunkCount, header.recordsPerChunk);
+
+		// Jump straight to the chunk holding the first record and skip the
+		// records before it within the chunk
+		if(startRecord < header.totalRecords) {
+			nextChunkIndex = startRecord / header.recordsPerChunk;
+			nextChunk();
+
+			const uint64_t skip = startRecord % header.recordsPerChunk;
+			current += skip * PROSPERO_BINARY_RECORD_LENGTH;
+			remaining -= skip;
+		} else {
+			nextChunkIndex = header.chunkCount;
+		}
+#else
+		output->fatal(CALL_INFO, -1, "%s, Fatal: trace file: %s is a chunked trace but Prospero was built without zlib.\n",
+			getName().c_str(), traceFile.c_str());
+#endif
+	} else {
+		const uint64_t totalRecords = mappingLength / PROSPERO_BINARY_RECORD_LENGTH;
+
+		if(startRecord < totalRecords) {
+			current = mapping + (startRecord * PROSPERO_BINARY_RECORD_LENGTH);
+			remaining = totalRecords - startRecord;
+		}
+
+		output->verbose(CALL_INFO, 1, 0, "Binary trace: %" PRIu64 " records, starting at record %" PRIu64 ".\n",
+			totalRecords, startRecord);
+	}
+}
+
+ProsperoMappedTraceReader::~ProsperoMappedTraceReader() {
+	if(NULL != mapping) {
+		munmap(mapping, mappingLength);
+	}
+}
+
+bool ProsperoMappedTraceReader::nextChunk() {
+#ifdef HAVE_LIBZ
+	if(nextChunkIndex >= header.chunkCount) {
+		return false;
+	}
+
+	const ProsperoChunkIndexEntry& entry = chunkIndex[nextChunkIndex];
+	const uint64_t firstRecord = nextChunkIndex * header.recordsPerChunk;
+	const uint64_t chunkRecords = std::min(header.recordsPerChunk, header.totalRecords - firstRecord);
+
+	if(entry.offset > mappingLength || entry.compressedLength > mappingLength - entry.offset) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: chunk %" PRIu64 " lies outside of the trace file.\n",
+			getName().c_str(), nextChunkIndex);
+	}
+
+	chunkBuffer.resize(chunkRecords * PROSPERO_BINARY_RECORD_LENGTH);
+
+	uLongf chunkLength = (uLongf) chunkBuffer.size();
+	const int result = uncompress((Bytef*) &chunkBuffer[0], &chunkLength,
+		(const Bytef*) (mapping + entry.offset), (uLong) entry.compressedLength);
+
+	if(Z_OK != result || chunkLength != chunkBuffer.size()) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: unable to decompress chunk %" PRIu64 " (zlib returned %d).\n",
+			getName().c_str(), nextChunkIndex, result);
+	}
+
+	output->verbose(CALL_INFO, 2, 0, "Decompressed chunk %" PRIu64 ", %" PRIu64 " records.\n",
+		nextChunkIndex, chunkRecords);
+
+	current = &chunkBuffer[0];
+	remaining = chunkRecords;
+	nextChunkIndex++;
+
+	// Start paging in the next chunk while this one is replayed
+	if(nextChunkIndex < header.chunkCount) {
+		const long pageSize = sysconf(_SC_PAGESIZE);
+		const uint64_t start = chunkIndex[nextChunkIndex].offset - (chunkIndex[nextChunkIndex].offset % pageSize);
+		if(start < mappingLength) {
+			madvise(mapping + start, std::min((uint64_t) mappingLength - start,
+				chunkIndex[nextChunkIndex].compressedLength + pageSize), MADV_WILLNEED);
+		}
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void ProsperoMappedTraceReader::decode(const char* source, const uint64_t count) {
+	for(uint64_t i = 0; i < count; ++i) {
+		const char* record = source + (i * PROSPERO_BINARY_RECORD_LENGTH);
+
+		uint64_t reqCycles;
+		uint64_t reqAddress;
+		uint32_t reqLength;
+		const char reqType = record[sizeof(uint64_t)];
+
+		memcpy(&reqCycles,  record, sizeof(uint64_t));
+		memcpy(&reqAddress, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+		memcpy(&reqLength,  record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+
+		ring[i] = ProsperoTraceEntry(reqCycles, reqAddress, reqLength,
+			(reqType == 'R' || reqType == 'r') ? READ : WRITE);
+	}
+}
+
+void ProsperoMappedTraceReader::refill() {
+	ringPos = 0;
+	ringCount = 0;
+
+	if(0 == remaining && !(chunked && nextChunk())) {
+		return;
+	}
+
+	ringCount = std::min((uint64_t) ring.size(), remaining);
+	decode(current, ringCount);
+
+	current += ringCount * PROSPERO_BINARY_RECORD_LENGTH;
+	remaining -= ringCount;
+}
+
+// Entries are handed out of the ring in place. The component releases each
+// entry before it asks for the next one, so a batch is only overwritten once
+// all of its entries have been issued.
+ProsperoTraceEntry* ProsperoMappedTraceReader::readNextEntry() {
+	if(ringPos == ringCount) {
+		refill();
+
+		if(0 == ringCount) {
+			output->verbose(CALL_INFO, 2, 0, "End of trace file reached, returning empty request.\n");
+			return NULL;
+		}
+	}
+
+	return &ring[ringPos++];
+}
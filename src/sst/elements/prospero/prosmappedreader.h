@@ -0,0 +1,78 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_MAPPED_READER
+#define _H_SST_PROSPERO_MAPPED_READER
+
+#include "prosreader.h"
+#include "proschunkformat.h"
+
+#include <vector>
+
+namespace SST {
+namespace Prospero {
+
+class ProsperoMappedTraceReader : public ProsperoTraceReader {
+
+public:
+        ProsperoMappedTraceReader( ComponentId_t id, Params& params, Output* out );
+        ~ProsperoMappedTraceReader();
+        ProsperoTraceEntry* readNextEntry();
+        void releaseEntry(const ProsperoTraceEntry* entry) { }
+
+ 	SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        	ProsperoMappedTraceReader,
+        	"prospero",
+        	"ProsperoMappedTraceReader",
+        	SST_ELI_ELEMENT_VERSION(1,0,0),
+        	"Memory mapped Binary and Chunked Trace Reader",
+        	SST::Prospero::ProsperoTraceReader
+    	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "file", "Sets the file for the trace reader to use, either a binary trace or a chunked trace from sst-prospero-chunk-trace", "" },
+		{ "batch_size", "Sets the number of records decoded at a time", "4096" },
+		{ "start_record", "Sets the index of the first record to replay", "0" }
+	)
+
+private:
+	void refill();
+	bool nextChunk();
+	void decode(const char* source, const uint64_t count);
+
+	std::vector<ProsperoTraceEntry> ring;
+	uint64_t ringPos;
+	uint64_t ringCount;
+
+	char* mapping;
+	size_t mappingLength;
+
+	/* Records not yet decoded into the ring */
+	const char* current;
+	uint64_t remaining;
+
+	/* Chunked traces only */
+	bool chunked;
+	ProsperoChunkHeader header;
+	const ProsperoChunkIndexEntry* chunkIndex;
+	uint64_t nextChunkIndex;
+	std::vector<char> chunkBuffer;
+};
+
+}
+}
+
+#endif
@@ -34,6 +34,13 @@ def main():
                 # print "args are ", o, "and", a
                 Tracetype = "CompressedBinary"
                 traceFile = "sstprospero-0-0-gz.trace"
+            elif a == "mapped":
+                Tracetype = "Mapped"
+                traceFile = "sstprospero-0-0-bin.trace"
+            elif a == "chunked":
+                # made with: sst-prospero-chunk-trace sstprospero-0-0-bin.trace sstprospero-0-0-chunk.trace
+                Tracetype = "Mapped"
+                traceFile = "sstprospero-0-0-chunk.trace"
             else:
                 print("no match a= ", a)
                 print("Found nothing for o", o)
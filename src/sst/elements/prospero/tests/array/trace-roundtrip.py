@@ -0,0 +1,60 @@
+# Automatically generated SST Python input
+import sst
+import sys
+
+# Replays a trace made by testsuite_default_prospero.py through a small
+# cache hierarchy. Usage:
+#   sst trace-roundtrip.py -- reader=Mapped file=roundtrip.trace start_record=0
+params = { "reader" : "Binary", "file" : "roundtrip.trace", "start_record" : "0" }
+for arg in sys.argv[1:]:
+    if arg.find("=") == -1:
+        print("Malformed option (expected key=value): ", arg)
+        sys.exit(-1)
+    key, value = arg.split("=", 1)
+    params[key.lstrip("-")] = value
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "5s")
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "prospero.prosperoCPU")
+comp_cpu.addParams({
+    "verbose" : "0",
+    "reader" : "prospero.Prospero" + params["reader"] + "TraceReader",
+    "readerParams.file" : params["file"],
+})
+if params["reader"] == "Mapped":
+    # Small batches so that replay crosses many batch and chunk boundaries
+    comp_cpu.addParams({
+        "readerParams.start_record" : params["start_record"],
+        "readerParams.batch_size" : "100",
+    })
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "1",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "8",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "16 KB"
+})
+comp_memctrl = sst.Component("memory", "memHierarchy.MemController")
+comp_memctrl.addParams({
+      "clock" : "1GHz"
+})
+
+memory = comp_memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "100 ns",
+    "mem_size" : "64MiB",
+})
+
+# Define the simulation links
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (comp_cpu, "cache_link", "1000ps"), (comp_l1cache, "high_network_0", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "low_network_0", "50ps"), (comp_memctrl, "direct_link", "50ps") )
+# End of generated output.
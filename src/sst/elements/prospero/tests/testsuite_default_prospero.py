@@ -0,0 +1,146 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+import gzip
+import random
+import shutil
+import struct
+import subprocess
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        try:
+            # Put your single instance Init Code Here
+            pass
+        except:
+            pass
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+# sst-prospero-chunk-trace is only built when zlib is available
+chunk_tool = shutil.which("sst-prospero-chunk-trace")
+
+# Records in the generated trace and per chunk; the trace ends in a short chunk
+roundtrip_records = 5000
+roundtrip_chunk_records = 512
+
+class testcase_prospero(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @unittest.skipIf(chunk_tool is None, "prospero: sst-prospero-chunk-trace is not built (requires zlib)")
+    def test_prospero_chunked_roundtrip(self):
+        tmpdir = self.get_test_output_tmp_dir()
+        binfile = "{0}/roundtrip-bin.trace".format(tmpdir)
+        chunkfile = "{0}/roundtrip-chunk.trace".format(tmpdir)
+        self._write_binary_trace(binfile)
+        self._chunk_trace(binfile, chunkfile)
+
+        # Every reader must replay the same records as the binary reader
+        ref = self._run_trace("binary", "Binary", binfile)
+        self._assert_same_output(ref, self._run_trace("mapped", "Mapped", binfile))
+        self._assert_same_output(ref, self._run_trace("chunked", "Mapped", chunkfile))
+
+        # Starting part way through a chunk must match the binary trace
+        # started at the same record
+        start = 3 * roundtrip_chunk_records + 17
+        ref = self._run_trace("mapped_start", "Mapped", binfile, start)
+        self._assert_same_output(ref, self._run_trace("chunked_start", "Mapped", chunkfile, start))
+
+    @unittest.skipIf(chunk_tool is None, "prospero: sst-prospero-chunk-trace is not built (requires zlib)")
+    def test_prospero_chunked_corrupt_header(self):
+        tmpdir = self.get_test_output_tmp_dir()
+        binfile = "{0}/corrupt-bin.trace".format(tmpdir)
+        chunkfile = "{0}/corrupt-chunk.trace".format(tmpdir)
+        self._write_binary_trace(binfile)
+        self._chunk_trace(binfile, chunkfile)
+
+        # totalRecords follows magic (8), version (4), recordLength (4) and
+        # recordsPerChunk (8); claim more records than the chunks hold
+        with open(chunkfile, "r+b") as fp:
+            fp.seek(24)
+            fp.write(struct.pack("=Q", roundtrip_records + roundtrip_chunk_records))
+        self._run_trace_expect_fatal("corrupt", chunkfile, "unsupported or corrupt header")
+
+    def test_prospero_mapped_rejects_gzip(self):
+        tmpdir = self.get_test_output_tmp_dir()
+        binfile = "{0}/gzip-bin.trace".format(tmpdir)
+        gzfile = "{0}/gzip-gz.trace".format(tmpdir)
+        self._write_binary_trace(binfile)
+        with open(binfile, "rb") as fin:
+            with gzip.open(gzfile, "wb") as fout:
+                fout.write(fin.read())
+        self._run_trace_expect_fatal("gzip", gzfile, "is gzip compressed")
+
+#####
+
+    def _write_binary_trace(self, path):
+        # cycles (8), type (1), address (8), length (4); some accesses cross a line
+        rng = random.Random(42)
+        cycles = 0
+        with open(path, "wb") as fp:
+            for i in range(roundtrip_records):
+                cycles += rng.randint(1, 20)
+                op = b"R" if rng.random() < 0.7 else b"W"
+                addr = rng.randrange(0, 1024 * 1024, 8) + (60 if rng.random() < 0.05 else 0)
+                fp.write(struct.pack("=Q", cycles) + op + struct.pack("=QI", addr, 8))
+
+    def _chunk_trace(self, binfile, chunkfile):
+        cmd = "{0} -r {1} {2} {3}".format(chunk_tool, roundtrip_chunk_records, binfile, chunkfile)
+        self.assertEqual(os.system(cmd + " > /dev/null"), 0, "Failed to run: {0}".format(cmd))
+
+    def _trace_args(self, reader, tracefile, start):
+        return '--model-options="reader={0} file={1} start_record={2}"'.format(reader, tracefile, start)
+
+    def _run_trace(self, name, reader, tracefile, start=0):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/array/trace-roundtrip.py".format(test_path)
+        outfile = "{0}/test_prospero_roundtrip_{1}.out".format(outdir, name)
+        errfile = "{0}/test_prospero_roundtrip_{1}.err".format(outdir, name)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args=self._trace_args(reader, tracefile, start))
+        testing_remove_component_warning_from_file(outfile)
+        self.assertFalse(os_test_file(errfile, "-s"), "prospero round trip {0} has Non-empty Error File {1}".format(name, errfile))
+        return outfile
+
+    def _assert_same_output(self, reffile, outfile):
+        cmd = "diff -b {0} {1} > /dev/null".format(reffile, outfile)
+        self.assertTrue(os.system(cmd) == 0, "Output file {0} does not match {1}".format(outfile, reffile))
+
+    def _run_trace_expect_fatal(self, name, tracefile, message):
+        # The reader must stop with a fatal error rather than replay garbage
+        test_path = self.get_testsuite_dir()
+        sdlfile = "{0}/array/trace-roundtrip.py".format(test_path)
+        cmd = ["sst", sdlfile, "--model-options=reader=Mapped file={0}".format(tracefile)]
+        proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, cwd=test_path)
+        output = proc.communicate()[0].decode("utf-8", "replace")
+        self.assertNotEqual(proc.returncode, 0, "prospero {0}: sst did not fail on {1}".format(name, tracefile))
+        self.assertTrue(message in output, "prospero {0}: expected '{1}' in output:\n{2}".format(name, message, output))
@@ -2,7 +2,8 @@
 #ifndef _H_VANADIS_CACHE
 #define _H_VANADIS_CACHE
 
-#include <list>
+#include <cassert>
+#include <vector>
 #include <unordered_map>
 #include <cstdint>
 #include <type_traits>
@@ -10,100 +11,224 @@
 namespace SST {
 namespace Vanadis {
 
+// Fixed capacity key/value table with least-recently-used replacement.
+// Entries live in a pre-allocated pool and are chained into a doubly
+// linked recency list by index, with a hash map from key to pool slot,
+// so lookups, reordering and eviction are all constant time. The table
+// must have at least one entry.
 template< typename I, typename T >
-class VanadisCache {
+class VanadisLRUTable {
 public:
-	VanadisCache( const size_t cache_entries ) {
-		reset( cache_entries );
-	}
-
-	~VanadisCache() {
-		ordering_q.clear();
-		data_values.clear();
+	VanadisLRUTable( const size_t table_entries ) {
+		reset( table_entries );
 	}
 
 	void clear() {
-		ordering_q.clear();
-		data_values.clear();
+		index.clear();
+		free_slots.clear();
+
+		for( size_t i = entries.size(); i > 0; --i ) {
+			free_slots.push_back( i - 1 );
+		}
+
+		head = npos;
+		tail = npos;
 	}
 
-	void reset( const size_t cache_entries ) {
-		clear();
+	void reset( const size_t table_entries ) {
+		assert( table_entries > 0 );
+
+		max_entries = table_entries;
+		entries.resize( table_entries );
+		index.reserve( table_entries );
 
-		max_entries = cache_entries;
-                data_values.reserve( cache_entries );
+		clear();
 	}
 
-	bool contains( const I& value ) const {
-		return (data_values.find( value ) != data_values.end());
+	bool contains( const I& key ) const {
+		return (index.find( key ) != index.end());
 	}
 
+	// Returns the value and makes the key most recently used, the key
+	// must be present
 	T find( const I& key ) {
-		send_key_to_front( key );
-		return data_values.find( key )->second;
+		const size_t slot = index.find( key )->second;
+		move_to_front( slot );
+		return entries[slot].value;
 	}
 
-	void store( const I& key, T value ) {
-		if( contains( key ) ) {
-			send_key_to_front( key );
-		} else {
-			kill_lru_key();
-			data_values.insert( std::pair<I, T>( key, value ) );
-			ordering_q.push_front( key );
-		}
+	// Returns the value without changing the recency order, the key
+	// must be present
+	T peek( const I& key ) const {
+		return entries[ index.find( key )->second ].value;
 	}
 
 	void touch( const I& key ) {
-		if( contains(key) ) {
-			send_key_to_front( key );
+		auto key_itr = index.find( key );
+
+		if( key_itr != index.end() ) {
+			move_to_front( key_itr->second );
 		}
 	}
 
-	size_t size() {
-		return data_values.size();
+	// Replaces the value without changing the recency order, the key
+	// must be present
+	void update( const I& key, T value ) {
+		entries[ index.find( key )->second ].value = value;
 	}
 
-	size_t capacity() {
+	// Inserts a key that is not present as the most recently used entry.
+	// If the table is full the least recently used entry is removed first
+	// and its value returned through evicted. Returns true if an entry was
+	// evicted; the key is always inserted.
+	bool insert( const I& key, T value, T* evicted ) {
+		bool did_evict = false;
+
+		if( free_slots.empty() ) {
+			const size_t victim = tail;
+			unlink( victim );
+			index.erase( entries[victim].key );
+			free_slots.push_back( victim );
+
+			if( nullptr != evicted ) {
+				(*evicted) = entries[victim].value;
+			}
+
+			did_evict = true;
+		}
+
+		const size_t slot = free_slots.back();
+		free_slots.pop_back();
+
+		entries[slot].key = key;
+		entries[slot].value = value;
+		link_front( slot );
+		index.insert( std::pair<I, size_t>( key, slot ) );
+
+		return did_evict;
+	}
+
+	size_t size() const {
+		return index.size();
+	}
+
+	size_t capacity() const {
 		return max_entries;
 	}
 
 private:
-	void kill_lru_key() {
-		// if we aren't full yet, then keep entries otherwise we will
-		// throw away
-		if( ordering_q.size() < max_entries ) {
-			return;
-		}
+	static const size_t npos = static_cast<size_t>(-1);
 
-		I remove_key = ordering_q.back();
-		ordering_q.pop_back();
+	struct Entry {
+		I key;
+		T value;
+		size_t prev;
+		size_t next;
+	};
 
-		auto find_key = data_values.find( remove_key );
-		delete find_key->second;
-		data_values.erase( find_key );
+	void unlink( const size_t slot ) {
+		Entry& e = entries[slot];
+
+		if( npos == e.prev ) {
+			head = e.next;
+		} else {
+			entries[e.prev].next = e.next;
+		}
+
+		if( npos == e.next ) {
+			tail = e.prev;
+		} else {
+			entries[e.next].prev = e.prev;
+		}
 	}
 
-	void send_key_to_front( const I& key ) {
-		bool found_key = false;
+	void link_front( const size_t slot ) {
+		Entry& e = entries[slot];
+		e.prev = npos;
+		e.next = head;
 
-                for( auto order_itr = ordering_q.begin(); order_itr != ordering_q.end(); ) {
-                        if( key == (*order_itr) ) {
-                                ordering_q.erase( order_itr );
-                                found_key = true;
-				break;
-                        } else {
-                                order_itr++;
-                        }
-                }
+		if( npos == head ) {
+			tail = slot;
+		} else {
+			entries[head].prev = slot;
+		}
+
+		head = slot;
+	}
 
-                if( found_key ) {
-                        ordering_q.push_front( key );
-                }
+	void move_to_front( const size_t slot ) {
+		if( slot != head ) {
+			unlink( slot );
+			link_front( slot );
+		}
 	}
 
 	size_t max_entries;
-	std::list< I > ordering_q;
-	std::unordered_map<I, T> data_values;
+	size_t head;
+	size_t tail;
+	std::vector< Entry > entries;
+	std::vector< size_t > free_slots;
+	std::unordered_map<I, size_t> index;
+
+};
+
+// LRU cache of heap allocated values, a value is deleted when its entry is
+// evicted
+template< typename I, typename T >
+class VanadisCache {
+public:
+	VanadisCache( const size_t cache_entries ) :
+		table( cache_entries ) {
+	}
+
+	~VanadisCache() {
+		table.clear();
+	}
+
+	void clear() {
+		table.clear();
+	}
+
+	void reset( const size_t cache_entries ) {
+		table.reset( cache_entries );
+	}
+
+	bool contains( const I& value ) const {
+		return table.contains( value );
+	}
+
+	T find( const I& key ) {
+		return table.find( key );
+	}
+
+	// Storing a key that is already cached only refreshes it, the cached
+	// value is kept
+	void store( const I& key, T value ) {
+		if( table.contains( key ) ) {
+			table.touch( key );
+		} else {
+			T evicted;
+
+			if( table.insert( key, value, &evicted ) ) {
+				delete evicted;
+			}
+		}
+	}
+
+	void touch( const I& key ) {
+		table.touch( key );
+	}
+
+	size_t size() {
+		return table.size();
+	}
+
+	size_t capacity() {
+		return table.capacity();
+	}
+
+private:
+	VanadisLRUTable<I, T> table;
 
 };
 
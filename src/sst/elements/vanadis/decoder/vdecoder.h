@@ -50,10 +50,15 @@ public:
 
 		const size_t uop_cache_size          = params.find<size_t>("uop_cache_entries", 128);
 		const size_t predecode_cache_entries = params.find<size_t>("predecode_cache_entries", 4);
+		const size_t branch_pred_entries     = params.find<size_t>("branch_predictor_entries", 32);
+
+		if( 0 == uop_cache_size || 0 == predecode_cache_entries || 0 == branch_pred_entries ) {
+			fatal(CALL_INFO, -1, "Error: uop_cache_entries (%zu), predecode_cache_entries (%zu) and branch_predictor_entries (%zu) must all be at least 1\n",
+				uop_cache_size, predecode_cache_entries, branch_pred_entries);
+		}
 
 		ins_loader = new VanadisInstructionLoader( uop_cache_size, predecode_cache_entries, icache_line_width );
 
-		const size_t branch_pred_entries     = params.find<size_t>("branch_predictor_entries", 32);
 		branch_predictor = new VanadisBranchUnit( branch_pred_entries );
 
 		os_handler = loadUserSubComponent<SST::Vanadis::VanadisCPUOSHandler>("os_handler");
@@ -184,6 +184,44 @@ public:
 		setInstructionPointer( params.find<uint64_t>("entry_point", 0) );
 
 		haltOnDecodeZero = true;
+
+		// Primary opcode (bits 31:26) dispatch table, opcodes without a handler decode to a fault
+		for( int i = 0; i < 64; ++i ) {
+			op_decoders[i] = nullptr;
+		}
+
+		op_decoders[ 0 ] = &VanadisMIPSDecoder::decodeSpecial;
+		op_decoders[ MIPS_SPEC_OP_MASK_REGIMM >> 26 ] = &VanadisMIPSDecoder::decodeRegImm;
+		op_decoders[ MIPS_SPEC_OP_MASK_LUI >> 26 ] = &VanadisMIPSDecoder::decodeLUI;
+		op_decoders[ MIPS_SPEC_OP_MASK_LB >> 26 ] = &VanadisMIPSDecoder::decodeLB;
+		op_decoders[ MIPS_SPEC_OP_MASK_LBU >> 26 ] = &VanadisMIPSDecoder::decodeLBU;
+		op_decoders[ MIPS_SPEC_OP_MASK_LW >> 26 ] = &VanadisMIPSDecoder::decodeLW;
+		op_decoders[ MIPS_SPEC_OP_MASK_LFP32 >> 26 ] = &VanadisMIPSDecoder::decodeLFP32;
+		op_decoders[ MIPS_SPEC_OP_MASK_LL >> 26 ] = &VanadisMIPSDecoder::decodeLL;
+		op_decoders[ MIPS_SPEC_OP_MASK_LWL >> 26 ] = &VanadisMIPSDecoder::decodeLWL;
+		op_decoders[ MIPS_SPEC_OP_MASK_LWR >> 26 ] = &VanadisMIPSDecoder::decodeLWR;
+		op_decoders[ MIPS_SPEC_OP_MASK_LHU >> 26 ] = &VanadisMIPSDecoder::decodeLHU;
+		op_decoders[ MIPS_SPEC_OP_MASK_SB >> 26 ] = &VanadisMIPSDecoder::decodeSB;
+		op_decoders[ MIPS_SPEC_OP_MASK_SC >> 26 ] = &VanadisMIPSDecoder::decodeSC;
+		op_decoders[ MIPS_SPEC_OP_MASK_SW >> 26 ] = &VanadisMIPSDecoder::decodeSW;
+		op_decoders[ MIPS_SPEC_OP_MASK_SH >> 26 ] = &VanadisMIPSDecoder::decodeSH;
+		op_decoders[ MIPS_SPEC_OP_MASK_SFP32 >> 26 ] = &VanadisMIPSDecoder::decodeSFP32;
+		op_decoders[ MIPS_SPEC_OP_MASK_SWL >> 26 ] = &VanadisMIPSDecoder::decodeSWL;
+		op_decoders[ MIPS_SPEC_OP_MASK_SWR >> 26 ] = &VanadisMIPSDecoder::decodeSWR;
+		op_decoders[ MIPS_SPEC_OP_MASK_ADDIU >> 26 ] = &VanadisMIPSDecoder::decodeADDIU;
+		op_decoders[ MIPS_SPEC_OP_MASK_BEQ >> 26 ] = &VanadisMIPSDecoder::decodeBEQ;
+		op_decoders[ MIPS_SPEC_OP_MASK_BGTZ >> 26 ] = &VanadisMIPSDecoder::decodeBGTZ;
+		op_decoders[ MIPS_SPEC_OP_MASK_BLEZ >> 26 ] = &VanadisMIPSDecoder::decodeBLEZ;
+		op_decoders[ MIPS_SPEC_OP_MASK_BNE >> 26 ] = &VanadisMIPSDecoder::decodeBNE;
+		op_decoders[ MIPS_SPEC_OP_MASK_SLTI >> 26 ] = &VanadisMIPSDecoder::decodeSLTI;
+		op_decoders[ MIPS_SPEC_OP_MASK_SLTIU >> 26 ] = &VanadisMIPSDecoder::decodeSLTIU;
+		op_decoders[ MIPS_SPEC_OP_MASK_ANDI >> 26 ] = &VanadisMIPSDecoder::decodeANDI;
+		op_decoders[ MIPS_SPEC_OP_MASK_ORI >> 26 ] = &VanadisMIPSDecoder::decodeORI;
+		op_decoders[ MIPS_SPEC_OP_MASK_J >> 26 ] = &VanadisMIPSDecoder::decodeJ;
+		op_decoders[ MIPS_SPEC_OP_MASK_JAL >> 26 ] = &VanadisMIPSDecoder::decodeJAL;
+		op_decoders[ MIPS_SPEC_OP_MASK_XORI >> 26 ] = &VanadisMIPSDecoder::decodeXORI;
+		op_decoders[ MIPS_SPEC_OP_SPECIAL3 >> 26 ] = &VanadisMIPSDecoder::decodeSpecial3;
+		op_decoders[ MIPS_SPEC_OP_MASK_COP1 >> 26 ] = &VanadisMIPSDecoder::decodeCOP1;
 	}
 
 	~VanadisMIPSDecoder() {}
@@ -691,6 +729,10 @@ protected:
 		(*fd) = (ins & MIPS_FD_MASK) >> 6;
 	}
 
+	// Decodes one primary opcode class, returns true if any instructions were added to the bundle
+	typedef bool (VanadisMIPSDecoder::*MIPSOpDecoder)( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins,
+		VanadisInstructionBundle* bundle, const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd );
+
 	void decode( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle ) {
 		output->verbose( CALL_INFO, 16, 0, "[decode] > addr: 0x%llx ins: 0x%08x\n", ins_addr, next_ins );
 
@@ -716,17 +758,12 @@ protected:
 		uint16_t rs = 0;
 		uint16_t rd = 0;
 
-		uint32_t imm = 0;
-
-		// Perform a register and parameter extract in case we need later
+		// Perform a register extract in case we need later
 		extract_three_regs( next_ins, &rt, &rs, &rd );
-		extract_imm( next_ins, &imm );
 
 		output->verbose( CALL_INFO, 16, 0, "[decode] rt=%" PRIu32 ", rs=%" PRIu32 ", rd=%" PRIu32 "\n",
 			rt, rs, rd);
 
-		const uint64_t imm64 = (uint64_t) imm;
-
 		bool insertDecodeFault = true;
 
 		// Check if this is a NOP, this is fairly frequent due to use in delay slots, do not spend time decoding this
@@ -734,741 +771,890 @@ protected:
 			bundle->addInstruction( new VanadisNoOpInstruction( ins_addr, hw_thr, options ) );
 			insertDecodeFault = false;
 		} else {
+			output->verbose(CALL_INFO, 16, 0, "[decode] -> inst-mask: 0x%08x\n", ins_mask);
 
-		output->verbose(CALL_INFO, 16, 0, "[decode] -> inst-mask: 0x%08x\n", ins_mask);
-
-		switch( ins_mask ) {
-		case 0:
-			{
-				// The SHIFT 5 bits must be zero for these operations according to the manual
-				if( 0 == (next_ins & MIPS_SHFT_MASK ) ) {
-					output->verbose( CALL_INFO, 16, 0, "[decode] -> special-class, func-mask: 0x%x\n", func_mask);
-
-					if( (0 == func_mask) && (0 == rs) ) {
-						output->verbose( CALL_INFO, 16, 0, "[decode] -> rs is also zero, implies truncate (generate: 64 to 32 truncate)\n");
-						bundle->addInstruction( new VanadisTruncateInstruction( ins_addr, hw_thr, options, rd, rt, VANADIS_FORMAT_INT64, VANADIS_FORMAT_INT32 ) );
-						insertDecodeFault = false;
-					} else {
-						switch( func_mask ) {
-						case MIPS_SPEC_OP_MASK_ADD:
-							{
-								bundle->addInstruction( new VanadisAddInstruction( ins_addr, hw_thr, options, rd, rs, rt, true, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
-
-						case MIPS_SPEC_OP_MASK_ADDU:
-							{
-								bundle->addInstruction( new VanadisAddInstruction( ins_addr, hw_thr, options, rd, rs, rt, true, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
-
-						case MIPS_SPEC_OP_MASK_AND:
-							{
-								bundle->addInstruction( new VanadisAndInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
-								insertDecodeFault = false;
-							}
-							break;
-
-						// _BREAK NEEDS TO GO HERE?
-
-						case MIPS_SPEC_OP_MASK_DADD:
-							break;
+			const MIPSOpDecoder op_decoder = op_decoders[ next_ins >> 26 ];
 
-						case MIPS_SPEC_OP_MASK_DADDU:
-							break;
+			if( nullptr != op_decoder ) {
+				insertDecodeFault = ! (this->*op_decoder)( output, ins_addr, next_ins, bundle, hw_thr, rt, rs, rd );
+			}
+		}
 
-						case MIPS_SPEC_OP_MASK_DDIV:
-							break;
+		if( insertDecodeFault ) {
+			bundle->addInstruction( new VanadisInstructionDecodeFault( ins_addr, getHardwareThread(), options) );
+		}
 
-						case MIPS_SPEC_OP_MASK_DDIVU:
-							break;
+		for( uint32_t i = 0; i < bundle->getInstructionCount(); ++i ) {
+			output->verbose(CALL_INFO, 16, 0, "-> [%3" PRIu32 "]: %s\n", i, bundle->getInstructionByIndex(i)->getInstCode());
+		}
 
-						case MIPS_SPEC_OP_MASK_DIV:
-							{
-								bundle->addInstruction( new VanadisDivideRemainderInstruction( ins_addr,
-									hw_thr, options, MIPS_REG_LO, MIPS_REG_HI, rs, rt, true, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+		// Mark the end of a micro-op group so we can count real instructions and not just micro-ops
+		if( bundle->getInstructionCount() > 0 ) {
+			bundle->getInstructionByIndex( bundle->getInstructionCount() - 1 )->markEndOfMicroOpGroup();
+		}
 
-						case MIPS_SPEC_OP_MASK_DIVU:
-							{
-								bundle->addInstruction( new VanadisDivideRemainderInstruction( ins_addr,
-									hw_thr, options, MIPS_REG_LO, MIPS_REG_HI, rs, rt, false, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+	}
 
-						case MIPS_SPEC_OP_MASK_DMULT:
-							break;
+	bool decodeSpecial( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-						case MIPS_SPEC_OP_MASK_DMULTU:
-							break;
+		const uint32_t func_mask = next_ins & MIPS_FUNC_MASK;
+		bool insertDecodeFault = true;
 
-						case MIPS_SPEC_OP_MASK_DSLLV:
-							break;
+		// The SHIFT 5 bits must be zero for these operations according to the manual
+		if( 0 == (next_ins & MIPS_SHFT_MASK ) ) {
+			output->verbose( CALL_INFO, 16, 0, "[decode] -> special-class, func-mask: 0x%x\n", func_mask);
 
-						case MIPS_SPEC_OP_MASK_DSRAV:
-							break;
+			if( (0 == func_mask) && (0 == rs) ) {
+				output->verbose( CALL_INFO, 16, 0, "[decode] -> rs is also zero, implies truncate (generate: 64 to 32 truncate)\n");
+				bundle->addInstruction( new VanadisTruncateInstruction( ins_addr, hw_thr, options, rd, rt, VANADIS_FORMAT_INT64, VANADIS_FORMAT_INT32 ) );
+				insertDecodeFault = false;
+			} else {
+				switch( func_mask ) {
+				case MIPS_SPEC_OP_MASK_ADD:
+					{
+						bundle->addInstruction( new VanadisAddInstruction( ins_addr, hw_thr, options, rd, rs, rt, true, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_DSRLV:
-							break;
+				case MIPS_SPEC_OP_MASK_ADDU:
+					{
+						bundle->addInstruction( new VanadisAddInstruction( ins_addr, hw_thr, options, rd, rs, rt, true, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_DSUB:
-							break;
+				case MIPS_SPEC_OP_MASK_AND:
+					{
+						bundle->addInstruction( new VanadisAndInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_DSUBU:
-							break;
+				// _BREAK NEEDS TO GO HERE?
 
-						case MIPS_SPEC_OP_MASK_JR:
-							{
+				case MIPS_SPEC_OP_MASK_DADD:
+					break;
 
-								bundle->addInstruction( new VanadisJumpRegInstruction( ins_addr, hw_thr, options, rs,
-									VANADIS_SINGLE_DELAY_SLOT ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DADDU:
+					break;
 
-						case MIPS_SPEC_OP_MASK_JALR:
-							{
-								bundle->addInstruction( new VanadisJumpRegLinkInstruction( ins_addr, hw_thr, options,
-									rd, rs, VANADIS_SINGLE_DELAY_SLOT ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DDIV:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MFHI:
-							{
-								// Special instruction_, 32 is LO, 33 is HI
-								bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rd,
-									MIPS_REG_HI, 0, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DDIVU:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MFLO:
-							{
-								// Special instruction, 32 is LO, 33 is HI
-								bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rd,
-									MIPS_REG_LO, 0, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DIV:
+					{
+						bundle->addInstruction( new VanadisDivideRemainderInstruction( ins_addr,
+							hw_thr, options, MIPS_REG_LO, MIPS_REG_HI, rs, rt, true, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_MOVN:
-							break;
+				case MIPS_SPEC_OP_MASK_DIVU:
+					{
+						bundle->addInstruction( new VanadisDivideRemainderInstruction( ins_addr,
+							hw_thr, options, MIPS_REG_LO, MIPS_REG_HI, rs, rt, false, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_MOVZ:
-							break;
+				case MIPS_SPEC_OP_MASK_DMULT:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MTHI:
-							break;
+				case MIPS_SPEC_OP_MASK_DMULTU:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MTLO:
-							break;
+				case MIPS_SPEC_OP_MASK_DSLLV:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MULT:
-							{
-								bundle->addInstruction( new VanadisMultiplySplitInstruction( ins_addr, hw_thr, options,
-									MIPS_REG_LO, MIPS_REG_HI, rs, rt, true, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DSRAV:
+					break;
 
-						case MIPS_SPEC_OP_MASK_MULTU:
-							{
-								bundle->addInstruction( new VanadisMultiplySplitInstruction( ins_addr, hw_thr, options,
-									MIPS_REG_LO, MIPS_REG_HI, rs, rt, false, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DSRLV:
+					break;
 
-						case MIPS_SPEC_OP_MASK_NOR:
-							{
-								bundle->addInstruction( new VanadisNorInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
-															insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DSUB:
+					break;
 
-						case MIPS_SPEC_OP_MASK_OR:
-							{
-								bundle->addInstruction( new VanadisOrInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_DSUBU:
+					break;
 
-						case MIPS_SPEC_OP_MASK_SLLV:
-							{
-								bundle->addInstruction( new VanadisShiftLeftLogicalInstruction( ins_addr,
-									hw_thr, options, rd, rt, rs, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_JR:
+					{
 
-						case MIPS_SPEC_OP_MASK_SLT:
-							{
-								bundle->addInstruction( new VanadisSetRegCompareInstruction( ins_addr, hw_thr, options,
-									rd, rs, rt, true, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+						bundle->addInstruction( new VanadisJumpRegInstruction( ins_addr, hw_thr, options, rs,
+							VANADIS_SINGLE_DELAY_SLOT ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_SLTU:
-							{
-								bundle->addInstruction( new VanadisSetRegCompareInstruction( ins_addr, hw_thr, options,
-									rd, rs, rt, false, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_JALR:
+					{
+						bundle->addInstruction( new VanadisJumpRegLinkInstruction( ins_addr, hw_thr, options,
+							rd, rs, VANADIS_SINGLE_DELAY_SLOT ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_SRAV:
-							{
-								bundle->addInstruction( new VanadisShiftRightArithmeticInstruction( ins_addr, hw_thr, options,
-									rd, rt, rs, VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MFHI:
+					{
+						// Special instruction_, 32 is LO, 33 is HI
+						bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rd,
+							MIPS_REG_HI, 0, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_SRLV:
-							{
-								bundle->addInstruction( new VanadisShiftRightLogicalInstruction( ins_addr, hw_thr, options,
-									rd, rt, rs, VANADIS_FORMAT_INT32) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MFLO:
+					{
+						// Special instruction, 32 is LO, 33 is HI
+						bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rd,
+							MIPS_REG_LO, 0, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-						case MIPS_SPEC_OP_MASK_SUB:
-							{
-								bundle->addInstruction( new VanadisSubInstruction( ins_addr, hw_thr, options, rd, rs, rt, true,
-									VANADIS_FORMAT_INT32  ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MOVN:
+					break;
 
-						case MIPS_SPEC_OP_MASK_SUBU:
-							{
-								bundle->addInstruction( new VanadisSubInstruction( ins_addr, hw_thr, options, rd, rs, rt, false,
-									VANADIS_FORMAT_INT32 ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MOVZ:
+					break;
 
-						case MIPS_SPEC_OP_MASK_SYSCALL:
-							{
-								bundle->addInstruction( new VanadisSysCallInstruction( ins_addr, hw_thr, options ) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MTHI:
+					break;
 
-						case MIPS_SPEC_OP_MASK_SYNC:
-							{
-								bundle->addInstruction( new VanadisFenceInstruction( ins_addr, hw_thr, options,
-									VANADIS_LOAD_STORE_FENCE) );
-								insertDecodeFault = false;
-							}
-							break;
+				case MIPS_SPEC_OP_MASK_MTLO:
+					break;
 
-						case MIPS_SPEC_OP_MASK_XOR:
-							bundle->addInstruction( new VanadisXorInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
-							insertDecodeFault = false;
-							break;
-						}
+				case MIPS_SPEC_OP_MASK_MULT:
+					{
+						bundle->addInstruction( new VanadisMultiplySplitInstruction( ins_addr, hw_thr, options,
+							MIPS_REG_LO, MIPS_REG_HI, rs, rt, true, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
 					}
-				} else {
-					switch( func_mask ) {
-					case MIPS_SPEC_OP_MASK_SLL:
-						{
-							const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
+					break;
 
-							output->verbose(CALL_INFO, 16, 0, "[decode/SLL]-> out: %" PRIu16 " / in: %" PRIu16 " shft: %" PRIu64 "\n",
-								rd, rt, shf_amnt);
+				case MIPS_SPEC_OP_MASK_MULTU:
+					{
+						bundle->addInstruction( new VanadisMultiplySplitInstruction( ins_addr, hw_thr, options,
+							MIPS_REG_LO, MIPS_REG_HI, rs, rt, false, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-							bundle->addInstruction( new VanadisShiftLeftLogicalImmInstruction( ins_addr,
-								hw_thr, options, rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
-							insertDecodeFault = false;
-						}
-						break;
+				case MIPS_SPEC_OP_MASK_NOR:
+					{
+						bundle->addInstruction( new VanadisNorInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
+													insertDecodeFault = false;
+					}
+					break;
 
-					case MIPS_SPEC_OP_MASK_SRL:
-						{
-							const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
+				case MIPS_SPEC_OP_MASK_OR:
+					{
+						bundle->addInstruction( new VanadisOrInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-							output->verbose(CALL_INFO, 16, 0, "[decode/SRL]-> out: %" PRIu16 " / in: %" PRIu16 " shft: %" PRIu64 "\n",
-								rd, rt, shf_amnt);
+				case MIPS_SPEC_OP_MASK_SLLV:
+					{
+						bundle->addInstruction( new VanadisShiftLeftLogicalInstruction( ins_addr,
+							hw_thr, options, rd, rt, rs, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-							bundle->addInstruction( new VanadisShiftRightLogicalImmInstruction( ins_addr, hw_thr, options,
-								rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
-							insertDecodeFault = false;
-						}
-						break;
+				case MIPS_SPEC_OP_MASK_SLT:
+					{
+						bundle->addInstruction( new VanadisSetRegCompareInstruction( ins_addr, hw_thr, options,
+							rd, rs, rt, true, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-					case MIPS_SPEC_OP_MASK_SRA:
-						{
-							const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
+				case MIPS_SPEC_OP_MASK_SLTU:
+					{
+						bundle->addInstruction( new VanadisSetRegCompareInstruction( ins_addr, hw_thr, options,
+							rd, rs, rt, false, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-							bundle->addInstruction( new VanadisShiftRightArithmeticImmInstruction( ins_addr, hw_thr, options,
-								rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
-							insertDecodeFault = false;
-						}
-						break;
+				case MIPS_SPEC_OP_MASK_SRAV:
+					{
+						bundle->addInstruction( new VanadisShiftRightArithmeticInstruction( ins_addr, hw_thr, options,
+							rd, rt, rs, VANADIS_FORMAT_INT32 ) );
+						insertDecodeFault = false;
 					}
-				}
-			}
-			break;
+					break;
 
-		case MIPS_SPEC_OP_MASK_REGIMM:
-			{
-				const uint64_t offset_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );;
+				case MIPS_SPEC_OP_MASK_SRLV:
+					{
+						bundle->addInstruction( new VanadisShiftRightLogicalInstruction( ins_addr, hw_thr, options,
+							rd, rt, rs, VANADIS_FORMAT_INT32) );
+						insertDecodeFault = false;
+					}
+					break;
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/REGIMM] -> imm: %" PRIu64 "\n", offset_value_64);
-				output->verbose(CALL_INFO, 16, 0, "[decoder]        -> rt: 0x%08x\n", (next_ins & MIPS_RT_MASK));
+				case MIPS_SPEC_OP_MASK_SUB:
+					{
+						bundle->addInstruction( new VanadisSubInstruction( ins_addr, hw_thr, options, rd, rs, rt, true,
+							VANADIS_FORMAT_INT32  ) );
+						insertDecodeFault = false;
+					}
+					break;
 
-				switch( ( next_ins & MIPS_RT_MASK ) ) {
-				case MIPS_SPEC_OP_MASK_BLTZ:
+				case MIPS_SPEC_OP_MASK_SUBU:
 					{
-						bundle->addInstruction( new VanadisBranchRegCompareImmInstruction(ins_addr, hw_thr, options,
-							rs, 0, offset_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
+						bundle->addInstruction( new VanadisSubInstruction( ins_addr, hw_thr, options, rd, rs, rt, false,
+							VANADIS_FORMAT_INT32 ) );
 						insertDecodeFault = false;
 					}
 					break;
-				case MIPS_SPEC_OP_MASK_BGEZAL:
+
+				case MIPS_SPEC_OP_MASK_SYSCALL:
 					{
-						bundle->addInstruction( new VanadisBranchRegCompareImmLinkInstruction( ins_addr, hw_thr, options,
-							rs, 0, offset_value_64, (uint16_t) 31, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GTE, VANADIS_FORMAT_INT32 ) );
+						bundle->addInstruction( new VanadisSysCallInstruction( ins_addr, hw_thr, options ) );
 						insertDecodeFault = false;
 					}
 					break;
-				case MIPS_SPEC_OP_MASK_BGEZ:
+
+				case MIPS_SPEC_OP_MASK_SYNC:
 					{
-						bundle->addInstruction( new VanadisBranchRegCompareImmInstruction(ins_addr, hw_thr, options,
-							rs, 0, offset_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GTE, VANADIS_FORMAT_INT32 ) );
+						bundle->addInstruction( new VanadisFenceInstruction( ins_addr, hw_thr, options,
+							VANADIS_LOAD_STORE_FENCE) );
 						insertDecodeFault = false;
 					}
 					break;
-				}
 
+				case MIPS_SPEC_OP_MASK_XOR:
+					bundle->addInstruction( new VanadisXorInstruction( ins_addr, hw_thr, options, rd, rs, rt ) );
+					insertDecodeFault = false;
+					break;
+				}
 			}
-			break;
+		} else {
+			switch( func_mask ) {
+			case MIPS_SPEC_OP_MASK_SLL:
+				{
+					const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
 
-		case MIPS_SPEC_OP_MASK_LUI:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 16 );
+					output->verbose(CALL_INFO, 16, 0, "[decode/SLL]-> out: %" PRIu16 " / in: %" PRIu16 " shft: %" PRIu64 "\n",
+						rd, rt, shf_amnt);
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LUI] -> reg: %" PRIu16 " / imm=%" PRId64 "\n",
-					rt, imm_value_64);
+					bundle->addInstruction( new VanadisShiftLeftLogicalImmInstruction( ins_addr,
+						hw_thr, options, rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
+					insertDecodeFault = false;
+				}
+				break;
 
-				bundle->addInstruction( new VanadisSetRegisterInstruction( ins_addr, hw_thr, options, rt, imm_value_64, VANADIS_FORMAT_INT32 ) );
-				insertDecodeFault = false;
-			}
-			break;
+			case MIPS_SPEC_OP_MASK_SRL:
+				{
+					const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
 
-		case MIPS_SPEC_OP_MASK_LB:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+					output->verbose(CALL_INFO, 16, 0, "[decode/SRL]-> out: %" PRIu16 " / in: %" PRIu16 " shft: %" PRIu64 "\n",
+						rd, rt, shf_amnt);
 
-                                output->verbose(CALL_INFO, 16, 0, "[decoder/LB]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-                                        rt, rs, imm_value_64);
-                                bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-                                        rt, 1, true, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER ) );
-                                insertDecodeFault = false;
-			}
-			break;
+					bundle->addInstruction( new VanadisShiftRightLogicalImmInstruction( ins_addr, hw_thr, options,
+						rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
+					insertDecodeFault = false;
+				}
+				break;
 
-		case MIPS_SPEC_OP_MASK_LBU:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
-                                output->verbose(CALL_INFO, 16, 0, "[decoder/LBU]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-                                        rt, rs, imm_value_64);
-                                bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-                                        rt, 1, false, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
-                                insertDecodeFault = false;
+			case MIPS_SPEC_OP_MASK_SRA:
+				{
+					const uint64_t shf_amnt = ((uint64_t) (next_ins & MIPS_SHFT_MASK)) >> 6;
+
+					bundle->addInstruction( new VanadisShiftRightArithmeticImmInstruction( ins_addr, hw_thr, options,
+						rd, rt, shf_amnt, VANADIS_FORMAT_INT32 ) );
+					insertDecodeFault = false;
+				}
+				break;
 			}
-			break;
+		}
 
-		case MIPS_SPEC_OP_MASK_LW:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		return ! insertDecodeFault;
+	}
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LW]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+	bool decodeRegImm( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-		case MIPS_SPEC_OP_MASK_LFP32:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		bool insertDecodeFault = true;
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LFP32]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, MEM_TRANSACTION_NONE, LOAD_FP_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		const uint64_t offset_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );;
 
-		case MIPS_SPEC_OP_MASK_LL:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		output->verbose(CALL_INFO, 16, 0, "[decoder/REGIMM] -> imm: %" PRIu64 "\n", offset_value_64);
+		output->verbose(CALL_INFO, 16, 0, "[decoder]        -> rt: 0x%08x\n", (next_ins & MIPS_RT_MASK));
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LL]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, MEM_TRANSACTION_LLSC_LOAD, LOAD_INT_REGISTER) );
+		switch( ( next_ins & MIPS_RT_MASK ) ) {
+		case MIPS_SPEC_OP_MASK_BLTZ:
+			{
+				bundle->addInstruction( new VanadisBranchRegCompareImmInstruction(ins_addr, hw_thr, options,
+					rs, 0, offset_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
 				insertDecodeFault = false;
 			}
 			break;
-
-		case MIPS_SPEC_OP_MASK_LWL:
+		case MIPS_SPEC_OP_MASK_BGEZAL:
 			{
-//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
-
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LWL (PARTLOAD)]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-                                        rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisPartialLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, false, LOAD_INT_REGISTER ) );
+				bundle->addInstruction( new VanadisBranchRegCompareImmLinkInstruction( ins_addr, hw_thr, options,
+					rs, 0, offset_value_64, (uint16_t) 31, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GTE, VANADIS_FORMAT_INT32 ) );
 				insertDecodeFault = false;
 			}
 			break;
-
-		case MIPS_SPEC_OP_MASK_LWR:
+		case MIPS_SPEC_OP_MASK_BGEZ:
 			{
-//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
-
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LWR (PARTLOAD)]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-                                        rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisPartialLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, true, LOAD_INT_REGISTER ) );
+				bundle->addInstruction( new VanadisBranchRegCompareImmInstruction(ins_addr, hw_thr, options,
+					rs, 0, offset_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GTE, VANADIS_FORMAT_INT32 ) );
 				insertDecodeFault = false;
 			}
 			break;
+		}
 
-		case MIPS_SPEC_OP_MASK_LHU:
-			{
-//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/LHU]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 2, false, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		return ! insertDecodeFault;
+	}
 
-		case MIPS_SPEC_OP_MASK_SB:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+	bool decodeLUI( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SB]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 1, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		bool insertDecodeFault = true;
 
-		case MIPS_SPEC_OP_MASK_SC:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 16 );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SC]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, MEM_TRANSACTION_LLSC_STORE, STORE_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LUI] -> reg: %" PRIu16 " / imm=%" PRId64 "\n",
+			rt, imm_value_64);
 
-		case MIPS_SPEC_OP_MASK_SW:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		bundle->addInstruction( new VanadisSetRegisterInstruction( ins_addr, hw_thr, options, rt, imm_value_64, VANADIS_FORMAT_INT32 ) );
+		insertDecodeFault = false;
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SW]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		return ! insertDecodeFault;
+	}
 
-		case MIPS_SPEC_OP_MASK_SH:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+	bool decodeLB( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SH]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 2, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+		bool insertDecodeFault = true;
 
-		case MIPS_SPEC_OP_MASK_SFP32:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SFP32]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, MEM_TRANSACTION_NONE, STORE_FP_REGISTER) );
-				insertDecodeFault = false;
-			}
-			break;
+                                output->verbose(CALL_INFO, 16, 0, "[decoder/LB]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+                                        rt, rs, imm_value_64);
+                                bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+                                        rt, 1, true, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER ) );
+                                insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_SWL:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		return ! insertDecodeFault;
+	}
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SWL]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisPartialStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, true, STORE_INT_REGISTER ) );
-				insertDecodeFault = false;
-			}
-			break;
+	bool decodeLBU( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+                                output->verbose(CALL_INFO, 16, 0, "[decoder/LBU]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+                                        rt, rs, imm_value_64);
+                                bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+                                        rt, 1, false, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
+                                insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeLW( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LW]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeLFP32( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LFP32]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, MEM_TRANSACTION_NONE, LOAD_FP_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeLL( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LL]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, MEM_TRANSACTION_LLSC_LOAD, LOAD_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeLWL( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
 
-		case MIPS_SPEC_OP_MASK_SWR:
-			{
 //				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SWR]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisPartialStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
-					rt, 4, false, STORE_INT_REGISTER ) );
-				insertDecodeFault = false;
-			}
-			break;
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LWL (PARTLOAD)]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+                                        rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisPartialLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, false, LOAD_INT_REGISTER ) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_ADDIU:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
-				output->verbose(CALL_INFO, 16, 0, "[decoder/ADDIU]: -> reg: %" PRIu16 " rs=%" PRIu16 " / imm=%" PRId64 "\n",
-					rt, rs, imm_value_64);
-				bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rt, rs, imm_value_64, VANADIS_FORMAT_INT32 ) );
-				insertDecodeFault = false;
-			}
-			break;
+		return ! insertDecodeFault;
+	}
 
-		case MIPS_SPEC_OP_MASK_BEQ:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+	bool decodeLWR( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LWR (PARTLOAD)]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+                                        rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisPartialLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, true, LOAD_INT_REGISTER ) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeLHU( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/LHU]: -> reg: %" PRIu16 " <- base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisLoadInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 2, false, MEM_TRANSACTION_NONE, LOAD_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSB( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/BEQ]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SB]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 1, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSC( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SC]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, MEM_TRANSACTION_LLSC_STORE, STORE_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSW( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SW]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSH( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SH]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 2, MEM_TRANSACTION_NONE, STORE_INT_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSFP32( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SFP32]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, MEM_TRANSACTION_NONE, STORE_FP_REGISTER) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSWL( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SWL]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisPartialStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, true, STORE_INT_REGISTER ) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSWR( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+//				const int64_t imm_value_64 = (int16_t) (next_ins & MIPS_IMM_MASK);
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SWR]: -> reg: %" PRIu16 " -> base: %" PRIu16 " + offset=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisPartialStoreInstruction( ins_addr, hw_thr, options, rs, imm_value_64,
+			rt, 4, false, STORE_INT_REGISTER ) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeADDIU( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		output->verbose(CALL_INFO, 16, 0, "[decoder/ADDIU]: -> reg: %" PRIu16 " rs=%" PRIu16 " / imm=%" PRId64 "\n",
+			rt, rs, imm_value_64);
+		bundle->addInstruction( new VanadisAddImmInstruction( ins_addr, hw_thr, options, rt, rs, imm_value_64, VANADIS_FORMAT_INT32 ) );
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeBEQ( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/BEQ]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisBranchRegCompareInstruction( ins_addr, hw_thr, options, rt, rs,
-					imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_EQ, VANADIS_FORMAT_INT32) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisBranchRegCompareInstruction( ins_addr, hw_thr, options, rt, rs,
+			imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_EQ, VANADIS_FORMAT_INT32) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_BGTZ:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeBGTZ( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/BGTZ]: -> r1: %" PRIu16 " offset: %" PRId64 "\n",
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/BGTZ]: -> r1: %" PRIu16 " offset: %" PRId64 "\n",
                                         rs, imm_value_64);
-				bundle->addInstruction( new VanadisBranchRegCompareImmInstruction( ins_addr, hw_thr, options, rs, 0,
-					imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GT, VANADIS_FORMAT_INT32) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisBranchRegCompareImmInstruction( ins_addr, hw_thr, options, rs, 0,
+			imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_GT, VANADIS_FORMAT_INT32) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_BLEZ:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeBLEZ( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/BLEZ]: -> r1: %" PRIu16 " offset: %" PRId64 "\n",
+		output->verbose(CALL_INFO, 16, 0, "[decoder/BLEZ]: -> r1: %" PRIu16 " offset: %" PRId64 "\n",
                                         rs, imm_value_64);
-				bundle->addInstruction( new VanadisBranchRegCompareImmInstruction( ins_addr, hw_thr, options, rs, 0,
-					imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_LTE, VANADIS_FORMAT_INT32) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisBranchRegCompareImmInstruction( ins_addr, hw_thr, options, rs, 0,
+			imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_LTE, VANADIS_FORMAT_INT32) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_BNE:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeBNE( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/BNE]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
+		output->verbose(CALL_INFO, 16, 0, "[decoder/BNE]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisBranchRegCompareInstruction( ins_addr, hw_thr, options, rt, rs,
-					imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_NEQ, VANADIS_FORMAT_INT32) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisBranchRegCompareInstruction( ins_addr, hw_thr, options, rt, rs,
+			imm_value_64, VANADIS_SINGLE_DELAY_SLOT, REG_COMPARE_NEQ, VANADIS_FORMAT_INT32) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_SLTI:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSLTI( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SLTI]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SLTI]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisSetRegCompareImmInstruction( ins_addr, hw_thr, options,
-					rt, rs, imm_value_64, true, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisSetRegCompareImmInstruction( ins_addr, hw_thr, options,
+			rt, rs, imm_value_64, true, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_SLTIU:
-			{
-				const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeSLTIU( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/SLTIU]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
+		bool insertDecodeFault = true;
+
+		const int64_t imm_value_64 = vanadis_sign_extend_offset_16( next_ins );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/SLTIU]: -> r1: %" PRIu16 " r2: %" PRIu16 " offset: %" PRId64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisSetRegCompareImmInstruction( ins_addr, hw_thr, options,
-					rt, rs, imm_value_64, false, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisSetRegCompareImmInstruction( ins_addr, hw_thr, options,
+			rt, rs, imm_value_64, false, REG_COMPARE_LT, VANADIS_FORMAT_INT32 ) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_ANDI:
-			{
-				// note - ANDI is zero extended, not sign extended
-				const uint64_t imm_value_64 = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
+		return ! insertDecodeFault;
+	}
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/ANDI]: -> %" PRIu16 " <- r2: %" PRIu16 " imm: %" PRIu64 "\n",
+	bool decodeANDI( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		// note - ANDI is zero extended, not sign extended
+		const uint64_t imm_value_64 = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/ANDI]: -> %" PRIu16 " <- r2: %" PRIu16 " imm: %" PRIu64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisAndImmInstruction( ins_addr, hw_thr, options,
-					rt, rs, imm_value_64) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisAndImmInstruction( ins_addr, hw_thr, options,
+			rt, rs, imm_value_64) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_ORI:
-			{
-				const uint64_t imm_value_64 = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
+		return ! insertDecodeFault;
+	}
+
+	bool decodeORI( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/ORI]: -> %" PRIu16 " <- r2: %" PRIu16 " imm: %" PRId64 "\n",
+		const uint64_t imm_value_64 = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/ORI]: -> %" PRIu16 " <- r2: %" PRIu16 " imm: %" PRId64 "\n",
                                         rt, rs, imm_value_64 );
-				bundle->addInstruction( new VanadisOrImmInstruction( ins_addr, hw_thr, options,
-					rt, rs, imm_value_64) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisOrImmInstruction( ins_addr, hw_thr, options,
+			rt, rs, imm_value_64) );
+		insertDecodeFault = false;
 
-		case MIPS_SPEC_OP_MASK_J:
-			{
-				const uint32_t j_addr_index = (next_ins & MIPS_J_ADDR_MASK) << 2;
-				const uint32_t upper_bits   = ((ins_addr + 4) & MIPS_J_UPPER_MASK);
+		return ! insertDecodeFault;
+	}
 
-				uint64_t jump_to = 0;
-				jump_to += (uint64_t) j_addr_index;
-				jump_to |= (uint64_t) upper_bits;
+	bool decodeJ( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder/J]: -> jump-to: %" PRIu64 " / 0x%0llx\n",
-					jump_to, jump_to);
+		bool insertDecodeFault = true;
+
+		const uint32_t j_addr_index = (next_ins & MIPS_J_ADDR_MASK) << 2;
+		const uint32_t upper_bits   = ((ins_addr + 4) & MIPS_J_UPPER_MASK);
+
+		uint64_t jump_to = 0;
+		jump_to += (uint64_t) j_addr_index;
+		jump_to |= (uint64_t) upper_bits;
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder/J]: -> jump-to: %" PRIu64 " / 0x%0llx\n",
+			jump_to, jump_to);
 
                                 bundle->addInstruction( new VanadisJumpInstruction( ins_addr, hw_thr, options, jump_to, VANADIS_SINGLE_DELAY_SLOT ) );
-				insertDecodeFault = false;
-			}
-			break;
-		case MIPS_SPEC_OP_MASK_JAL:
-			{
-				const uint32_t j_addr_index = (next_ins & MIPS_J_ADDR_MASK) << 2;
+		insertDecodeFault = false;
+
+		return ! insertDecodeFault;
+	}
+
+	bool decodeJAL( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		const uint32_t j_addr_index = (next_ins & MIPS_J_ADDR_MASK) << 2;
                                 const uint32_t upper_bits   = ((ins_addr + 4) & MIPS_J_UPPER_MASK);
 
-				uint64_t jump_to = 0;
+		uint64_t jump_to = 0;
                                 jump_to = jump_to + (uint64_t) j_addr_index;
                                 jump_to = jump_to + (uint64_t) upper_bits;
 
 //				bundle->addInstruction( new VanadisSetRegisterInstruction( ins_addr, hw_thr, options, 31, ins_addr + 8 ) );
-				bundle->addInstruction( new VanadisJumpLinkInstruction( ins_addr, hw_thr, options, 31, jump_to,
-					VANADIS_SINGLE_DELAY_SLOT ) );
-				insertDecodeFault = false;
-			}
-			break;
+		bundle->addInstruction( new VanadisJumpLinkInstruction( ins_addr, hw_thr, options, 31, jump_to,
+			VANADIS_SINGLE_DELAY_SLOT ) );
+		insertDecodeFault = false;
 
+		return ! insertDecodeFault;
+	}
 
-		case MIPS_SPEC_OP_MASK_XORI:
-			{
-				const uint64_t xor_mask = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
+	bool decodeXORI( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				bundle->addInstruction( new VanadisXorImmInstruction( ins_addr,
-					hw_thr, options, rt, rs, xor_mask ) );
-				insertDecodeFault = false;
-			}
+		bool insertDecodeFault = true;
 
-		case MIPS_SPEC_OP_SPECIAL3:
-			{
-				output->verbose(CALL_INFO, 16, 0, "[decoder, partial: special3], further decode required...\n");
+		const uint64_t xor_mask = static_cast<uint64_t>( next_ins & MIPS_IMM_MASK );
 
-				switch( next_ins & 0x3F ) {
-				case MIPS_SPEC_OP_MASK_RDHWR:
-					{
-						const uint16_t target_reg = rt;
-						const uint16_t req_type   = rd;
+		bundle->addInstruction( new VanadisXorImmInstruction( ins_addr,
+			hw_thr, options, rt, rs, xor_mask ) );
+		insertDecodeFault = false;
 
-						output->verbose(CALL_INFO, 16, 0, "[decode/RDHWR] target: %" PRIu16 " type: %" PRIu16 "\n",
-							target_reg, req_type);
+		return ! insertDecodeFault;
+	}
 
-						switch( rd ) {
-						case 29:
-							bundle->addInstruction( new VanadisSetRegisterInstruction( ins_addr, hw_thr, options,
-								target_reg, (int64_t) getThreadLocalStoragePointer(), VANADIS_FORMAT_INT32 ) );
-							insertDecodeFault = false;
-							break;
-						}
-					}
+	bool decodeSpecial3( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
+
+		bool insertDecodeFault = true;
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder, partial: special3], further decode required...\n");
+
+		switch( next_ins & 0x3F ) {
+		case MIPS_SPEC_OP_MASK_RDHWR:
+			{
+				const uint16_t target_reg = rt;
+				const uint16_t req_type   = rd;
+
+				output->verbose(CALL_INFO, 16, 0, "[decode/RDHWR] target: %" PRIu16 " type: %" PRIu16 "\n",
+					target_reg, req_type);
+
+				switch( rd ) {
+				case 29:
+					bundle->addInstruction( new VanadisSetRegisterInstruction( ins_addr, hw_thr, options,
+						target_reg, (int64_t) getThreadLocalStoragePointer(), VANADIS_FORMAT_INT32 ) );
+					insertDecodeFault = false;
 					break;
 				}
 			}
 			break;
+		}
 
-		case MIPS_SPEC_OP_MASK_COP1:
-			{
-				output->verbose(CALL_INFO, 16, 0, "[decode] --> reached co-processor function decoder\n");
+		return ! insertDecodeFault;
+	}
 
-				uint16_t fr = 0;
-				uint16_t ft = 0;
-				uint16_t fs = 0;
-				uint16_t fd = 0;
+	bool decodeCOP1( SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle,
+		const uint32_t hw_thr, const uint16_t rt, const uint16_t rs, const uint16_t rd ) {
 
-				extract_fp_regs( next_ins, &fr, &ft, &fs, &fd );
+		bool insertDecodeFault = true;
 
-				if( ( next_ins & 0x3E30000 ) == 0x1010000 ) {
-					// this decodes to a BRANCH on TRUE
-					const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+		output->verbose(CALL_INFO, 16, 0, "[decode] --> reached co-processor function decoder\n");
 
-					bundle->addInstruction( new VanadisBranchFPInstruction(
-						ins_addr, hw_thr, options, MIPS_FP_STATUS_REG, imm_value_64,
-						/* branch on true */ true, VANADIS_SINGLE_DELAY_SLOT ) );
-					insertDecodeFault = false;
-				} else if( ( next_ins & 0x3E30000 ) == 0x1000000 ) {
-					// this decodes to a BRANCH on FALSE
-					const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+		uint16_t fr = 0;
+		uint16_t ft = 0;
+		uint16_t fs = 0;
+		uint16_t fd = 0;
 
-					bundle->addInstruction( new VanadisBranchFPInstruction(
-						ins_addr, hw_thr, options, MIPS_FP_STATUS_REG, imm_value_64,
-						/* branch on false */ false, VANADIS_SINGLE_DELAY_SLOT ) );
-					insertDecodeFault = false;
-				} else {
+		extract_fp_regs( next_ins, &fr, &ft, &fs, &fd );
 
-				output->verbose(CALL_INFO, 16, 0, "[decoder] ----> decoding function mask: %" PRIu32 " / 0x%x\n",
-					(next_ins & MIPS_FUNC_MASK), (next_ins & MIPS_FUNC_MASK) );
+		if( ( next_ins & 0x3E30000 ) == 0x1010000 ) {
+			// this decodes to a BRANCH on TRUE
+			const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
 
-				switch( next_ins & MIPS_FUNC_MASK ) {
-				case 0:
-					{
-						if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_MTC == fr ) ) {
-							bundle->addInstruction( new VanadisGPR2FPInstruction(
-								ins_addr, hw_thr, options,
-								fs, rt, VANADIS_FORMAT_FP32 ) );
-							insertDecodeFault = false;
-						} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_MFC == fr ) ) {
-							bundle->addInstruction( new VanadisFP2GPRInstruction(
-								ins_addr, hw_thr, options,
-								rt, fs, VANADIS_FORMAT_FP32 ) );
-							insertDecodeFault = false;
-						} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_CF == fr ) ) {
-							uint16_t fp_ctrl_reg = 0;
+			bundle->addInstruction( new VanadisBranchFPInstruction(
+				ins_addr, hw_thr, options, MIPS_FP_STATUS_REG, imm_value_64,
+				/* branch on true */ true, VANADIS_SINGLE_DELAY_SLOT ) );
+			insertDecodeFault = false;
+		} else if( ( next_ins & 0x3E30000 ) == 0x1000000 ) {
+			// this decodes to a BRANCH on FALSE
+			const int64_t imm_value_64 = vanadis_sign_extend_offset_16_and_shift( next_ins, 2 );
+
+			bundle->addInstruction( new VanadisBranchFPInstruction(
+				ins_addr, hw_thr, options, MIPS_FP_STATUS_REG, imm_value_64,
+				/* branch on false */ false, VANADIS_SINGLE_DELAY_SLOT ) );
+			insertDecodeFault = false;
+		} else {
+
+		output->verbose(CALL_INFO, 16, 0, "[decoder] ----> decoding function mask: %" PRIu32 " / 0x%x\n",
+			(next_ins & MIPS_FUNC_MASK), (next_ins & MIPS_FUNC_MASK) );
+
+		switch( next_ins & MIPS_FUNC_MASK ) {
+		case 0:
+			{
+				if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_MTC == fr ) ) {
+					bundle->addInstruction( new VanadisGPR2FPInstruction(
+						ins_addr, hw_thr, options,
+						fs, rt, VANADIS_FORMAT_FP32 ) );
+					insertDecodeFault = false;
+				} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_MFC == fr ) ) {
+					bundle->addInstruction( new VanadisFP2GPRInstruction(
+						ins_addr, hw_thr, options,
+						rt, fs, VANADIS_FORMAT_FP32 ) );
+					insertDecodeFault = false;
+				} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_CF == fr ) ) {
+					uint16_t fp_ctrl_reg = 0;
                                                         bool fp_matched = false;
 
                                                         switch( rd ) {
@@ -1479,31 +1665,31 @@ protected:
                                                         }
 
                                                         if( fp_matched ) {
-								bundle->addInstruction( new VanadisFP2GPRInstruction(
-									ins_addr, hw_thr, options,
-									rt, fp_ctrl_reg, VANADIS_FORMAT_FP32 ) );
-								insertDecodeFault = false;
-							}
-						} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_CT == fr ) ) {
-							uint16_t fp_ctrl_reg = 0;
-							bool fp_matched = false;
-
-							switch( rd ) {
-							case 0:  fp_ctrl_reg = MIPS_FP_VER_REG; fp_matched = true; break;
-							case 31: fp_ctrl_reg = MIPS_FP_STATUS_REG; fp_matched = true; break;
-							default:
-								break;
-							}
+						bundle->addInstruction( new VanadisFP2GPRInstruction(
+							ins_addr, hw_thr, options,
+							rt, fp_ctrl_reg, VANADIS_FORMAT_FP32 ) );
+						insertDecodeFault = false;
+					}
+				} else if( ( 0 == fd ) && ( MIPS_SPEC_COP_MASK_CT == fr ) ) {
+					uint16_t fp_ctrl_reg = 0;
+					bool fp_matched = false;
+
+					switch( rd ) {
+					case 0:  fp_ctrl_reg = MIPS_FP_VER_REG; fp_matched = true; break;
+					case 31: fp_ctrl_reg = MIPS_FP_STATUS_REG; fp_matched = true; break;
+					default:
+						break;
+					}
 
-							if( fp_matched ) {
-								bundle->addInstruction( new VanadisGPR2FPInstruction(
-									ins_addr, hw_thr, options,
-									fp_ctrl_reg, rt, VANADIS_FORMAT_FP32 ) );
-								insertDecodeFault = false;
-							}
-						} else {
-							// assume this is an FADD and begin decode
-							VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+					if( fp_matched ) {
+						bundle->addInstruction( new VanadisGPR2FPInstruction(
+							ins_addr, hw_thr, options,
+							fp_ctrl_reg, rt, VANADIS_FORMAT_FP32 ) );
+						insertDecodeFault = false;
+					}
+				} else {
+					// assume this is an FADD and begin decode
+					VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
        		                                        bool format_fault = false;
 
                 	                                switch( fr ) {
@@ -1517,42 +1703,42 @@ protected:
                                                 	}
 
                                                 	if( ! format_fault ) {
-								bundle->addInstruction( new VanadisFPAddInstruction(
-									ins_addr, hw_thr, options,
-									fd, fs, ft, input_format) );
-								insertDecodeFault = false;
-							}
-						}
+						bundle->addInstruction( new VanadisFPAddInstruction(
+							ins_addr, hw_thr, options,
+							fd, fs, ft, input_format) );
+						insertDecodeFault = false;
 					}
-					break;
+				}
+			}
+			break;
 
-				case MIPS_SPEC_COP_MASK_MOV:
+		case MIPS_SPEC_COP_MASK_MOV:
+			{
+				// Decide operand format
+				switch( fr ) {
+				case 16:
 					{
-						// Decide operand format
-						switch( fr ) {
-						case 16:
-							{
-								bundle->addInstruction( new VanadisFP2FPInstruction(
-									ins_addr, hw_thr, options,
-									fd, fs, VANADIS_FORMAT_FP32 ) );
-								insertDecodeFault = false;
-							}
-							break;
-						case 17:
-							{
-								bundle->addInstruction( new VanadisFP2FPInstruction(
-									ins_addr, hw_thr, options,
-									fd, fs, VANADIS_FORMAT_FP64 ) );
-								insertDecodeFault = false;
-							}
-							break;
-						}
+						bundle->addInstruction( new VanadisFP2FPInstruction(
+							ins_addr, hw_thr, options,
+							fd, fs, VANADIS_FORMAT_FP32 ) );
+						insertDecodeFault = false;
 					}
 					break;
-
-				case MIPS_SPEC_COP_MASK_MUL:
+				case 17:
 					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+						bundle->addInstruction( new VanadisFP2FPInstruction(
+							ins_addr, hw_thr, options,
+							fd, fs, VANADIS_FORMAT_FP64 ) );
+						insertDecodeFault = false;
+					}
+					break;
+				}
+			}
+			break;
+
+		case MIPS_SPEC_COP_MASK_MUL:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
                                                 bool format_fault = false;
 
                                                 switch( fr ) {
@@ -1566,19 +1752,19 @@ protected:
                                                 }
 
                                                 if( ! format_fault ) {
-							bundle->addInstruction( new VanadisFPMultiplyInstruction(
-								ins_addr, hw_thr, options,
-								fd, fs, ft, input_format) );
-							insertDecodeFault = false;
-						} else {
-							output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
-						}
-					}
-					break;
+					bundle->addInstruction( new VanadisFPMultiplyInstruction(
+						ins_addr, hw_thr, options,
+						fd, fs, ft, input_format) );
+					insertDecodeFault = false;
+				} else {
+					output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
+				}
+			}
+			break;
 
-				case MIPS_SPEC_COP_MASK_DIV:
-					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+		case MIPS_SPEC_COP_MASK_DIV:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
                                                 bool format_fault = false;
 
                                                 switch( fr ) {
@@ -1592,19 +1778,19 @@ protected:
                                                 }
 
                                                 if( ! format_fault ) {
-							bundle->addInstruction( new VanadisFPDivideInstruction(
-								ins_addr, hw_thr, options,
-								fd, fs, ft, input_format) );
-							insertDecodeFault = false;
-						} else {
-							output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
-						}
-					}
-					break;
+					bundle->addInstruction( new VanadisFPDivideInstruction(
+						ins_addr, hw_thr, options,
+						fd, fs, ft, input_format) );
+					insertDecodeFault = false;
+				} else {
+					output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
+				}
+			}
+			break;
 
-				case MIPS_SPEC_COP_MASK_SUB:
-					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+		case MIPS_SPEC_COP_MASK_SUB:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
                                                 bool format_fault = false;
 
                                                 switch( fr ) {
@@ -1618,134 +1804,117 @@ protected:
                                                 }
 
                                                 if( ! format_fault ) {
-							bundle->addInstruction( new VanadisFPSubInstruction(
-								ins_addr, hw_thr, options,
-								fd, fs, ft, input_format) );
-							insertDecodeFault = false;
-						} else {
-							output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
-						}
-					}
+					bundle->addInstruction( new VanadisFPSubInstruction(
+						ins_addr, hw_thr, options,
+						fd, fs, ft, input_format) );
+					insertDecodeFault = false;
+				} else {
+					output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
+				}
+			}
+			break;
+
+		case MIPS_SPEC_COP_MASK_CVTD:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+				bool format_fault = false;
+
+				switch( fr ) {
+				case 16: input_format = VANADIS_FORMAT_FP32;  break;
+				case 17: input_format = VANADIS_FORMAT_FP64;  break;
+				case 20: input_format = VANADIS_FORMAT_INT32; break;
+				case 21: input_format = VANADIS_FORMAT_INT64; break;
+				default:
+					format_fault = true;
 					break;
+				}
 
-				case MIPS_SPEC_COP_MASK_CVTD:
-					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
-						bool format_fault = false;
-
-						switch( fr ) {
-						case 16: input_format = VANADIS_FORMAT_FP32;  break;
-						case 17: input_format = VANADIS_FORMAT_FP64;  break;
-						case 20: input_format = VANADIS_FORMAT_INT32; break;
-						case 21: input_format = VANADIS_FORMAT_INT64; break;
-						default:
-							format_fault = true;
-							break;
-						}
+				if( ! format_fault ) {
+					bundle->addInstruction( new VanadisFPConvertInstruction(
+						ins_addr, hw_thr, options,
+						fd, fs, input_format, VANADIS_FORMAT_FP64 ) );
+					insertDecodeFault = false;
+				} else {
+					output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
+				}
+			}
 
-						if( ! format_fault ) {
-							bundle->addInstruction( new VanadisFPConvertInstruction(
-								ins_addr, hw_thr, options,
-								fd, fs, input_format, VANADIS_FORMAT_FP64 ) );
-							insertDecodeFault = false;
-						} else {
-							output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
-						}
-					}
+			break;
 
+		case MIPS_SPEC_COP_MASK_CVTW:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+				bool format_fault = false;
+
+				switch( fr ) {
+				case 16: input_format = VANADIS_FORMAT_FP32;  break;
+				case 17: input_format = VANADIS_FORMAT_FP64;  break;
+				case 20: input_format = VANADIS_FORMAT_INT32; break;
+				case 21: input_format = VANADIS_FORMAT_INT64; break;
+				default:
+					format_fault = true;
 					break;
+				}
 
-				case MIPS_SPEC_COP_MASK_CVTW:
-					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
-						bool format_fault = false;
-
-						switch( fr ) {
-						case 16: input_format = VANADIS_FORMAT_FP32;  break;
-						case 17: input_format = VANADIS_FORMAT_FP64;  break;
-						case 20: input_format = VANADIS_FORMAT_INT32; break;
-						case 21: input_format = VANADIS_FORMAT_INT64; break;
-						default:
-							format_fault = true;
-							break;
-						}
+				if( ! format_fault ) {
+					bundle->addInstruction( new VanadisFPConvertInstruction(
+						ins_addr, hw_thr, options,
+						fd, fs, input_format, VANADIS_FORMAT_INT32 ) );
+					insertDecodeFault = false;
+				} else {
+					output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
+				}
+			}
 
-						if( ! format_fault ) {
-							bundle->addInstruction( new VanadisFPConvertInstruction(
-								ins_addr, hw_thr, options,
-								fd, fs, input_format, VANADIS_FORMAT_INT32 ) );
-							insertDecodeFault = false;
-						} else {
-							output->verbose(CALL_INFO, 16, 0, "[decoder] ---> convert function failed because of input-format error (fmt: %" PRIu16 ")\n", fr);
-						}
-					}
+			break;
 
+		case MIPS_SPEC_COP_MASK_CMP_LT:
+		case MIPS_SPEC_COP_MASK_CMP_LTE:
+		case MIPS_SPEC_COP_MASK_CMP_EQ:
+			{
+				VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
+				bool format_fault = false;
+
+				switch( fr ) {
+				case 16: input_format = VANADIS_FORMAT_FP32;  break;
+				case 17: input_format = VANADIS_FORMAT_FP64;  break;
+				case 20: input_format = VANADIS_FORMAT_INT32; break;
+				case 21: input_format = VANADIS_FORMAT_INT64; break;
+				default:
+					format_fault = true;
 					break;
+				}
 
-				case MIPS_SPEC_COP_MASK_CMP_LT:
-				case MIPS_SPEC_COP_MASK_CMP_LTE:
-				case MIPS_SPEC_COP_MASK_CMP_EQ:
-					{
-						VanadisRegisterFormat input_format = VANADIS_FORMAT_FP64;
-						bool format_fault = false;
-
-						switch( fr ) {
-						case 16: input_format = VANADIS_FORMAT_FP32;  break;
-						case 17: input_format = VANADIS_FORMAT_FP64;  break;
-						case 20: input_format = VANADIS_FORMAT_INT32; break;
-						case 21: input_format = VANADIS_FORMAT_INT64; break;
-						default:
-							format_fault = true;
-							break;
-						}
-
-						VanadisRegisterCompareType compare_type = REG_COMPARE_EQ;
-						bool compare_fault = false;
-
-						switch( next_ins & 0xF ) {
-						case 0x2:  compare_type = REG_COMPARE_EQ;  break;
-						case 0xC:  compare_type = REG_COMPARE_LT;  break;
-						case 0xE:  compare_type = REG_COMPARE_LTE; break;
-						default:
-							compare_fault = true;
-							break;
-						}
+				VanadisRegisterCompareType compare_type = REG_COMPARE_EQ;
+				bool compare_fault = false;
 
-						// if neither are true, then we have a good decode, otherwise a problem.
-						// register 31 is where condition codes and rounding modes are kept
-						if( ! (format_fault | compare_fault) ) {
-							bundle->addInstruction( new VanadisFPSetRegCompareInstruction(
-								ins_addr, hw_thr, options,
-								MIPS_FP_STATUS_REG, fs, ft, input_format, compare_type ) );
-							insertDecodeFault = false;
-						}
-					}
+				switch( next_ins & 0xF ) {
+				case 0x2:  compare_type = REG_COMPARE_EQ;  break;
+				case 0xC:  compare_type = REG_COMPARE_LT;  break;
+				case 0xE:  compare_type = REG_COMPARE_LTE; break;
+				default:
+					compare_fault = true;
 					break;
 				}
+
+				// if neither are true, then we have a good decode, otherwise a problem.
+				// register 31 is where condition codes and rounding modes are kept
+				if( ! (format_fault | compare_fault) ) {
+					bundle->addInstruction( new VanadisFPSetRegCompareInstruction(
+						ins_addr, hw_thr, options,
+						MIPS_FP_STATUS_REG, fs, ft, input_format, compare_type ) );
+					insertDecodeFault = false;
 				}
 			}
 			break;
-		default:
-			break;
-		}
 		}
-
-		if( insertDecodeFault ) {
-			bundle->addInstruction( new VanadisInstructionDecodeFault( ins_addr, getHardwareThread(), options) );
-		}
-
-		for( uint32_t i = 0; i < bundle->getInstructionCount(); ++i ) {
-			output->verbose(CALL_INFO, 16, 0, "-> [%3" PRIu32 "]: %s\n", i, bundle->getInstructionByIndex(i)->getInstCode());
-		}
-
-		// Mark the end of a micro-op group so we can count real instructions and not just micro-ops
-		if( bundle->getInstructionCount() > 0 ) {
-			bundle->getInstructionByIndex( bundle->getInstructionCount() - 1 )->markEndOfMicroOpGroup();
 		}
 
+		return ! insertDecodeFault;
 	}
 
 	const VanadisDecoderOptions* options;
+	MIPSOpDecoder op_decoders[64];
 
 	uint64_t start_stack_address;
 
@@ -9,8 +9,11 @@
 #include "inst/vregfmt.h"
 #include "inst/vinsttype.h"
 #include "inst/regfile.h"
+#include "inst/vinstpool.h"
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 namespace SST {
 namespace Vanadis {
@@ -41,31 +44,8 @@ public:
 		count_isa_fp_reg_in(c_isa_fp_reg_in),
 		count_isa_fp_reg_out(c_isa_fp_reg_out)
 	{
-
-
-		phys_int_regs_in  = (count_phys_int_reg_in > 0)  ? new uint16_t[ count_phys_int_reg_in  ] : nullptr;
-		std::memset( phys_int_regs_in, 0, count_phys_int_reg_in );
-
-		phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[ count_phys_int_reg_out ] : nullptr;
-		std::memset( phys_int_regs_out, 0, count_phys_int_reg_out );
-
-		isa_int_regs_in   = (count_isa_int_reg_in > 0)   ? new uint16_t[ count_isa_int_reg_in   ] : nullptr;
-		std::memset( isa_int_regs_in, 0, count_isa_int_reg_in );
-
-		isa_int_regs_out  = (count_isa_int_reg_out> 0)   ? new uint16_t[ count_isa_int_reg_out  ] : nullptr;
-		std::memset( isa_int_regs_out, 0, count_isa_int_reg_out );
-
-		phys_fp_regs_in   = (count_phys_fp_reg_in > 0)   ? new uint16_t[ count_phys_fp_reg_in   ] : nullptr;
-		std::memset( phys_fp_regs_in, 0, count_phys_fp_reg_in );
-
-		phys_fp_regs_out  = (count_phys_fp_reg_out> 0)   ? new uint16_t[ count_phys_fp_reg_out  ] : nullptr;
-		std::memset( phys_fp_regs_out, 0, count_phys_fp_reg_out );
-
-		isa_fp_regs_in    = (count_isa_fp_reg_in > 0 )   ? new uint16_t[ count_isa_fp_reg_in    ] : nullptr;
-		std::memset( isa_fp_regs_in, 0, count_isa_fp_reg_in );
-
-		isa_fp_regs_out   = (count_isa_fp_reg_out > 0 )  ? new uint16_t[ count_isa_fp_reg_out   ] : nullptr;
-		std::memset( isa_fp_regs_out, 0, count_isa_fp_reg_out );
+		allocateRegisterLists();
+		std::memset( reg_storage, 0, countAllRegisters() * sizeof(uint16_t) );
 
 		trapError = false;
 		hasExecuted = false;
@@ -77,14 +57,7 @@ public:
 	}
 
 	virtual ~VanadisInstruction() {
-		if( phys_int_regs_in != nullptr  ) delete[] phys_int_regs_in;
-		if( phys_int_regs_out != nullptr ) delete[] phys_int_regs_out;
-		if( isa_int_regs_in != nullptr   ) delete[] isa_int_regs_in;
-		if( isa_int_regs_out != nullptr  ) delete[] isa_int_regs_out;
-		if( phys_fp_regs_in != nullptr   ) delete[] phys_fp_regs_in;
-		if( phys_fp_regs_out != nullptr  ) delete[] phys_fp_regs_out;
-		if( isa_fp_regs_in != nullptr    ) delete[] isa_fp_regs_in;
-		if( isa_fp_regs_out != nullptr   ) delete[] isa_fp_regs_out;
+		releaseRegisterLists();
 	}
 
 	VanadisInstruction( const VanadisInstruction& copy_me ) :
@@ -109,49 +82,20 @@ public:
 		isFrontOfROB = false;
 		hasROBSlot = false;
 
-		phys_int_regs_in  = (count_phys_int_reg_in > 0)  ? new uint16_t[ count_phys_int_reg_in  ] : nullptr;
-                phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[ count_phys_int_reg_out ] : nullptr;
-
-                isa_int_regs_in   = (count_isa_int_reg_in > 0)   ? new uint16_t[ count_isa_int_reg_in   ] : nullptr;
-                isa_int_regs_out  = (count_isa_int_reg_out> 0)   ? new uint16_t[ count_isa_int_reg_out  ] : nullptr;
-
-                phys_fp_regs_in   = (count_phys_fp_reg_in > 0)   ? new uint16_t[ count_phys_fp_reg_in   ] : nullptr;
-                phys_fp_regs_out  = (count_phys_fp_reg_out> 0)   ? new uint16_t[ count_phys_fp_reg_out  ] : nullptr;
-
-                isa_fp_regs_in    = (count_isa_fp_reg_in > 0 )   ? new uint16_t[ count_isa_fp_reg_in    ] : nullptr;
-                isa_fp_regs_out   = (count_isa_fp_reg_out > 0 )  ? new uint16_t[ count_isa_fp_reg_out   ] : nullptr;
-
-		for( uint16_t i = 0; i < count_phys_int_reg_in; ++i ) {
-			phys_int_regs_in[i] = copy_me.phys_int_regs_in[i];
-		}
-
-		for( uint16_t i = 0; i < count_phys_int_reg_out; ++i ) {
-			phys_int_regs_out[i] = copy_me.phys_int_regs_out[i];
-		}
-
-		for( uint16_t i = 0; i < count_isa_int_reg_in; ++i ) {
-			isa_int_regs_in[i] = copy_me.isa_int_regs_in[i];
-		}
-
-		for( uint16_t i = 0; i < count_isa_int_reg_out; ++i ) {
-			isa_int_regs_out[i] = copy_me.isa_int_regs_out[i];
-		}
-
-		for( uint16_t i = 0; i < count_phys_fp_reg_in; ++i ) {
-			phys_fp_regs_in[i] = copy_me.phys_fp_regs_in[i];
-		}
-
-		for( uint16_t i = 0; i < count_phys_fp_reg_out; ++i ) {
-			phys_fp_regs_out[i] = copy_me.phys_fp_regs_out[i];
-		}
+		// Both instructions lay their lists out in the same order so the
+		// whole block can be copied at once
+		allocateRegisterLists();
+		std::memcpy( reg_storage, copy_me.reg_storage, countAllRegisters() * sizeof(uint16_t) );
+	}
 
-		for( uint16_t i = 0; i < count_isa_fp_reg_in; ++i ) {
-			isa_fp_regs_in[i] = copy_me.isa_fp_regs_in[i];
-		}
+	// Instructions are cloned from the micro-op cache for every dispatch,
+	// so their storage comes from a free list rather than the heap
+	static void* operator new( size_t size ) {
+		return VanadisInstructionPool::allocate( size );
+	}
 
-		for( uint16_t i = 0; i < count_isa_fp_reg_out; ++i ) {
-			isa_fp_regs_out[i] = copy_me.isa_fp_regs_out[i];
-		}
+	static void operator delete( void* ptr, size_t size ) {
+		VanadisInstructionPool::release( ptr, size );
 	}
 
 	void writeIntRegs( char* buffer, size_t max_buff_size ) {
@@ -351,6 +295,65 @@ public:
 	}
 
 protected:
+	// All eight register lists of an instruction share one block, which is
+	// held inside the instruction when it is small enough (nearly every
+	// MIPS instruction) so a clone needs no allocation beyond the object.
+	// The integer input lists are placed first so they can be resized
+	// without moving the others relative to each other.
+	uint32_t countAllRegisters() const {
+		return static_cast<uint32_t>(count_phys_int_reg_in) + count_isa_int_reg_in +
+			count_phys_int_reg_out + count_isa_int_reg_out +
+			count_phys_fp_reg_in + count_phys_fp_reg_out +
+			count_isa_fp_reg_in + count_isa_fp_reg_out;
+	}
+
+	static uint16_t* placeRegisterList( uint16_t*& next, const uint16_t count ) {
+		uint16_t* list = (count > 0) ? next : nullptr;
+		next += count;
+		return list;
+	}
+
+	void allocateRegisterLists() {
+		const uint32_t total = countAllRegisters();
+		reg_storage = (total <= VANADIS_INST_INLINE_REGS) ? inline_regs : new uint16_t[ total ];
+
+		uint16_t* next = reg_storage;
+
+		phys_int_regs_in  = placeRegisterList( next, count_phys_int_reg_in  );
+		isa_int_regs_in   = placeRegisterList( next, count_isa_int_reg_in   );
+		phys_int_regs_out = placeRegisterList( next, count_phys_int_reg_out );
+		isa_int_regs_out  = placeRegisterList( next, count_isa_int_reg_out  );
+		phys_fp_regs_in   = placeRegisterList( next, count_phys_fp_reg_in   );
+		phys_fp_regs_out  = placeRegisterList( next, count_phys_fp_reg_out  );
+		isa_fp_regs_in    = placeRegisterList( next, count_isa_fp_reg_in    );
+		isa_fp_regs_out   = placeRegisterList( next, count_isa_fp_reg_out   );
+	}
+
+	void releaseRegisterLists() {
+		if( reg_storage != inline_regs ) {
+			delete[] reg_storage;
+		}
+
+		reg_storage = nullptr;
+	}
+
+	// Changes the number of integer input registers (physical and ISA),
+	// the new input lists are zeroed and all other lists keep their contents
+	void resizeIntRegsIn( const uint16_t count ) {
+		const uint32_t old_in_count = static_cast<uint32_t>(count_phys_int_reg_in) + count_isa_int_reg_in;
+		std::vector<uint16_t> other_regs( reg_storage + old_in_count, reg_storage + countAllRegisters() );
+
+		releaseRegisterLists();
+
+		count_phys_int_reg_in = count;
+		count_isa_int_reg_in  = count;
+
+		allocateRegisterLists();
+
+		std::memset( reg_storage, 0, 2 * count * sizeof(uint16_t) );
+		std::copy( other_regs.begin(), other_regs.end(), reg_storage + (2 * count) );
+	}
+
 	const uint64_t ins_address;
 	const uint32_t hw_thread;
 
@@ -374,6 +377,11 @@ protected:
 	uint16_t* isa_fp_regs_in;
 	uint16_t* isa_fp_regs_out;
 
+	static const uint32_t VANADIS_INST_INLINE_REGS = 16;
+
+	uint16_t* reg_storage;
+	uint16_t inline_regs[VANADIS_INST_INLINE_REGS];
+
 	bool trapError;
 	bool hasExecuted;
 	bool hasIssued;
@@ -0,0 +1,20 @@
+
+#ifndef _H_VANADIS_INSTRUCTION_POOL
+#define _H_VANADIS_INSTRUCTION_POOL
+
+#include "sst/elements/common/sizeClassPool.h"
+
+namespace SST {
+namespace Vanadis {
+
+// Free lists for instruction objects. Every instruction that enters the
+// pipeline is a clone of a decoded template held in the micro-op cache
+// and is deleted again at retire or flush, so the same few object sizes
+// are allocated and released every cycle. Released blocks are handed back
+// out by the next clone rather than going through the general heap.
+class VanadisInstructionPool : public SST::Elements::SizeClassPool<VanadisInstructionPool, 16, 32, 4096> {};
+
+}
+}
+
+#endif
@@ -44,8 +44,9 @@ decode0   = v_cpu_0.setSubComponent( "decoder0", "vanadis.VanadisMIPSDecoder" )
 os_hdlr   = decode0.setSubComponent( "os_handler", "vanadis.VanadisMIPSOSHandler" )
 
 decode0.addParams({
-	"uop_cache_entries" : 1536,
-	"predecode_cache_entries" : 4
+	"uop_cache_entries" : os.getenv("VANADIS_UOP_CACHE_ENTRIES", 1536),
+	"predecode_cache_entries" : os.getenv("VANADIS_PREDECODE_CACHE_ENTRIES", 4),
+	"branch_predictor_entries" : os.getenv("VANADIS_BRANCH_PREDICTOR_ENTRIES", 32)
 })
 
 os_hdlr.addParams({
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Measure Vanadis front-end throughput as the uop cache grows
+# Usage: ./benchFetch.sh [executable]
+# Run from the vanadis source directory, basic_vanadis.py looks for tests/ there
+
+export EXE=${1:-./tests/stream-mini-musl}
+DIR=$(dirname $0)
+
+for entries in 128 512 1536 4096 16384 ; do
+    start=$(date +%s.%N)
+    retired=$(VANADIS_UOP_CACHE_ENTRIES=${entries} sst ${DIR}/basic_vanadis.py 2>&1 | \
+        grep "instructions_retired" | sed -e 's/.*Sum.u64 = \([0-9]*\).*/\1/')
+    end=$(date +%s.%N)
+    echo "uop_cache_entries=${entries}: ${retired} instructions in $(echo "${end} - ${start}" | bc) s, $(echo "${retired} / (${end} - ${start})" | bc) instructions/s"
+done